@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Voxino
+{
+
+/**
+ * \brief Returns the number of heap allocations made by the benchmark process so far.
+ *
+ * Global operator new is replaced in AllocationCounter.cpp, so every allocation made through it is
+ * counted, no matter which thread made it.
+ */
+std::size_t numberOfAllocations();
+
+}// namespace Voxino
@@ -1,89 +1,101 @@
+#include "AllocationCounter.h"
 #include "Resources/TexturePackArray.h"
+#include "World/Polygons/Chunks/ChunkFaceVisibility.h"
 #include "World/Polygons/Chunks/Types/ChunkBinaryGreedyMeshing.h"
 #include "World/Polygons/Chunks/Types/ChunkCulling.h"
 #include "World/Polygons/Chunks/Types/ChunkCullingGpu.h"
+#include "World/Polygons/Chunks/Types/ChunkCullingInstanced.h"
 #include "World/Polygons/Chunks/Types/ChunkGreedyMeshing.h"
 #include "World/Polygons/Chunks/Types/ChunkNaive.h"
-#include "defines.h"
 
 #include <benchmark/benchmark.h>
 
 namespace Voxino
 {
 
-static void BM_ChunkCullingRebuildMesh(benchmark::State& state)
+/**
+ * \brief Rebuilds the mesh of a chunk in a loop. The first rebuild is not measured, so the
+ * builders have already reserved their storage. Reports the heap allocations per rebuild, which
+ * should not grow with the number of quads of the mesh.
+ */
+template<typename ChunkType>
+static void rebuildMeshCountingAllocations(benchmark::State& state)
 {
-    initializeOpenGL();
-
     auto blockPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
-    auto texturePack = TexturePackArray("default");
-    auto chunk = Polygons::ChunkCulling(blockPosition, texturePack);
+    auto texturePack = TexturePackArray();
+    auto chunk = ChunkType(blockPosition, texturePack);
+    chunk.rebuildMesh();
+
+    const auto allocationsBefore = numberOfAllocations();
     for (auto _: state)
     {
         chunk.rebuildMesh();
     }
+    state.counters["allocations"] = benchmark::Counter(
+        static_cast<double>(numberOfAllocations() - allocationsBefore),
+        benchmark::Counter::kAvgIterations);
+    state.counters["vertices"] = chunk.preparedMesh().numberOfVertices();
+}
+
+static void BM_ChunkCullingRebuildMesh(benchmark::State& state)
+{
+    rebuildMeshCountingAllocations<Polygons::ChunkCulling>(state);
 }
 
 BENCHMARK(BM_ChunkCullingRebuildMesh);
 
 static void BM_ChunkCullingGPURebuildMesh(benchmark::State& state)
 {
-    initializeOpenGL();
-
-    auto blockPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
-    auto texturePack = TexturePackArray("default");
-    auto chunk = Polygons::ChunkCullingGpu(blockPosition, texturePack);
-    for (auto _: state)
-    {
-        chunk.rebuildMesh();
-    }
+    rebuildMeshCountingAllocations<Polygons::ChunkCullingGpu>(state);
 }
 
 BENCHMARK(BM_ChunkCullingGPURebuildMesh);
 
-static void BM_ChunkNaiveRebuildMesh(benchmark::State& state)
+static void BM_ChunkCullingInstancedRebuildMesh(benchmark::State& state)
 {
-    initializeOpenGL();
+    rebuildMeshCountingAllocations<Polygons::ChunkCullingInstanced>(state);
+}
 
-    auto blockPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
-    auto texturePack = TexturePackArray("default");
-    auto chunk = Polygons::ChunkNaive(blockPosition, texturePack);
-    for (auto _: state)
-    {
-        chunk.rebuildMesh();
-    }
+BENCHMARK(BM_ChunkCullingInstancedRebuildMesh);
+
+static void BM_ChunkNaiveRebuildMesh(benchmark::State& state)
+{
+    rebuildMeshCountingAllocations<Polygons::ChunkNaive>(state);
 }
 
 BENCHMARK(BM_ChunkNaiveRebuildMesh);
 
 static void BM_ChunkGreedyMeshingRebuildMesh(benchmark::State& state)
 {
-    initializeOpenGL();
-
-    auto blockPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
-    auto texturePack = TexturePackArray("default");
-    auto chunk = Polygons::ChunkGreedyMeshing(blockPosition, texturePack);
-    for (auto _: state)
-    {
-        chunk.rebuildMesh();
-    }
+    rebuildMeshCountingAllocations<Polygons::ChunkGreedyMeshing>(state);
 }
 
 BENCHMARK(BM_ChunkGreedyMeshingRebuildMesh);
 
 static void BM_ChunkBinaryGreedyMeshingRebuildMesh(benchmark::State& state)
 {
-    initializeOpenGL();
+    rebuildMeshCountingAllocations<Polygons::ChunkBinaryGreedyMeshing>(state);
+}
+
+BENCHMARK(BM_ChunkBinaryGreedyMeshingRebuildMesh);
 
+/**
+ * \brief Computes the visible faces of a chunk from its occupancy rows, the step shared by the
+ * culling and the binary greedy mesher.
+ */
+static void BM_ChunkFaceVisibilityBuild(benchmark::State& state)
+{
     auto blockPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
-    auto texturePack = TexturePackArray("default");
-    auto chunk = Polygons::ChunkBinaryGreedyMeshing(blockPosition, texturePack);
+    auto texturePack = TexturePackArray();
+    auto chunk = Polygons::ChunkCulling(blockPosition, texturePack);
+    auto& faceVisibility = Polygons::ChunkFaceVisibility::ofCurrentThread();
     for (auto _: state)
     {
-        chunk.rebuildMesh();
+        faceVisibility.build(chunk);
+        benchmark::DoNotOptimize(faceVisibility);
     }
 }
 
-BENCHMARK(BM_ChunkBinaryGreedyMeshingRebuildMesh);
+BENCHMARK(BM_ChunkFaceVisibilityBuild);
 
 }// namespace Voxino
\ No newline at end of file
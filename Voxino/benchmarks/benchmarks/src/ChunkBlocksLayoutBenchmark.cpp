@@ -0,0 +1,174 @@
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/SimpleTerrainGenerator.h"
+#include "World/Raycast/Chunks/OctreeGpu.h"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+namespace Voxino
+{
+
+/*
+ * Compares the layouts of the blocks of a chunk on the same terrain, for writing the blocks and for
+ * the parts of the meshers and of the octree that read them. The occupancy rows kept by the blocks
+ * do not depend on the layout, so the face visibility built from them and whole meshers are
+ * measured by ChunkBenchmark, which uses the layout chosen in constants.h, see
+ * USE_MORTON_CHUNK_BLOCKS.
+ */
+
+using LinearChunkBlocks = BasicChunkBlocks<LinearChunkBlocksLayout<CHUNK_BLOCKS_PER_DIMENSION>>;
+
+template<typename Blocks>
+static Blocks generateTerrainBlocks()
+{
+    auto terrainGenerator = SimpleTerrainGenerator();
+    auto chunkPosition = Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
+    auto generatedBlocks = ChunkBlocks();
+    terrainGenerator.generateTerrain(chunkPosition, generatedBlocks);
+
+    auto blocks = Blocks();
+    for (const auto& [position, block]: generatedBlocks)
+    {
+        blocks.setBlock(position, block.id());
+    }
+    return blocks;
+}
+
+/**
+ * \brief Writes the terrain column span by column span, the way the terrain generator does. Every
+ * write keeps the occupancy rows up to date, from which the culling and the greedy mesher find the
+ * visible faces.
+ */
+template<typename Blocks>
+static void writeTerrain(benchmark::State& state)
+{
+    struct ColumnSpan
+    {
+        int x, z, beginY, endY;
+        BlockId blockId;
+    };
+
+    constexpr auto size = Blocks::BLOCKS_PER_DIMENSION;
+    const auto terrainBlocks = generateTerrainBlocks<Blocks>();
+    std::vector<ColumnSpan> spans;
+    for (auto z = 0; z < size; ++z)
+    {
+        for (auto x = 0; x < size; ++x)
+        {
+            for (auto y = 0; y < size; ++y)
+            {
+                const auto blockId = terrainBlocks.block(x, y, z).id();
+                if (not spans.empty() && spans.back().x == x && spans.back().z == z &&
+                    spans.back().endY == y && spans.back().blockId == blockId)
+                {
+                    ++spans.back().endY;
+                }
+                else if (blockId != BlockId::Air)
+                {
+                    spans.push_back({x, z, y, y + 1, blockId});
+                }
+            }
+        }
+    }
+
+    for (auto _: state)
+    {
+        auto blocks = Blocks();
+        for (const auto& span: spans)
+        {
+            blocks.setColumnSpan(span.x, span.z, span.beginY, span.endY, span.blockId);
+        }
+        benchmark::DoNotOptimize(blocks);
+    }
+}
+
+/**
+ * \brief Reads every block together with its six neighbours, the way meshers checking faces block
+ * by block do.
+ */
+template<typename Blocks>
+static void probeNeighbours(benchmark::State& state)
+{
+    constexpr auto size = Blocks::BLOCKS_PER_DIMENSION;
+    const auto blocks = generateTerrainBlocks<Blocks>();
+    for (auto _: state)
+    {
+        auto visibleFaces = 0;
+        for (auto z = 1; z < size - 1; ++z)
+        {
+            for (auto y = 1; y < size - 1; ++y)
+            {
+                for (auto x = 1; x < size - 1; ++x)
+                {
+                    if (blocks.block(x, y, z).isTransparent())
+                    {
+                        continue;
+                    }
+                    visibleFaces += blocks.block(x - 1, y, z).isTransparent();
+                    visibleFaces += blocks.block(x + 1, y, z).isTransparent();
+                    visibleFaces += blocks.block(x, y - 1, z).isTransparent();
+                    visibleFaces += blocks.block(x, y + 1, z).isTransparent();
+                    visibleFaces += blocks.block(x, y, z - 1).isTransparent();
+                    visibleFaces += blocks.block(x, y, z + 1).isTransparent();
+                }
+            }
+        }
+        benchmark::DoNotOptimize(visibleFaces);
+    }
+}
+
+template<typename Blocks>
+static void buildOctree(benchmark::State& state)
+{
+    const auto blocks = generateTerrainBlocks<Blocks>();
+    for (auto _: state)
+    {
+        auto octree = Raycast::OctreeGpu();
+        octree.prepareData(blocks);
+        benchmark::DoNotOptimize(octree);
+    }
+}
+
+static void BM_LinearChunkBlocksTerrainWrite(benchmark::State& state)
+{
+    writeTerrain<LinearChunkBlocks>(state);
+}
+
+BENCHMARK(BM_LinearChunkBlocksTerrainWrite);
+
+static void BM_MortonChunkBlocksTerrainWrite(benchmark::State& state)
+{
+    writeTerrain<MortonChunkBlocks>(state);
+}
+
+BENCHMARK(BM_MortonChunkBlocksTerrainWrite);
+
+static void BM_LinearChunkBlocksNeighbourProbes(benchmark::State& state)
+{
+    probeNeighbours<LinearChunkBlocks>(state);
+}
+
+BENCHMARK(BM_LinearChunkBlocksNeighbourProbes);
+
+static void BM_MortonChunkBlocksNeighbourProbes(benchmark::State& state)
+{
+    probeNeighbours<MortonChunkBlocks>(state);
+}
+
+BENCHMARK(BM_MortonChunkBlocksNeighbourProbes);
+
+static void BM_LinearChunkBlocksOctreeBuild(benchmark::State& state)
+{
+    buildOctree<LinearChunkBlocks>(state);
+}
+
+BENCHMARK(BM_LinearChunkBlocksOctreeBuild);
+
+static void BM_MortonChunkBlocksOctreeBuild(benchmark::State& state)
+{
+    buildOctree<MortonChunkBlocks>(state);
+}
+
+BENCHMARK(BM_MortonChunkBlocksOctreeBuild);
+
+}// namespace Voxino
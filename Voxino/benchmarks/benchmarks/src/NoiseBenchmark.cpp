@@ -0,0 +1,78 @@
+#include "Utils/BatchedOpenSimplex2Noise.h"
+#include "World/Chunks/ChunkBlocks.h"
+
+#include <benchmark/benchmark.h>
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SEED = 1337;
+constexpr auto FREQUENCY = 0.01f;
+constexpr auto COLUMNS_PER_CHUNK =
+    ChunkBlocks::BLOCKS_PER_X_DIMENSION * ChunkBlocks::BLOCKS_PER_Z_DIMENSION;
+
+void setColumnsPerSecond(benchmark::State& state)
+{
+    state.counters["columns"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * COLUMNS_PER_CHUNK), benchmark::Counter::kIsRate);
+}
+}// namespace
+
+static void BM_HeightmapNoiseFastNoiseLite(benchmark::State& state)
+{
+    FastNoiseLite noise(SEED);
+    noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+    noise.SetFrequency(FREQUENCY);
+    noise.SetSeed(SEED);
+
+    std::array<float, COLUMNS_PER_CHUNK> heightmapNoise{};
+    auto chunkX = 0;
+    for (auto _: state)
+    {
+        for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
+        {
+            for (auto x = 0; x < ChunkBlocks::BLOCKS_PER_X_DIMENSION; ++x)
+            {
+                heightmapNoise[z * ChunkBlocks::BLOCKS_PER_X_DIMENSION + x] =
+                    noise.GetNoise(static_cast<float>(chunkX + x), static_cast<float>(z));
+            }
+        }
+        benchmark::DoNotOptimize(heightmapNoise);
+        chunkX += ChunkBlocks::BLOCKS_PER_X_DIMENSION;
+    }
+    setColumnsPerSecond(state);
+}
+
+BENCHMARK(BM_HeightmapNoiseFastNoiseLite);
+
+static void BM_HeightmapNoiseBatched(benchmark::State& state)
+{
+    const auto instructionSet = static_cast<BatchedOpenSimplex2Noise::InstructionSet>(state.range(0));
+    if (not BatchedOpenSimplex2Noise::isSupported(instructionSet))
+    {
+        state.SkipWithError("Instruction set is not supported by this processor");
+        return;
+    }
+
+    const auto noise = BatchedOpenSimplex2Noise(SEED, FREQUENCY);
+    std::array<float, COLUMNS_PER_CHUNK> heightmapNoise{};
+    auto chunkX = 0;
+    for (auto _: state)
+    {
+        noise.fillGrid(heightmapNoise, chunkX, 0, ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                       ChunkBlocks::BLOCKS_PER_Z_DIMENSION, instructionSet);
+        benchmark::DoNotOptimize(heightmapNoise);
+        chunkX += ChunkBlocks::BLOCKS_PER_X_DIMENSION;
+    }
+    setColumnsPerSecond(state);
+}
+
+BENCHMARK(BM_HeightmapNoiseBatched)
+    ->ArgName("InstructionSet")
+    ->Arg(static_cast<int>(BatchedOpenSimplex2Noise::InstructionSet::Scalar))
+    ->Arg(static_cast<int>(BatchedOpenSimplex2Noise::InstructionSet::Sse41))
+    ->Arg(static_cast<int>(BatchedOpenSimplex2Noise::InstructionSet::Avx2));
+
+}// namespace Voxino
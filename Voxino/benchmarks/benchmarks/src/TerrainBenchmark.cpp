@@ -0,0 +1,44 @@
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/SimpleTerrainGenerator.h"
+
+#include <benchmark/benchmark.h>
+
+namespace Voxino
+{
+
+static void BM_TerrainGenerationVoxelByVoxel(benchmark::State& state)
+{
+    auto terrainGenerator = SimpleTerrainGenerator();
+    auto chunkBlocks = ChunkBlocks();
+    auto chunkX = 0;
+    for (auto _: state)
+    {
+        auto chunkPosition =
+            Block::Coordinate{chunkX, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
+        terrainGenerator.generateTerrainVoxelByVoxel(chunkPosition, chunkBlocks);
+        benchmark::DoNotOptimize(chunkBlocks);
+        chunkX += ChunkBlocks::BLOCKS_PER_X_DIMENSION;
+    }
+}
+
+BENCHMARK(BM_TerrainGenerationVoxelByVoxel);
+
+static void BM_TerrainGenerationHeightmap(benchmark::State& state)
+{
+    auto terrainGenerator = SimpleTerrainGenerator();
+    auto chunkBlocks = ChunkBlocks();
+    auto chunkX = 0;
+    for (auto _: state)
+    {
+        // Every iteration moves to a new chunk column, so the heightmap is never cached
+        auto chunkPosition =
+            Block::Coordinate{chunkX, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
+        terrainGenerator.generateTerrain(chunkPosition, chunkBlocks);
+        benchmark::DoNotOptimize(chunkBlocks);
+        chunkX += ChunkBlocks::BLOCKS_PER_X_DIMENSION;
+    }
+}
+
+BENCHMARK(BM_TerrainGenerationHeightmap);
+
+}// namespace Voxino
@@ -0,0 +1,63 @@
+#version 330 core
+
+// One face packed by ChunkFaceRecordMesh, the same for all vertices of the instance:
+// position: x in bits 0-5, y in bits 6-11, z in bits 12-17, face in bits 18-20
+// texture: texture id in bits 0-15, width - 1 in bits 16-21, height - 1 in bits 22-27
+layout(location = 0) in uint packedPosition;
+layout(location = 1) in uint packedTexture;
+
+out vec2 v_TexCoord;
+out float TexIndex;
+
+uniform mat4 model = mat4(1.0);
+uniform mat4 view = mat4(1.0);
+uniform mat4 projection = mat4(1.0);
+
+const uint COORDINATE_MASK = 0x3Fu;
+
+// Two triangles of the quad, built from its four corners
+const int CORNER_OF_VERTEX[6] = int[6](0, 1, 2, 2, 3, 0);
+
+// Corners of every face, in the order of Block::Face, the same as in ChunkMeshBuilder
+const vec3 FACE_CORNERS[24] = vec3[24](
+    // Bottom
+    vec3(0, 0, 0), vec3(1, 0, 0), vec3(1, 0, 1), vec3(0, 0, 1),
+    // Top
+    vec3(0, 1, 1), vec3(1, 1, 1), vec3(1, 1, 0), vec3(0, 1, 0),
+    // Left
+    vec3(0, 0, 0), vec3(0, 0, 1), vec3(0, 1, 1), vec3(0, 1, 0),
+    // Right
+    vec3(1, 0, 1), vec3(1, 0, 0), vec3(1, 1, 0), vec3(1, 1, 1),
+    // Front
+    vec3(0, 0, 1), vec3(1, 0, 1), vec3(1, 1, 1), vec3(0, 1, 1),
+    // Back
+    vec3(1, 0, 0), vec3(0, 0, 0), vec3(0, 1, 0), vec3(1, 1, 0)
+);
+
+const vec2 CORNER_TEXTURE_COORDINATES[4] = vec2[4](vec2(1, 1), vec2(0, 1), vec2(0, 0), vec2(1, 0));
+
+// Stretches the corner of a merged quad over width x height blocks
+vec3 quadScale(uint face, vec2 size)
+{
+    if (face <= 1u) return vec3(size.x, 1.0, size.y);// Bottom, Top
+    if (face <= 3u) return vec3(1.0, size.y, size.x);// Left, Right
+    return vec3(size.x, size.y, 1.0);                // Front, Back
+}
+
+void main()
+{
+    vec3 blockPosition = vec3(packedPosition & COORDINATE_MASK,
+                              (packedPosition >> 6u) & COORDINATE_MASK,
+                              (packedPosition >> 12u) & COORDINATE_MASK);
+    uint face = (packedPosition >> 18u) & 0x7u;
+    vec2 size = vec2(((packedTexture >> 16u) & COORDINATE_MASK) + 1u,
+                     ((packedTexture >> 22u) & COORDINATE_MASK) + 1u);
+
+    int corner = CORNER_OF_VERTEX[gl_VertexID];
+    vec3 position = blockPosition + FACE_CORNERS[int(face) * 4 + corner] * quadScale(face, size);
+
+    mat4 mvp = projection * view * model;
+    gl_Position = mvp * vec4(position, 1.0);
+    v_TexCoord = CORNER_TEXTURE_COORDINATES[corner] * size;
+    TexIndex = float(packedTexture & 0xFFFFu);
+}
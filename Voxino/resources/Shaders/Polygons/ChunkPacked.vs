@@ -0,0 +1,28 @@
+#version 330 core
+
+// Vertex packed by ChunkArrayPackedMesh:
+// position: x in bits 0-6, y in bits 7-13, z in bits 14-20, face in bits 21-23
+// texture: u in bits 0-6, v in bits 7-13, texture id in bits 14-31
+layout(location = 0) in uint packedPosition;
+layout(location = 1) in uint packedTexture;
+
+out vec2 v_TexCoord;
+out float TexIndex;
+
+uniform mat4 model = mat4(1.0);
+uniform mat4 view = mat4(1.0);
+uniform mat4 projection = mat4(1.0);
+
+const uint COORDINATE_MASK = 0x7Fu;
+
+void main()
+{
+    vec3 position = vec3(packedPosition & COORDINATE_MASK,
+                         (packedPosition >> 7u) & COORDINATE_MASK,
+                         (packedPosition >> 14u) & COORDINATE_MASK);
+
+    mat4 mvp = projection * view * model;
+    gl_Position = mvp * vec4(position, 1.0);
+    v_TexCoord = vec2(packedTexture & COORDINATE_MASK, (packedTexture >> 7u) & COORDINATE_MASK);
+    TexIndex = float(packedTexture >> 14u);
+}
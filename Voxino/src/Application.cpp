@@ -13,6 +13,7 @@
 #include "Utils/Mouse.h"
 #include "World/Polygons/Chunks/Types/ChunkBinaryGreedyMeshing.h"
 #include "World/Polygons/Chunks/Types/ChunkCullingGpu.h"
+#include "World/Polygons/Chunks/Types/ChunkCullingInstanced.h"
 #include "World/Polygons/Chunks/Types/ChunkGreedyMeshing.h"
 #include "World/Polygons/Chunks/Types/ChunkNaive.h"
 
@@ -75,25 +76,29 @@ void Application::setupFlowStates()
 {
     mAppStack.saveState<ExitApplicationState>(State_ID::ExitApplicationState);
     mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkCulling>>(
-        State_ID::PolygonSingleChunkCullingState, *mGameWindow);
+        State_ID::PolygonSingleChunkCullingState, *mGameWindow, "ChunkPacked");
     mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkNaive>>(
         State_ID::PolygonSingleChunkNaiveState, *mGameWindow);
     mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkGreedyMeshing>>(
-        State_ID::PolygonSingleChunkGreedyState, *mGameWindow);
+        State_ID::PolygonSingleChunkGreedyState, *mGameWindow, "ChunkPacked");
     mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkBinaryGreedyMeshing>>(
-        State_ID::PolygonSingleChunkBinaryGreedyState, *mGameWindow);
+        State_ID::PolygonSingleChunkBinaryGreedyState, *mGameWindow, "ChunkPacked");
     mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkCullingGpu>>(
         State_ID::PolygonSingleChunkCullingGpuState, *mGameWindow, "ChunkCullingGpu");
+    mAppStack.saveState<PolygonSingleChunkState<Polygons::ChunkCullingInstanced>>(
+        State_ID::PolygonSingleChunkCullingInstancedState, *mGameWindow, "ChunkCullingInstanced");
     mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkCulling>>(
-        State_ID::PolygonMultiChunkCullingState, *mGameWindow);
+        State_ID::PolygonMultiChunkCullingState, *mGameWindow, "ChunkPackedBatched");
     mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkNaive>>(
         State_ID::PolygonMultiChunkNaiveState, *mGameWindow);
     mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkGreedyMeshing>>(
-        State_ID::PolygonMultiChunkGreedyState, *mGameWindow);
+        State_ID::PolygonMultiChunkGreedyState, *mGameWindow, "ChunkPackedBatched");
     mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkBinaryGreedyMeshing>>(
-        State_ID::PolygonMultiChunkBinaryGreedyState, *mGameWindow);
+        State_ID::PolygonMultiChunkBinaryGreedyState, *mGameWindow, "ChunkPackedBatched");
     mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkCullingGpu>>(
         State_ID::PolygonMultiChunkCullingGpuState, *mGameWindow, "ChunkCullingGpu");
+    mAppStack.saveState<PolygonMultiChunkState<Polygons::ChunkCullingInstanced>>(
+        State_ID::PolygonMultiChunkCullingInstancedState, *mGameWindow, "ChunkCullingInstanced");
 
     mAppStack.saveState<RaycastSingleChunkTexturedVoxels>(
         State_ID::RaycastSingleChunkTexturedVoxels, *mGameWindow);
@@ -147,12 +152,14 @@ Application::Application()
     // mAppStack.push(State_ID::PolygonSingleChunkNaiveState);
     // mAppStack.push(State_ID::PolygonSingleChunkCullingState);
     // mAppStack.push(State_ID::PolygonSingleChunkCullingGpuState);
+    // mAppStack.push(State_ID::PolygonSingleChunkCullingInstancedState);
     // mAppStack.push(State_ID::PolygonSingleChunkGreedyState);
     // mAppStack.push(State_ID::PolygonSingleChunkBinaryGreedyState);
 
     // mAppStack.push(State_ID::PolygonMultiChunkNaiveState);
     // mAppStack.push(State_ID::PolygonMultiChunkCullingState);
     // mAppStack.push(State_ID::PolygonMultiChunkCullingGpuState);
+    // mAppStack.push(State_ID::PolygonMultiChunkCullingInstancedState);
     // mAppStack.push(State_ID::PolygonMultiChunkGreedyState);
     // mAppStack.push(State_ID::PolygonMultiChunkBinaryGreedyState);
     // mAppStack.push(State_ID::RaycastSingleChunkTexturedVoxels);
@@ -377,11 +384,13 @@ void Application::updateImGuiSelectScene()
     scene("Single Chunk Greedy", State_ID::PolygonSingleChunkGreedyState);
     scene("Single Chunk Binary Greedy", State_ID::PolygonSingleChunkBinaryGreedyState);
     scene("Single Chunk Culling GPU", State_ID::PolygonSingleChunkCullingGpuState);
+    scene("Single Chunk Culling Instanced", State_ID::PolygonSingleChunkCullingInstancedState);
     scene("Multi Chunk Culling", State_ID::PolygonMultiChunkCullingState);
     scene("Multi Chunk Naive", State_ID::PolygonMultiChunkNaiveState);
     scene("Multi Chunk Greedy", State_ID::PolygonMultiChunkGreedyState);
     scene("Multi Chunk Binary Greedy", State_ID::PolygonMultiChunkBinaryGreedyState);
     scene("Multi Chunk Culling GPU", State_ID::PolygonMultiChunkCullingGpuState);
+    scene("Multi Chunk Culling Instanced", State_ID::PolygonMultiChunkCullingInstancedState);
 
     splitLineText("Raycast");
     scene("Single Chunk Textured", State_ID::RaycastSingleChunkTexturedVoxels);
@@ -1,6 +1,8 @@
 #include "Renderer/Core/Buffers/Buffer.h"
 #include "pch.h"
 
+#include <utility>
+
 namespace Voxino
 {
 Buffer::Buffer(Buffer&& rhs) noexcept
@@ -11,8 +13,8 @@ Buffer::Buffer(Buffer&& rhs) noexcept
 
 Buffer& Buffer::operator=(Buffer&& rhs) noexcept
 {
-    mBufferId = rhs.mBufferId;
-    rhs.mBufferId = 0;
+    // The previous object is handed over to rhs, so its destructor deletes it
+    std::swap(mBufferId, rhs.mBufferId);
     return *this;
 }
 }// namespace Voxino
\ No newline at end of file
@@ -36,7 +36,7 @@ public:
 
     /**
      * Adds information that the layout consists of the given number of elements of type unsigned
-     * int.
+     * int. They are passed to the shader as integers (uint), not converted to floats.
      * @param count Number of elements of a unsigned int type per row.
      */
     template<>
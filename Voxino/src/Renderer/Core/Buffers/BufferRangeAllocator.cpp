@@ -0,0 +1,138 @@
+#include "BufferRangeAllocator.h"
+
+#include <cassert>
+
+namespace Voxino
+{
+
+float BufferRangeAllocator::Statistics::utilisation() const
+{
+    return capacity == 0 ? 0.0f : static_cast<float>(usedSize) / static_cast<float>(capacity);
+}
+
+float BufferRangeAllocator::Statistics::fragmentation() const
+{
+    return freeSize == 0 ? 0.0f
+                         : 1.0f - static_cast<float>(largestFreeRange) / static_cast<float>(freeSize);
+}
+
+BufferRangeAllocator::BufferRangeAllocator(Size capacity)
+{
+    grow(capacity);
+}
+
+std::optional<BufferRangeAllocator::Offset> BufferRangeAllocator::allocate(Size size)
+{
+    assert(size > 0);
+    const auto bestFit = mFreeRangesBySize.lower_bound({size, Offset{0}});
+    if (bestFit == mFreeRangesBySize.end())
+    {
+        return std::nullopt;
+    }
+    return allocateFrom(mFreeRangesByOffset.find(bestFit->second), size);
+}
+
+std::optional<BufferRangeAllocator::Offset> BufferRangeAllocator::allocateBefore(Size size,
+                                                                                Offset end)
+{
+    assert(size > 0);
+    auto bestFit = mFreeRangesByOffset.end();
+    for (auto freeRange = mFreeRangesByOffset.begin();
+         freeRange != mFreeRangesByOffset.end() && freeRange->first + size <= end; ++freeRange)
+    {
+        if (freeRange->second >= size &&
+            (bestFit == mFreeRangesByOffset.end() || freeRange->second < bestFit->second))
+        {
+            bestFit = freeRange;
+        }
+    }
+    if (bestFit == mFreeRangesByOffset.end())
+    {
+        return std::nullopt;
+    }
+    return allocateFrom(bestFit, size);
+}
+
+void BufferRangeAllocator::free(Offset offset, Size size)
+{
+    assert(size > 0 && offset + size <= mCapacity);
+    mUsedSize -= size;
+
+    auto next = mFreeRangesByOffset.lower_bound(offset);
+    if (next != mFreeRangesByOffset.end() && offset + size == next->first)
+    {
+        size += next->second;
+        eraseFreeRange(next);
+    }
+    if (auto previous = mFreeRangesByOffset.lower_bound(offset);
+        previous != mFreeRangesByOffset.begin())
+    {
+        --previous;
+        if (previous->first + previous->second == offset)
+        {
+            offset = previous->first;
+            size += previous->second;
+            eraseFreeRange(previous);
+        }
+    }
+    insertFreeRange(offset, size);
+}
+
+void BufferRangeAllocator::grow(Size capacity)
+{
+    assert(capacity >= mCapacity);
+    if (capacity == mCapacity)
+    {
+        return;
+    }
+    const auto addedSize = capacity - mCapacity;
+    const auto addedOffset = mCapacity;
+    mCapacity = capacity;
+    // Freeing the new elements merges them with the free range at the end of the buffer
+    mUsedSize += addedSize;
+    free(addedOffset, addedSize);
+}
+
+BufferRangeAllocator::Size BufferRangeAllocator::capacity() const
+{
+    return mCapacity;
+}
+
+BufferRangeAllocator::Statistics BufferRangeAllocator::statistics() const
+{
+    auto statistics = Statistics{};
+    statistics.capacity = mCapacity;
+    statistics.usedSize = mUsedSize;
+    statistics.freeSize = mCapacity - mUsedSize;
+    statistics.largestFreeRange =
+        mFreeRangesBySize.empty() ? 0 : mFreeRangesBySize.rbegin()->first;
+    statistics.numberOfFreeRanges = static_cast<unsigned int>(mFreeRangesByOffset.size());
+    return statistics;
+}
+
+void BufferRangeAllocator::insertFreeRange(Offset offset, Size size)
+{
+    mFreeRangesByOffset.emplace(offset, size);
+    mFreeRangesBySize.emplace(size, offset);
+}
+
+void BufferRangeAllocator::eraseFreeRange(std::map<Offset, Size>::iterator freeRange)
+{
+    mFreeRangesBySize.erase({freeRange->second, freeRange->first});
+    mFreeRangesByOffset.erase(freeRange);
+}
+
+BufferRangeAllocator::Offset BufferRangeAllocator::allocateFrom(
+    std::map<Offset, Size>::iterator freeRange, Size size)
+{
+    const auto [offset, freeSize] = *freeRange;
+    eraseFreeRange(freeRange);
+    if (freeSize > size)
+    {
+        insertFreeRange(offset + size, freeSize - size);
+    }
+    mUsedSize += size;
+    return offset;
+}
+
+}// namespace Voxino
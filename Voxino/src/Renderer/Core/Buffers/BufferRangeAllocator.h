@@ -0,0 +1,115 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <set>
+#include <utility>
+
+namespace Voxino
+{
+/**
+ * Hands out ranges of a large GPU buffer, e.g. to the meshes of chunks sharing one vertex buffer.
+ * It is plain bookkeeping without any OpenGL calls, so the owner of the buffer decides when to
+ * grow it and copies the data itself.
+ *
+ * Free ranges are kept in a free list. A request takes the smallest free range that fits it, and a
+ * freed range is merged with its free neighbours, so the buffer does not split into ever smaller
+ * pieces. All offsets and sizes are in elements, not bytes.
+ */
+class BufferRangeAllocator
+{
+public:
+    using Offset = unsigned int;
+    using Size = unsigned int;
+
+    /** Usage of the buffer at a given moment. */
+    struct Statistics
+    {
+        Size capacity{0};
+        Size usedSize{0};
+        Size freeSize{0};
+        Size largestFreeRange{0};
+        unsigned int numberOfFreeRanges{0};
+
+        /**
+         * Returns the part of the buffer that is allocated.
+         * @return Value from 0 (empty) to 1 (full)
+         */
+        [[nodiscard]] float utilisation() const;
+
+        /**
+         * Returns the part of the free space that lies outside of the largest free range, so it can
+         * only be used by requests smaller than the largest one.
+         * @return Value from 0 (all free space in one piece) to almost 1
+         */
+        [[nodiscard]] float fragmentation() const;
+    };
+
+    /**
+     * @param capacity Number of elements of the buffer
+     */
+    explicit BufferRangeAllocator(Size capacity = 0);
+
+    /**
+     * Allocates a range of the given size in the smallest free range that fits it.
+     * @param size Number of elements to allocate. Must be greater than zero.
+     * @return Offset of the allocated range or nothing if no free range is large enough
+     */
+    [[nodiscard]] std::optional<Offset> allocate(Size size);
+
+    /**
+     * Allocates a range of the given size that lies entirely before the given offset.
+     * @param size Number of elements to allocate. Must be greater than zero.
+     * @param end Offset before which the range has to end
+     * @return Offset of the allocated range or nothing if no such free range exists
+     */
+    [[nodiscard]] std::optional<Offset> allocateBefore(Size size, Offset end);
+
+    /**
+     * Returns the range to the free list.
+     * @param offset Offset returned by allocate()
+     * @param size Size passed to allocate()
+     */
+    void free(Offset offset, Size size);
+
+    /**
+     * Enlarges the buffer. The new elements are free.
+     * @param capacity New number of elements of the buffer, not smaller than the current one
+     */
+    void grow(Size capacity);
+
+    /**
+     * Returns the number of elements of the buffer.
+     * @return Capacity of the buffer
+     */
+    [[nodiscard]] Size capacity() const;
+
+    /**
+     * Returns the current usage of the buffer.
+     * @return Statistics of the buffer
+     */
+    [[nodiscard]] Statistics statistics() const;
+
+private:
+    /**
+     * Adds the range to the free list, without merging it with its neighbours.
+     */
+    void insertFreeRange(Offset offset, Size size);
+
+    /**
+     * Removes the range from the free list.
+     */
+    void eraseFreeRange(std::map<Offset, Size>::iterator freeRange);
+
+    /**
+     * Allocates size elements at the start of the given free range.
+     */
+    Offset allocateFrom(std::map<Offset, Size>::iterator freeRange, Size size);
+
+private:
+    Size mCapacity{0};
+    Size mUsedSize{0};
+    std::map<Offset, Size> mFreeRangesByOffset;
+    std::set<std::pair<Size, Offset>> mFreeRangesBySize;
+};
+}// namespace Voxino
@@ -0,0 +1,77 @@
+#include "QuadIndexBuffer.h"
+#include "pch.h"
+
+#include "Renderer/Core/OpenglUtils.h"
+
+#include <algorithm>
+
+namespace Voxino
+{
+QuadIndexBuffer::QuadIndexBuffer()
+{
+    GLCall(glGenBuffers(1, &mBufferId));
+}
+
+QuadIndexBuffer::~QuadIndexBuffer()
+{
+    GLCall(glDeleteBuffers(1, &mBufferId));
+}
+
+void QuadIndexBuffer::bind() const
+{
+    GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBufferId));
+}
+
+void QuadIndexBuffer::unbind() const
+{
+    GLCall(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+}
+
+void QuadIndexBuffer::reserve(unsigned int numberOfQuads)
+{
+    if (numberOfQuads <= mCapacity)
+    {
+        return;
+    }
+
+    MEASURE_SCOPE;
+    mCapacity = std::max(numberOfQuads, mCapacity * 2);
+    if (mCapacity > MAX_QUADS_WITH_SHORT_INDICES && numberOfQuads <= MAX_QUADS_WITH_SHORT_INDICES)
+    {
+        // Do not switch to 32-bit indices just because of the doubling
+        mCapacity = MAX_QUADS_WITH_SHORT_INDICES;
+    }
+
+    // The buffer keeps its id, so vertex arrays that already use it stay valid
+    bind();
+    if (indexType() == GL_UNSIGNED_SHORT)
+    {
+        const auto indices = quadIndices<GLushort>(mCapacity);
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort),
+                            indices.data(), GL_STATIC_DRAW));
+    }
+    else
+    {
+        const auto indices = quadIndices<GLuint>(mCapacity);
+        GLCall(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+                            indices.data(), GL_STATIC_DRAW));
+    }
+}
+
+unsigned QuadIndexBuffer::capacity() const
+{
+    return mCapacity;
+}
+
+unsigned QuadIndexBuffer::indexType() const
+{
+    return mCapacity <= MAX_QUADS_WITH_SHORT_INDICES ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+QuadIndexBuffer& QuadIndexBuffer::instance()
+{
+    // Never destroyed, as the OpenGL context might be gone by the time static objects are
+    static auto* quadIndexBuffer = new QuadIndexBuffer();
+    return *quadIndexBuffer;
+}
+}// namespace Voxino
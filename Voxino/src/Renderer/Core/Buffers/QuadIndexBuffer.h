@@ -0,0 +1,104 @@
+#pragma once
+#include "Renderer/Core/Buffers/Buffer.h"
+
+#include <vector>
+
+namespace Voxino
+{
+/**
+ * Index buffer shared by all meshes made only of quads, each quad being four consecutive vertices
+ * drawn as two triangles. The indices follow the same pattern for every mesh, so instead of storing
+ * and uploading them with each mesh, a single buffer is bound by all of them and grows when a
+ * larger mesh appears.
+ *
+ * Indices are 16-bit as long as all quads fit into them, and 32-bit afterwards.
+ */
+class QuadIndexBuffer : public Buffer
+{
+public:
+    static constexpr unsigned int VERTICES_PER_QUAD = 4;
+    static constexpr unsigned int INDICES_PER_QUAD = 6;
+    static constexpr unsigned int MAX_QUADS_WITH_SHORT_INDICES = (1u << 16) / VERTICES_PER_QUAD;
+
+    QuadIndexBuffer();
+
+    QuadIndexBuffer(const QuadIndexBuffer&) = delete;
+    QuadIndexBuffer(QuadIndexBuffer&&) noexcept = default;
+
+    QuadIndexBuffer& operator=(const QuadIndexBuffer&) = delete;
+    QuadIndexBuffer& operator=(QuadIndexBuffer&&) noexcept = default;
+
+    ~QuadIndexBuffer() override;
+
+    /**
+     * Binds a buffer object to the specific (GL_ELEMENT_ARRAY_BUFFER) buffer binding point
+     */
+    void bind() const override;
+
+    /**
+     * Unbinds a buffer object (GL_ELEMENT_ARRAY_BUFFER)
+     */
+    void unbind() const override;
+
+    /**
+     * Makes sure that the buffer has indices for at least the given number of quads. The capacity
+     * is at least doubled, so the buffer is rarely uploaded again.
+     * @param numberOfQuads Number of quads of the mesh that is going to use the buffer
+     */
+    void reserve(unsigned int numberOfQuads);
+
+    /**
+     * Returns the number of quads for which the buffer has indices
+     * @return Number of quads
+     */
+    [[nodiscard]] unsigned int capacity() const;
+
+    /**
+     * Returns the OpenGL type of the indices stored in the buffer
+     * @return GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+     */
+    [[nodiscard]] unsigned int indexType() const;
+
+    /**
+     * Generates indices of the given number of quads
+     * @tparam T Type of the indices
+     * @param numberOfQuads Number of quads
+     * @return Indices of the quads
+     */
+    template<typename T>
+    [[nodiscard]] static std::vector<T> quadIndices(unsigned int numberOfQuads);
+
+    /**
+     * Returns the buffer shared by all meshes of the current OpenGL context
+     * @return Shared buffer, created on the first use
+     */
+    static QuadIndexBuffer& instance();
+
+private:
+    unsigned int mCapacity{0};
+};
+
+template<typename T>
+std::vector<T> QuadIndexBuffer::quadIndices(unsigned int numberOfQuads)
+{
+    std::vector<T> indices;
+    indices.reserve(numberOfQuads * INDICES_PER_QUAD);
+    for (auto quad = 0u; quad < numberOfQuads; ++quad)
+    {
+        const auto first = static_cast<T>(quad * VERTICES_PER_QUAD);
+        // clang-format off
+        indices.insert(indices.end(),
+                       {
+                        first,
+                        static_cast<T>(first + 1),
+                        static_cast<T>(first + 2),
+
+                        static_cast<T>(first + 2),
+                        static_cast<T>(first + 3),
+                        first
+                       });
+        // clang-format on
+    }
+    return indices;
+}
+}// namespace Voxino
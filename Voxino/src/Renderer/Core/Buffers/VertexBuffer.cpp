@@ -36,4 +36,21 @@ void VertexBuffer::setBuffer(const void* data, unsigned size)
     bind();
     GLCall(glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
 }
+
+void VertexBuffer::setBufferSubData(unsigned offset, const void* data, unsigned size)
+{
+    bind();
+    GLCall(glBufferSubData(GL_ARRAY_BUFFER, offset, size, data));
+}
+
+void VertexBuffer::copyFrom(const VertexBuffer& source, unsigned sourceOffset, unsigned offset,
+                            unsigned size)
+{
+    GLCall(glBindBuffer(GL_COPY_READ_BUFFER, source.mBufferId));
+    GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, mBufferId));
+    GLCall(glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, offset,
+                               size));
+    GLCall(glBindBuffer(GL_COPY_READ_BUFFER, 0));
+    GLCall(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
+}
 }// namespace Voxino
\ No newline at end of file
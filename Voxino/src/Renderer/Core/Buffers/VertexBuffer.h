@@ -50,6 +50,25 @@ public:
      */
     template<typename T>
     void setBuffer(const std::vector<T>& vector);
+
+    /**
+     * \brief Overwrites a part of the buffer object's data store, without reallocating it
+     * \param offset Offset in bytes at which the data is written
+     * \param data Pointer to the data that will be copied into the data store
+     * \param size Size in bytes of the data
+     */
+    void setBufferSubData(unsigned int offset, const void* data, unsigned int size);
+
+    /**
+     * \brief Copies a part of another buffer into this one on the GPU, e.g. when a larger buffer
+     * replaces a smaller one
+     * \param source Buffer from which the data is copied
+     * \param sourceOffset Offset in bytes in the source buffer
+     * \param offset Offset in bytes in this buffer
+     * \param size Size in bytes of the copied data
+     */
+    void copyFrom(const VertexBuffer& source, unsigned int sourceOffset, unsigned int offset,
+                  unsigned int size);
 };
 
 template<typename T>
@@ -42,9 +42,27 @@ void VertexArray::setBuffer(const VertexBuffer& vb, const BufferLayout& layout)
     {
         const auto& [type, count, normalized] = elements[i];
         GLCall(glEnableVertexAttribArray(i));
-        GLCall(glVertexAttribPointer(i, count, type, normalized, layout.stride(),
-                                     reinterpret_cast<const void*>(offset)));
+        if (type == GL_UNSIGNED_INT)
+        {
+            // Integers are read by the shader as they are, e.g. to unpack bits of packed vertices
+            GLCall(glVertexAttribIPointer(i, count, type, layout.stride(),
+                                          reinterpret_cast<const void*>(offset)));
+        }
+        else
+        {
+            GLCall(glVertexAttribPointer(i, count, type, normalized, layout.stride(),
+                                         reinterpret_cast<const void*>(offset)));
+        }
         offset += count * BufferElement::sizeOfGLType(type);
     }
 }
-}// namespace Voxino
\ No newline at end of file
+
+void VertexArray::setInstanceBuffer(const VertexBuffer& vb, const BufferLayout& layout)
+{
+    setBuffer(vb, layout);
+    for (unsigned int i = 0; i < layout.bufferElements().size(); ++i)
+    {
+        GLCall(glVertexAttribDivisor(i, 1));
+    }
+}
+}// namespace Voxino
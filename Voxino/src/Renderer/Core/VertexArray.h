@@ -43,5 +43,15 @@ public:
      * \param layout Layout corresponding to the contents of the vector.
      */
     void setBuffer(const VertexBuffer& vb, const BufferLayout& layout);
+
+    /**
+     * \brief Assigns VertexBuffer its BufferLayout like setBuffer(), but the attributes advance
+     * once per instance instead of once per vertex. Each element of the buffer then describes a
+     * whole instance drawn by Renderer::draw3DInstanced().
+     *
+     * \param vb VertexBuffer with one element per instance
+     * \param layout Layout corresponding to the contents of the vector.
+     */
+    void setInstanceBuffer(const VertexBuffer& vb, const BufferLayout& layout);
 };
 }// namespace Voxino
\ No newline at end of file
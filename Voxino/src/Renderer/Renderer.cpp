@@ -70,6 +70,69 @@ void Renderer::draw3D(const VertexArray& va, int numberOfVertices, const Shader&
 #endif
 }
 
+void Renderer::draw3D(const VertexArray& va, const QuadIndexBuffer& quads,
+                      unsigned int numberOfQuads, const Shader& shader, const Camera& camera,
+                      const DrawMode& drawMode)
+{
+    shader.bind();
+    va.bind();
+    quads.bind();
+
+    shader.setUniform("view", camera.view());
+    shader.setUniform("projection", camera.projection());
+    shader.setUniform("cameraPosition", camera.cameraPosition());
+    GLCall(glDrawElements(toOpenGl(drawMode), numberOfQuads * QuadIndexBuffer::INDICES_PER_QUAD,
+                          quads.indexType(), nullptr));
+
+#ifdef _DEBUG
+    shader.unbind();
+    va.unbind();
+    quads.unbind();
+#endif
+}
+
+void Renderer::draw3DMultiple(const VertexArray& va, const QuadIndexBuffer& quads,
+                              const std::vector<int>& numbersOfIndices,
+                              const std::vector<const void*>& indexOffsets,
+                              const std::vector<int>& baseVertices, const Shader& shader,
+                              const Camera& camera, const DrawMode& drawMode)
+{
+    shader.bind();
+    va.bind();
+    quads.bind();
+
+    shader.setUniform("view", camera.view());
+    shader.setUniform("projection", camera.projection());
+    shader.setUniform("cameraPosition", camera.cameraPosition());
+    GLCall(glMultiDrawElementsBaseVertex(toOpenGl(drawMode), numbersOfIndices.data(),
+                                         quads.indexType(), indexOffsets.data(),
+                                         static_cast<GLsizei>(numbersOfIndices.size()),
+                                         baseVertices.data()));
+
+#ifdef _DEBUG
+    shader.unbind();
+    va.unbind();
+    quads.unbind();
+#endif
+}
+
+void Renderer::draw3DInstanced(const VertexArray& va, int verticesPerInstance,
+                               int numberOfInstances, const Shader& shader, const Camera& camera,
+                               const DrawMode& drawMode)
+{
+    shader.bind();
+    va.bind();
+
+    shader.setUniform("view", camera.view());
+    shader.setUniform("projection", camera.projection());
+    shader.setUniform("cameraPosition", camera.cameraPosition());
+    GLCall(glDrawArraysInstanced(toOpenGl(drawMode), 0, verticesPerInstance, numberOfInstances));
+
+#ifdef _DEBUG
+    shader.unbind();
+    va.unbind();
+#endif
+}
 
 void Renderer::drawRaycast(const Shader& shader, const Camera& camera) const
 {
@@ -2,6 +2,7 @@
 
 #include "Core/Buffers/BufferLayout.h"
 #include "Renderer/Core/Buffers/IndexBuffer.h"
+#include "Renderer/Core/Buffers/QuadIndexBuffer.h"
 #include "Renderer/Core/Shader.h"
 #include "Renderer/Core/VertexArray.h"
 
@@ -62,6 +63,58 @@ public:
     static void draw3D(const VertexArray& vb, int numberOfVertices, const Shader& shader,
                        const Camera& camera, const DrawMode& drawMode = DrawMode::Triangles);
 
+    /**
+     * \brief Draws quads given in VertexArray to the screen using the shared QuadIndexBuffer and
+     * the interpretation given in Shader. In additon information about view, projection and
+     * position are passed to the shader from camera.
+     * \param va Vertex array containing four consecutive vertices of each quad.
+     * \param quads Index buffer with indices of at least the given number of quads.
+     * \param numberOfQuads Number of quads to draw.
+     * \param shader Shader program to use during rendering.
+     * \param camera Camera object for view and projection.
+     * \param drawMode Specifies the drawing mode (e.g., triangles, lines).
+     */
+    static void draw3D(const VertexArray& va, const QuadIndexBuffer& quads,
+                       unsigned int numberOfQuads, const Shader& shader, const Camera& camera,
+                       const DrawMode& drawMode = DrawMode::Triangles);
+
+    /**
+     * \brief Draws many meshes stored in a single vertex array with one call, each of them made
+     * only of quads indexed by the shared index buffer. Every mesh starts at its own base vertex,
+     * so the indices are the same for all of them. In additon information about view, projection
+     * and position are passed to the shader from camera.
+     * \param va Vertex array containing the vertices of all meshes.
+     * \param quads Index buffer shared by all meshes made of quads.
+     * \param numbersOfIndices Number of indices of every mesh.
+     * \param indexOffsets Offset in bytes of the first index of every mesh.
+     * \param baseVertices Index of the first vertex of every mesh.
+     * \param shader Shader program to use during rendering.
+     * \param camera Camera object for view and projection.
+     * \param drawMode Specifies the drawing mode (e.g., triangles, lines).
+     */
+    static void draw3DMultiple(const VertexArray& va, const QuadIndexBuffer& quads,
+                               const std::vector<int>& numbersOfIndices,
+                               const std::vector<const void*>& indexOffsets,
+                               const std::vector<int>& baseVertices, const Shader& shader,
+                               const Camera& camera,
+                               const DrawMode& drawMode = DrawMode::Triangles);
+
+    /**
+     * \brief Draws the given number of instances, each made of the same number of vertices.
+     * The vertex shader builds the vertices itself from gl_VertexID and the attributes of the
+     * instance, so no index buffer is needed. In additon information about view, projection and
+     * position are passed to the shader from camera.
+     * \param va Vertex array whose attributes advance once per instance.
+     * \param verticesPerInstance Number of vertices of a single instance.
+     * \param numberOfInstances Number of instances to draw.
+     * \param shader Shader program to use during rendering.
+     * \param camera Camera object for view and projection.
+     * \param drawMode Specifies the drawing mode (e.g., triangles, lines).
+     */
+    static void draw3DInstanced(const VertexArray& va, int verticesPerInstance,
+                                int numberOfInstances, const Shader& shader, const Camera& camera,
+                                const DrawMode& drawMode = DrawMode::Triangles);
+
 
     /**
      * @brief Draws the raycast using the provided shader and camera.
@@ -34,7 +34,7 @@ void TexturePackAtlas::bind(const Spritesheet& textures) const
     }
 }
 
-std::vector<glm::vec2> TexturePackAtlas::normalizedCoordinates(Block::TextureId textureId) const
+std::array<glm::vec2, 4> TexturePackAtlas::normalizedCoordinates(Block::TextureId textureId) const
 {
     const auto blocksPerRow = mBlocks.width() / mTextureSize;
     const auto sizeOfPixel = 1.0f / static_cast<float>(mBlocks.height());
@@ -48,12 +48,12 @@ std::vector<glm::vec2> TexturePackAtlas::normalizedCoordinates(Block::TextureId
 
     // clang-format off
     return
-    {
+    {{
         glm::vec2(right, top),
         glm::vec2(left, top),
         glm::vec2(left, bottom),
         glm::vec2(right, bottom)
-    };
+    }};
     // clang-format on
 }
 
@@ -31,7 +31,7 @@ public:
      * @param textureId
      * @return
      */
-    std::vector<glm::vec2> normalizedCoordinates(Block::TextureId textureId) const;
+    std::array<glm::vec2, 4> normalizedCoordinates(Block::TextureId textureId) const;
 
     /**
      * @brief Returns texture coordinates given in pixels
@@ -113,6 +113,7 @@ PolygonMultiChunkState<ChunkType>::PolygonMultiChunkState(StateStack& stack, Win
     spdlog::info("Number of chunks: {}", mChunkContainer.size());
     spdlog::info("Number of chunk vertices: {}", mChunkContainer.numberOfVertices());
     spdlog::info("Size in buffer: {} bytes", mChunkContainer.memorySize());
+    spdlog::info("Size of blocks: {} bytes", mChunkContainer.blocksMemorySize());
     FPSCounter::instance().enable();
 
     mPlayer.camera().setAutomatic(true);
@@ -183,6 +184,7 @@ bool PolygonMultiChunkState<ChunkType>::updateImGui(const float& deltaTime)
     {
         switchWireframe();
     }
+    mChunkContainer.updateImGui();
     ImGui::End();
     mPlayer.updateImGui();
     return true;
@@ -199,6 +201,8 @@ bool PolygonMultiChunkState<ChunkType>::update(const float& deltaTime)
         requestPush(State_ID::ExitApplicationState);
     }
     mPlayer.update(deltaTime);
+    mChunkContainer.updateLevelsOfDetail(mPlayer.camera().cameraPosition());
+    mChunkContainer.update(deltaTime);
     return true;
 }
 
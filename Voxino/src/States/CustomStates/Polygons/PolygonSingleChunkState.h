@@ -90,6 +90,7 @@ PolygonSingleChunkState<ChunkType>::PolygonSingleChunkState(StateStack& stack,
 {
     MEASURE_SCOPE;
     Mouse::lockMouseAtCenter(mWindow);
+    mChunk.updateMesh();
 
     auto radius = ChunkBlocks::BLOCKS_PER_DIMENSION + 2;
     auto center = glm::vec3(ChunkBlocks::BLOCKS_PER_X_DIMENSION / 2.f, 0,
@@ -108,6 +109,7 @@ PolygonSingleChunkState<ChunkType>::PolygonSingleChunkState(StateStack& stack,
 
     spdlog::info("Number of chunk vertices: {}", mChunk.numberOfVertices());
     spdlog::info("Size in buffer: {} bytes", mChunk.memorySize());
+    spdlog::info("Size of blocks: {} bytes", mChunk.blocksMemorySize());
     FPSCounter::instance().enable();
 
     mPlayer.camera().setAutomatic(true);
@@ -15,11 +15,13 @@ enum class State_ID
     PolygonSingleChunkGreedyState,
     PolygonSingleChunkBinaryGreedyState,
     PolygonSingleChunkCullingGpuState,
+    PolygonSingleChunkCullingInstancedState,
     PolygonMultiChunkCullingState,
     PolygonMultiChunkNaiveState,
     PolygonMultiChunkGreedyState,
     PolygonMultiChunkBinaryGreedyState,
     PolygonMultiChunkCullingGpuState,
+    PolygonMultiChunkCullingInstancedState,
     RaycastSingleChunkTexturedVoxels,
     RaycastSingleChunkTexturedVoxelsFixedStep,
     RaycastSingleChunkTexturedBrickmapGpu,
@@ -52,6 +54,8 @@ inline std::string toString(State_ID stateId)
         case State_ID::PolygonSingleChunkGreedyState: return "PolygonSingleChunkGreedyState";
         case State_ID::PolygonSingleChunkCullingGpuState:
             return "PolygonSingleChunkCullingGpuState";
+        case State_ID::PolygonSingleChunkCullingInstancedState:
+            return "PolygonSingleChunkCullingInstancedState";
         case State_ID::PolygonSingleChunkBinaryGreedyState:
             return "PolygonSingleChunkBinaryGreedyState";
         case State_ID::PolygonMultiChunkCullingState: return "PolygonMultiChunkCullingState";
@@ -60,6 +64,8 @@ inline std::string toString(State_ID stateId)
         case State_ID::PolygonMultiChunkBinaryGreedyState:
             return "PolygonMultiChunkBinaryGreedyState";
         case State_ID::PolygonMultiChunkCullingGpuState: return "PolygonMultiChunkCullingGpuState";
+        case State_ID::PolygonMultiChunkCullingInstancedState:
+            return "PolygonMultiChunkCullingInstancedState";
         case State_ID::RaycastSingleChunkTexturedVoxels: return "RaycastSingleChunkTexturedVoxels";
         case State_ID::RaycastMultiChunkTexturedVoxels: return "RaycastMultiChunkTexturedVoxels";
         case State_ID::RaycastSingleChunkTexturedBrickmapGpu:
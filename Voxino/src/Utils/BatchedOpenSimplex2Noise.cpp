@@ -0,0 +1,512 @@
+#include "BatchedOpenSimplex2Noise.h"
+#include "pch.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define VOXINO_NOISE_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define VOXINO_NOISE_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+    #define VOXINO_NOISE_TARGET(instructionSet)
+#endif
+
+namespace Voxino
+{
+
+namespace
+{
+// Constants and gradients of the 2D OpenSimplex2 noise, as used by FastNoiseLite
+constexpr float SQRT3 = 1.7320508075688772935274463415059f;
+constexpr float F2 = 0.5f * (SQRT3 - 1);
+constexpr float G2 = (3 - SQRT3) / 6;
+constexpr float FAR_CORNER_T = static_cast<float>(2 * (1 - 2 * G2) * (1 / G2 - 2));
+constexpr float FAR_CORNER_A = static_cast<float>(-2 * (1 - 2 * G2) * (1 - 2 * G2));
+constexpr float NORMALIZATION = 99.83685446303647f;
+constexpr std::uint32_t PRIME_X = 501125321;
+constexpr std::uint32_t PRIME_Z = 1136930381;
+constexpr std::uint32_t HASH_MULTIPLIER = 0x27d4eb2d;
+
+// clang-format off
+alignas(32) constexpr std::array<float, 256> GRADIENTS_2D = {
+     0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+     0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+     0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+     0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+     0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+     0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+    -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+    -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+    -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+    -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f,
+     0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+     0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+     0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+     0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+     0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+     0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+    -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+    -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+    -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+    -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f,
+     0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+     0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+     0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+     0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+     0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+     0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+    -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+    -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+    -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+    -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f,
+     0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+     0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+     0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+     0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+     0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+     0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+    -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+    -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+    -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+    -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f,
+     0.130526192220052f,  0.99144486137381f,   0.38268343236509f,   0.923879532511287f,
+     0.608761429008721f,  0.793353340291235f,  0.793353340291235f,  0.608761429008721f,
+     0.923879532511287f,  0.38268343236509f,   0.99144486137381f,   0.130526192220051f,
+     0.99144486137381f,  -0.130526192220051f,  0.923879532511287f, -0.38268343236509f,
+     0.793353340291235f, -0.60876142900872f,   0.608761429008721f, -0.793353340291235f,
+     0.38268343236509f,  -0.923879532511287f,  0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f,  -0.38268343236509f,  -0.923879532511287f,
+    -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f,  -0.99144486137381f,  -0.130526192220052f,
+    -0.99144486137381f,   0.130526192220051f, -0.923879532511287f,  0.38268343236509f,
+    -0.793353340291235f,  0.608761429008721f, -0.608761429008721f,  0.793353340291235f,
+    -0.38268343236509f,   0.923879532511287f, -0.130526192220052f,  0.99144486137381f,
+     0.38268343236509f,   0.923879532511287f,  0.923879532511287f,  0.38268343236509f,
+     0.923879532511287f, -0.38268343236509f,   0.38268343236509f,  -0.923879532511287f,
+    -0.38268343236509f,  -0.923879532511287f, -0.923879532511287f, -0.38268343236509f,
+    -0.923879532511287f,  0.38268343236509f,  -0.38268343236509f,   0.923879532511287f,
+};
+// clang-format on
+
+int fastFloor(float value)
+{
+    return value >= 0 ? static_cast<int>(value) : static_cast<int>(value) - 1;
+}
+
+float gradientCoordinate(int seed, std::uint32_t xPrimed, std::uint32_t zPrimed, float dx, float dz)
+{
+    auto hash = (static_cast<std::uint32_t>(seed) ^ xPrimed ^ zPrimed) * HASH_MULTIPLIER;
+    hash ^= static_cast<std::uint32_t>(static_cast<std::int32_t>(hash) >> 15);
+    hash &= 127 << 1;
+    return dx * GRADIENTS_2D[hash] + dz * GRADIENTS_2D[hash | 1];
+}
+
+/**
+ * Scalar OpenSimplex2 kernel. The SIMD kernels below follow it operation by operation.
+ */
+float singleOpenSimplex2(int seed, float x, float z, float frequency)
+{
+    x *= frequency;
+    z *= frequency;
+    const auto skew = (x + z) * F2;
+    x += skew;
+    z += skew;
+
+    const auto i = fastFloor(x);
+    const auto j = fastFloor(z);
+    const auto xi = x - static_cast<float>(i);
+    const auto zi = z - static_cast<float>(j);
+
+    const auto t = (xi + zi) * G2;
+    const auto x0 = xi - t;
+    const auto z0 = zi - t;
+
+    const auto iPrimed = static_cast<std::uint32_t>(i) * PRIME_X;
+    const auto jPrimed = static_cast<std::uint32_t>(j) * PRIME_Z;
+
+    float n0 = 0;
+    const auto a = 0.5f - x0 * x0 - z0 * z0;
+    if (a > 0)
+    {
+        n0 = (a * a) * (a * a) * gradientCoordinate(seed, iPrimed, jPrimed, x0, z0);
+    }
+
+    float n2 = 0;
+    const auto c = FAR_CORNER_T * t + (FAR_CORNER_A + a);
+    if (c > 0)
+    {
+        const auto x2 = x0 + (2 * G2 - 1);
+        const auto z2 = z0 + (2 * G2 - 1);
+        n2 = (c * c) * (c * c) *
+             gradientCoordinate(seed, iPrimed + PRIME_X, jPrimed + PRIME_Z, x2, z2);
+    }
+
+    float n1 = 0;
+    const auto isUpperTriangle = z0 > x0;
+    const auto x1 = x0 + (isUpperTriangle ? G2 : G2 - 1);
+    const auto z1 = z0 + (isUpperTriangle ? G2 - 1 : G2);
+    const auto b = 0.5f - x1 * x1 - z1 * z1;
+    if (b > 0)
+    {
+        n1 = (b * b) * (b * b) *
+             gradientCoordinate(seed, isUpperTriangle ? iPrimed : iPrimed + PRIME_X,
+                                isUpperTriangle ? jPrimed + PRIME_Z : jPrimed, x1, z1);
+    }
+
+    return (n0 + n1 + n2) * NORMALIZATION;
+}
+
+#ifdef VOXINO_NOISE_X86
+
+VOXINO_NOISE_TARGET("sse4.1")
+inline __m128 gradientCoordinateSse41(__m128i seed, __m128i xPrimed, __m128i zPrimed, __m128 dx,
+                                      __m128 dz)
+{
+    auto hash = _mm_xor_si128(_mm_xor_si128(seed, xPrimed), zPrimed);
+    hash = _mm_mullo_epi32(hash, _mm_set1_epi32(static_cast<int>(HASH_MULTIPLIER)));
+    hash = _mm_xor_si128(hash, _mm_srai_epi32(hash, 15));
+    hash = _mm_and_si128(hash, _mm_set1_epi32(127 << 1));
+
+    // SSE has no gather, so the gradients are looked up one by one
+    alignas(16) std::array<int, 4> indices;
+    _mm_store_si128(reinterpret_cast<__m128i*>(indices.data()), hash);
+    const auto gradientX =
+        _mm_setr_ps(GRADIENTS_2D[indices[0]], GRADIENTS_2D[indices[1]], GRADIENTS_2D[indices[2]],
+                    GRADIENTS_2D[indices[3]]);
+    const auto gradientZ =
+        _mm_setr_ps(GRADIENTS_2D[indices[0] | 1], GRADIENTS_2D[indices[1] | 1],
+                    GRADIENTS_2D[indices[2] | 1], GRADIENTS_2D[indices[3] | 1]);
+    return _mm_add_ps(_mm_mul_ps(dx, gradientX), _mm_mul_ps(dz, gradientZ));
+}
+
+VOXINO_NOISE_TARGET("sse4.1")
+inline __m128 attenuationSse41(__m128 value)
+{
+    const auto squared = _mm_mul_ps(value, value);
+    return _mm_mul_ps(squared, squared);
+}
+
+VOXINO_NOISE_TARGET("sse4.1")
+inline __m128 singleOpenSimplex2Sse41(int seed, __m128 x, __m128 z, float frequency)
+{
+    const auto zero = _mm_setzero_ps();
+    const auto half = _mm_set1_ps(0.5f);
+    const auto seeds = _mm_set1_epi32(seed);
+    const auto primeX = _mm_set1_epi32(static_cast<int>(PRIME_X));
+    const auto primeZ = _mm_set1_epi32(static_cast<int>(PRIME_Z));
+
+    x = _mm_mul_ps(x, _mm_set1_ps(frequency));
+    z = _mm_mul_ps(z, _mm_set1_ps(frequency));
+    const auto skew = _mm_mul_ps(_mm_add_ps(x, z), _mm_set1_ps(F2));
+    x = _mm_add_ps(x, skew);
+    z = _mm_add_ps(z, skew);
+
+    // Truncation minus one for negative values, just like fastFloor
+    auto i = _mm_cvttps_epi32(x);
+    auto j = _mm_cvttps_epi32(z);
+    i = _mm_add_epi32(i, _mm_castps_si128(_mm_cmplt_ps(x, zero)));
+    j = _mm_add_epi32(j, _mm_castps_si128(_mm_cmplt_ps(z, zero)));
+    const auto xi = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+    const auto zi = _mm_sub_ps(z, _mm_cvtepi32_ps(j));
+
+    const auto t = _mm_mul_ps(_mm_add_ps(xi, zi), _mm_set1_ps(G2));
+    const auto x0 = _mm_sub_ps(xi, t);
+    const auto z0 = _mm_sub_ps(zi, t);
+
+    const auto iPrimed = _mm_mullo_epi32(i, primeX);
+    const auto jPrimed = _mm_mullo_epi32(j, primeZ);
+
+    const auto a = _mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x0, x0)), _mm_mul_ps(z0, z0));
+    auto n0 = _mm_mul_ps(attenuationSse41(a),
+                         gradientCoordinateSse41(seeds, iPrimed, jPrimed, x0, z0));
+    n0 = _mm_and_ps(n0, _mm_cmpgt_ps(a, zero));
+
+    const auto c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FAR_CORNER_T), t),
+                              _mm_add_ps(_mm_set1_ps(FAR_CORNER_A), a));
+    const auto x2 = _mm_add_ps(x0, _mm_set1_ps(2 * G2 - 1));
+    const auto z2 = _mm_add_ps(z0, _mm_set1_ps(2 * G2 - 1));
+    auto n2 = _mm_mul_ps(attenuationSse41(c),
+                         gradientCoordinateSse41(seeds, _mm_add_epi32(iPrimed, primeX),
+                                                 _mm_add_epi32(jPrimed, primeZ), x2, z2));
+    n2 = _mm_and_ps(n2, _mm_cmpgt_ps(c, zero));
+
+    const auto isUpperTriangle = _mm_cmpgt_ps(z0, x0);
+    const auto isUpperTriangleInt = _mm_castps_si128(isUpperTriangle);
+    const auto x1 =
+        _mm_add_ps(x0, _mm_blendv_ps(_mm_set1_ps(G2 - 1), _mm_set1_ps(G2), isUpperTriangle));
+    const auto z1 =
+        _mm_add_ps(z0, _mm_blendv_ps(_mm_set1_ps(G2), _mm_set1_ps(G2 - 1), isUpperTriangle));
+    const auto b = _mm_sub_ps(_mm_sub_ps(half, _mm_mul_ps(x1, x1)), _mm_mul_ps(z1, z1));
+    const auto iPrimed1 = _mm_add_epi32(iPrimed, _mm_andnot_si128(isUpperTriangleInt, primeX));
+    const auto jPrimed1 = _mm_add_epi32(jPrimed, _mm_and_si128(isUpperTriangleInt, primeZ));
+    auto n1 = _mm_mul_ps(attenuationSse41(b),
+                         gradientCoordinateSse41(seeds, iPrimed1, jPrimed1, x1, z1));
+    n1 = _mm_and_ps(n1, _mm_cmpgt_ps(b, zero));
+
+    return _mm_mul_ps(_mm_add_ps(_mm_add_ps(n0, n1), n2), _mm_set1_ps(NORMALIZATION));
+}
+
+VOXINO_NOISE_TARGET("avx2")
+inline __m256 gradientCoordinateAvx2(__m256i seed, __m256i xPrimed, __m256i zPrimed, __m256 dx,
+                                     __m256 dz)
+{
+    auto hash = _mm256_xor_si256(_mm256_xor_si256(seed, xPrimed), zPrimed);
+    hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(static_cast<int>(HASH_MULTIPLIER)));
+    hash = _mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15));
+    hash = _mm256_and_si256(hash, _mm256_set1_epi32(127 << 1));
+
+    const auto gradientX = _mm256_i32gather_ps(GRADIENTS_2D.data(), hash, 4);
+    const auto gradientZ = _mm256_i32gather_ps(
+        GRADIENTS_2D.data(), _mm256_or_si256(hash, _mm256_set1_epi32(1)), 4);
+    return _mm256_add_ps(_mm256_mul_ps(dx, gradientX), _mm256_mul_ps(dz, gradientZ));
+}
+
+VOXINO_NOISE_TARGET("avx2")
+inline __m256 attenuationAvx2(__m256 value)
+{
+    const auto squared = _mm256_mul_ps(value, value);
+    return _mm256_mul_ps(squared, squared);
+}
+
+VOXINO_NOISE_TARGET("avx2")
+inline __m256 singleOpenSimplex2Avx2(int seed, __m256 x, __m256 z, float frequency)
+{
+    const auto zero = _mm256_setzero_ps();
+    const auto half = _mm256_set1_ps(0.5f);
+    const auto seeds = _mm256_set1_epi32(seed);
+    const auto primeX = _mm256_set1_epi32(static_cast<int>(PRIME_X));
+    const auto primeZ = _mm256_set1_epi32(static_cast<int>(PRIME_Z));
+
+    x = _mm256_mul_ps(x, _mm256_set1_ps(frequency));
+    z = _mm256_mul_ps(z, _mm256_set1_ps(frequency));
+    const auto skew = _mm256_mul_ps(_mm256_add_ps(x, z), _mm256_set1_ps(F2));
+    x = _mm256_add_ps(x, skew);
+    z = _mm256_add_ps(z, skew);
+
+    // Truncation minus one for negative values, just like fastFloor
+    auto i = _mm256_cvttps_epi32(x);
+    auto j = _mm256_cvttps_epi32(z);
+    i = _mm256_add_epi32(i, _mm256_castps_si256(_mm256_cmp_ps(x, zero, _CMP_LT_OQ)));
+    j = _mm256_add_epi32(j, _mm256_castps_si256(_mm256_cmp_ps(z, zero, _CMP_LT_OQ)));
+    const auto xi = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+    const auto zi = _mm256_sub_ps(z, _mm256_cvtepi32_ps(j));
+
+    const auto t = _mm256_mul_ps(_mm256_add_ps(xi, zi), _mm256_set1_ps(G2));
+    const auto x0 = _mm256_sub_ps(xi, t);
+    const auto z0 = _mm256_sub_ps(zi, t);
+
+    const auto iPrimed = _mm256_mullo_epi32(i, primeX);
+    const auto jPrimed = _mm256_mullo_epi32(j, primeZ);
+
+    const auto a =
+        _mm256_sub_ps(_mm256_sub_ps(half, _mm256_mul_ps(x0, x0)), _mm256_mul_ps(z0, z0));
+    auto n0 = _mm256_mul_ps(attenuationAvx2(a),
+                            gradientCoordinateAvx2(seeds, iPrimed, jPrimed, x0, z0));
+    n0 = _mm256_and_ps(n0, _mm256_cmp_ps(a, zero, _CMP_GT_OQ));
+
+    const auto c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FAR_CORNER_T), t),
+                                 _mm256_add_ps(_mm256_set1_ps(FAR_CORNER_A), a));
+    const auto x2 = _mm256_add_ps(x0, _mm256_set1_ps(2 * G2 - 1));
+    const auto z2 = _mm256_add_ps(z0, _mm256_set1_ps(2 * G2 - 1));
+    auto n2 = _mm256_mul_ps(attenuationAvx2(c),
+                            gradientCoordinateAvx2(seeds, _mm256_add_epi32(iPrimed, primeX),
+                                                   _mm256_add_epi32(jPrimed, primeZ), x2, z2));
+    n2 = _mm256_and_ps(n2, _mm256_cmp_ps(c, zero, _CMP_GT_OQ));
+
+    const auto isUpperTriangle = _mm256_cmp_ps(z0, x0, _CMP_GT_OQ);
+    const auto isUpperTriangleInt = _mm256_castps_si256(isUpperTriangle);
+    const auto x1 = _mm256_add_ps(
+        x0, _mm256_blendv_ps(_mm256_set1_ps(G2 - 1), _mm256_set1_ps(G2), isUpperTriangle));
+    const auto z1 = _mm256_add_ps(
+        z0, _mm256_blendv_ps(_mm256_set1_ps(G2), _mm256_set1_ps(G2 - 1), isUpperTriangle));
+    const auto b =
+        _mm256_sub_ps(_mm256_sub_ps(half, _mm256_mul_ps(x1, x1)), _mm256_mul_ps(z1, z1));
+    const auto iPrimed1 =
+        _mm256_add_epi32(iPrimed, _mm256_andnot_si256(isUpperTriangleInt, primeX));
+    const auto jPrimed1 = _mm256_add_epi32(jPrimed, _mm256_and_si256(isUpperTriangleInt, primeZ));
+    auto n1 = _mm256_mul_ps(attenuationAvx2(b),
+                            gradientCoordinateAvx2(seeds, iPrimed1, jPrimed1, x1, z1));
+    n1 = _mm256_and_ps(n1, _mm256_cmp_ps(b, zero, _CMP_GT_OQ));
+
+    return _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(n0, n1), n2),
+                         _mm256_set1_ps(NORMALIZATION));
+}
+
+bool processorSupports(BatchedOpenSimplex2Noise::InstructionSet instructionSet)
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    std::array<int, 4> registers{};
+    __cpuid(registers.data(), 0);
+    const auto highestFunction = registers[0];
+
+    __cpuid(registers.data(), 1);
+    const auto hasSse41 = (registers[2] & (1 << 19)) != 0;
+    if (instructionSet == BatchedOpenSimplex2Noise::InstructionSet::Sse41)
+    {
+        return hasSse41;
+    }
+
+    // AVX2 also needs the operating system to save the YMM registers
+    const auto hasOsXsave = (registers[2] & (1 << 27)) != 0;
+    if (highestFunction < 7 || not hasOsXsave || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(registers.data(), 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+    #else
+    if (instructionSet == BatchedOpenSimplex2Noise::InstructionSet::Sse41)
+    {
+        return __builtin_cpu_supports("sse4.1");
+    }
+    return __builtin_cpu_supports("avx2");
+    #endif
+}
+
+#endif
+}// namespace
+
+BatchedOpenSimplex2Noise::BatchedOpenSimplex2Noise(int seed, float frequency)
+    : mSeed(seed)
+    , mFrequency(frequency)
+{
+}
+
+void BatchedOpenSimplex2Noise::fillGrid(std::span<float> output, int startX, int startZ, int width,
+                                        int depth) const
+{
+    static const auto bestInstructionSet = bestSupportedInstructionSet();
+    fillGrid(output, startX, startZ, width, depth, bestInstructionSet);
+}
+
+void BatchedOpenSimplex2Noise::fillGrid(std::span<float> output, int startX, int startZ, int width,
+                                        int depth, InstructionSet instructionSet) const
+{
+    MEASURE_SCOPE;
+    if (width < 0 || depth < 0 || output.size() < static_cast<std::size_t>(width) * depth)
+    {
+        throw std::runtime_error("Output of the noise is too small for the given grid");
+    }
+    if (not isSupported(instructionSet))
+    {
+        throw std::runtime_error("Unsupported instruction set value was provided");
+    }
+
+    for (auto z = 0; z < depth; ++z)
+    {
+        auto* row = output.data() + static_cast<std::size_t>(z) * width;
+        auto filledColumns = 0;
+        switch (instructionSet)
+        {
+            case InstructionSet::Avx2:
+                filledColumns = fillRowAvx2(row, startX, startZ + z, width);
+                break;
+            case InstructionSet::Sse41:
+                filledColumns = fillRowSse41(row, startX, startZ + z, width);
+                break;
+            case InstructionSet::Scalar: break;
+        }
+        fillRowScalar(row + filledColumns, startX + filledColumns, startZ + z,
+                      width - filledColumns);
+    }
+}
+
+float BatchedOpenSimplex2Noise::noise(float x, float z) const
+{
+    return singleOpenSimplex2(mSeed, x, z, mFrequency);
+}
+
+bool BatchedOpenSimplex2Noise::isSupported(InstructionSet instructionSet)
+{
+    if (instructionSet == InstructionSet::Scalar)
+    {
+        return true;
+    }
+#ifdef VOXINO_NOISE_X86
+    return processorSupports(instructionSet);
+#else
+    return false;
+#endif
+}
+
+BatchedOpenSimplex2Noise::InstructionSet BatchedOpenSimplex2Noise::bestSupportedInstructionSet()
+{
+    for (const auto instructionSet: {InstructionSet::Avx2, InstructionSet::Sse41})
+    {
+        if (isSupported(instructionSet))
+        {
+            return instructionSet;
+        }
+    }
+    return InstructionSet::Scalar;
+}
+
+void BatchedOpenSimplex2Noise::fillRowScalar(float* output, int startX, int z, int width) const
+{
+    for (auto x = 0; x < width; ++x)
+    {
+        output[x] = noise(static_cast<float>(startX + x), static_cast<float>(z));
+    }
+}
+
+#ifdef VOXINO_NOISE_X86
+
+VOXINO_NOISE_TARGET("sse4.1")
+int BatchedOpenSimplex2Noise::fillRowSse41(float* output, int startX, int z, int width) const
+{
+    constexpr auto LANES = 4;
+    const auto rowZ = _mm_set1_ps(static_cast<float>(z));
+    const auto laneOffsets = _mm_setr_epi32(0, 1, 2, 3);
+    auto x = 0;
+    for (; x + LANES <= width; x += LANES)
+    {
+        const auto columnsX =
+            _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(startX + x), laneOffsets));
+        _mm_storeu_ps(output + x, singleOpenSimplex2Sse41(mSeed, columnsX, rowZ, mFrequency));
+    }
+    return x;
+}
+
+VOXINO_NOISE_TARGET("avx2")
+int BatchedOpenSimplex2Noise::fillRowAvx2(float* output, int startX, int z, int width) const
+{
+    constexpr auto LANES = 8;
+    const auto rowZ = _mm256_set1_ps(static_cast<float>(z));
+    const auto laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    auto x = 0;
+    for (; x + LANES <= width; x += LANES)
+    {
+        const auto columnsX =
+            _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(startX + x), laneOffsets));
+        _mm256_storeu_ps(output + x, singleOpenSimplex2Avx2(mSeed, columnsX, rowZ, mFrequency));
+    }
+    return x;
+}
+
+#else
+
+int BatchedOpenSimplex2Noise::fillRowSse41(float*, int, int, int) const
+{
+    return 0;
+}
+
+int BatchedOpenSimplex2Noise::fillRowAvx2(float*, int, int, int) const
+{
+    return 0;
+}
+
+#endif
+
+}// namespace Voxino
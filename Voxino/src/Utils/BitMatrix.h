@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Voxino
+{
+
+/**
+ * \brief Transposes a 64x64 matrix of bits in place, so bit c of row r moves to bit r of row c.
+ *
+ * The matrix is split into four blocks and the two off-diagonal blocks are swapped, then the same
+ * is done within every block of half the size, six times in total.
+ * \param rows Pointer to the 64 rows of the matrix
+ */
+inline void transposeBitMatrix64(std::uint64_t* rows)
+{
+    auto mask = std::uint64_t{0x00000000FFFFFFFF};
+    for (auto width = 32; width != 0; width >>= 1, mask ^= mask << width)
+    {
+        for (auto row = 0; row < 64; row = ((row | width) + 1) & ~width)
+        {
+            const auto swapped = ((rows[row] >> width) ^ rows[row | width]) & mask;
+            rows[row] ^= swapped << width;
+            rows[row | width] ^= swapped;
+        }
+    }
+}
+
+}// namespace Voxino
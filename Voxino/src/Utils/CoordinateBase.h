@@ -1,43 +1,63 @@
 #pragma once
 #include <SFML/System/Vector3.hpp>
 
+#include <cstdint>
+#include <type_traits>
+
 namespace Voxino
 {
 /**
  * A base class of coordinate systems in 3D space.
  * Works correctly in hashmap and has correctly created arithmetic and comparison operators.
+ *
+ * It is a plain value of three integers, so it is trivially copyable and takes 12 bytes.
  */
 struct CoordinateBase
 {
-    virtual ~CoordinateBase() = default;
     using IntegerUnit = int;
 
-    CoordinateBase(IntegerUnit x, IntegerUnit y, IntegerUnit z);
-    CoordinateBase(sf::Vector3i blockCoordinates);
-    CoordinateBase(glm::ivec3 blockCoordinates);
+    constexpr CoordinateBase(IntegerUnit x, IntegerUnit y, IntegerUnit z)
+        : x(x)
+        , y(y)
+        , z(z)
+    {
+    }
+
+    constexpr CoordinateBase(sf::Vector3i blockCoordinates)
+        : CoordinateBase(blockCoordinates.x, blockCoordinates.y, blockCoordinates.z)
+    {
+    }
+
+    constexpr CoordinateBase(glm::ivec3 blockCoordinates)
+        : CoordinateBase(blockCoordinates.x, blockCoordinates.y, blockCoordinates.z)
+    {
+    }
 
-    CoordinateBase(CoordinateBase&&) noexcept;
-    CoordinateBase(const CoordinateBase&) noexcept;
+    constexpr operator glm::vec<3, IntegerUnit>() const
+    {
+        return {x, y, z};
+    }
 
-    operator glm::vec<3, IntegerUnit>() const
+    constexpr CoordinateBase operator-(const CoordinateBase& rhs) const
     {
-        return mBlockCoordinates;
+        return {x - rhs.x, y - rhs.y, z - rhs.z};
     }
 
-    CoordinateBase& operator=(const CoordinateBase& rhs);
-    CoordinateBase operator-(const CoordinateBase& rhs) const;
-    CoordinateBase operator+(const CoordinateBase& rhs) const;
-    bool operator==(const CoordinateBase& rhs) const;
-    bool operator!=(const CoordinateBase& rhs) const;
+    constexpr CoordinateBase operator+(const CoordinateBase& rhs) const
+    {
+        return {x + rhs.x, y + rhs.y, z + rhs.z};
+    }
 
-private:
-    glm::vec<3, IntegerUnit> mBlockCoordinates;
+    constexpr bool operator==(const CoordinateBase& rhs) const = default;
 
-public:
-    IntegerUnit& x = mBlockCoordinates.x;
-    IntegerUnit& y = mBlockCoordinates.y;
-    IntegerUnit& z = mBlockCoordinates.z;
+    IntegerUnit x;
+    IntegerUnit y;
+    IntegerUnit z;
 };
+
+static_assert(std::is_trivially_copyable_v<CoordinateBase> &&
+                  sizeof(CoordinateBase) == 3 * sizeof(CoordinateBase::IntegerUnit),
+              "Coordinates must stay plain values of three integers");
 }// namespace Voxino
 
 namespace std
@@ -46,13 +66,30 @@ namespace std
 template<>
 struct hash<Voxino::CoordinateBase>
 {
+    /**
+     * Packs the coordinates into 64-bit words and mixes all of their bits with the finalizer of
+     * MurmurHash3, so coordinates on a regular grid, like positions of chunks, spread evenly over
+     * the buckets.
+     */
     std::size_t operator()(const Voxino::CoordinateBase& k) const noexcept
     {
-        using IntegerUnit = Voxino::CoordinateBase::IntegerUnit;
+        static constexpr auto mix = [](std::uint64_t value)
+        {
+            value ^= value >> 33;
+            value *= 0xFF51AFD7ED558CCDull;
+            value ^= value >> 33;
+            value *= 0xC4CEB9FE1A85EC53ull;
+            value ^= value >> 33;
+            return value;
+        };
+        auto bits = [](Voxino::CoordinateBase::IntegerUnit value)
+        {
+            return static_cast<std::uint64_t>(static_cast<std::uint32_t>(value));
+        };
 
-        return ((hash<IntegerUnit>()(k.x) ^ (hash<IntegerUnit>()(k.y) << 1)) >> 1) ^
-               (hash<IntegerUnit>()(k.z) << 1);
+        const auto xy = mix(bits(k.x) | (bits(k.y) << 32));
+        return static_cast<std::size_t>(mix(xy ^ (bits(k.z) * 0x9E3779B97F4A7C15ull)));
     }
 };
 
-}// namespace std
\ No newline at end of file
+}// namespace std
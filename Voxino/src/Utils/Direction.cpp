@@ -1 +1,21 @@
-#include "pch.h"
\ No newline at end of file
+#include "Direction.h"
+#include "pch.h"
+
+namespace Voxino
+{
+
+Direction oppositeDirection(Direction direction)
+{
+    switch (direction)
+    {
+        case Direction::Above: return Direction::Below;
+        case Direction::Below: return Direction::Above;
+        case Direction::ToTheLeft: return Direction::ToTheRight;
+        case Direction::ToTheRight: return Direction::ToTheLeft;
+        case Direction::InFront: return Direction::Behind;
+        case Direction::Behind: return Direction::InFront;
+        default: throw std::runtime_error("Unsupported Direction value was provided");
+    }
+}
+
+}// namespace Voxino
@@ -15,4 +15,11 @@ enum class Direction
 
     Counter
 };
-}// namespace Voxino
\ No newline at end of file
+
+/**
+ * \brief Returns the direction pointing the other way, for example Below for Above.
+ * \param direction Direction to reverse
+ * \return Opposite direction
+ */
+Direction oppositeDirection(Direction direction);
+}// namespace Voxino
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <bit>
+
+namespace Voxino
+{
+/**
+ * \brief Divides integers rounding towards negative infinity, so e.g. -1 / 64 gives -1 instead of
+ * the 0 of the built-in division. Divisors that are a power of two take an arithmetic shift alone.
+ * \param value The value to divide.
+ * \param divisor The positive divisor.
+ * \return The largest integer not greater than the exact quotient.
+ */
+constexpr int floorDivide(int value, int divisor)
+{
+    if (std::has_single_bit(static_cast<unsigned int>(divisor)))
+    {
+        return value >> std::countr_zero(static_cast<unsigned int>(divisor));
+    }
+    return (value / divisor) - ((value % divisor) < 0 ? 1 : 0);
+}
+}// namespace Voxino
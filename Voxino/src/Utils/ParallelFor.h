@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Voxino
+{
+
+/**
+ * \brief Runs the job for every index in range [0, numberOfJobs) using all processor cores.
+ *
+ * Threads take the next free index until all of them are taken, so jobs of different length are
+ * balanced on their own. The calling thread takes part in the work and the function returns when
+ * all jobs are finished. If any job throws, remaining jobs are skipped and the first exception is
+ * rethrown.
+ * @param numberOfJobs Number of jobs to run
+ * @param job Callable taking the index of the job
+ */
+template<typename Job>
+void parallelFor(std::size_t numberOfJobs, const Job& job)
+{
+    std::atomic<std::size_t> nextJob{0};
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    auto worker = [&]()
+    {
+        for (auto jobIndex = nextJob++; jobIndex < numberOfJobs; jobIndex = nextJob++)
+        {
+            try
+            {
+                job(jobIndex);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(exceptionMutex);
+                if (not firstException)
+                {
+                    firstException = std::current_exception();
+                }
+                nextJob = numberOfJobs;
+            }
+        }
+    };
+
+    const auto numberOfThreads = std::min<std::size_t>(
+        std::max(std::thread::hardware_concurrency(), 1u), numberOfJobs);
+    {
+        std::vector<std::jthread> helpers;
+        for (auto i = std::size_t{1}; i < numberOfThreads; ++i)
+        {
+            helpers.emplace_back(worker);
+        }
+        worker();
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
+}
+
+}// namespace Voxino
@@ -8,21 +8,6 @@
 namespace Voxino
 {
 
-Block::Block()
-    : mBlockType(&BlockMap::blockMap().blockType(BlockId::Air))
-{
-}
-
-Block::Block(const BlockId& blockId)
-    : mBlockType(&BlockMap::blockMap().blockType(blockId))
-{
-}
-
-Block::Block(const Block& rhs)
-    : mBlockType(rhs.mBlockType)
-{
-}
-
 Block::Coordinate Block::Coordinate::coordinateInGivenDirection(Direction direction) const
 {
     switch (direction)
@@ -45,22 +30,22 @@ sf::Vector3<Block::SizeType> Block::Coordinate::nonBlockMetric() const
 
 void Block::setBlockType(const BlockId& blockId)
 {
-    mBlockType = &BlockMap::blockMap().blockType(blockId);
+    mId = blockId;
 }
 
-Block::TextureId Block::blockTextureId(const Block::Face& blockFace) const
+const BlockType& Block::blockType() const
 {
-    return mBlockType->textureId.at(blockFace);
+    return BlockMap::blockMap().blockType(mId);
 }
 
-BlockId Block::id() const
+Block::TextureId Block::blockTextureId(const Block::Face& blockFace) const
 {
-    return mBlockType->id;
+    return blockType().textureId[static_cast<std::size_t>(blockFace)];
 }
 
 bool Block::isTransparent() const
 {
-    return mBlockType->transparent;
+    return blockType().transparent;
 }
 
 bool Block::isFloral() const
@@ -75,34 +60,12 @@ bool Block::isFloral() const
 
 RGBA Block::toRGBA() const
 {
-    auto blockInShader = toBlockInShader();
-    const auto rgba = reinterpret_cast<RGBA&>(blockInShader);
-    return rgba;
-}
-
-std::array<GLubyte, 4> Block::toBlockInShader() const
-{
-    std::array<GLubyte, 4> rgba{};
-    constexpr auto numberOfBlockFaces = 6;
-    for (auto i = 0; i < numberOfBlockFaces; i += 2)
-    {
-        auto textureID1 = blockTextureId(static_cast<Block::Face>(i));
-        auto textureID2 = blockTextureId(static_cast<Block::Face>(i + 1));
-        rgba[i / 2] = encodeTextureID(textureID1, textureID2);
-    }
-    rgba[3] = 255;
-    return rgba;
-}
-
-float Block::encodeTextureID(int highPart, int lowPart)
-{
-    int value = (highPart << 4) | lowPart;
-    return value;
+    return blockType().rgba;
 }
 
 bool Block::isCollidable() const
 {
-    return mBlockType->collidable;
+    return blockType().collidable;
 }
 
 Direction Block::directionOfFace(Block::Face face)
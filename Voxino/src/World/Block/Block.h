@@ -5,6 +5,7 @@
 #include "Utils/Direction.h"
 
 #include <Utils/RGBA.h>
+#include <type_traits>
 
 
 namespace Voxino
@@ -13,12 +14,22 @@ namespace Voxino
 class BlockType;
 class TexturePack;
 
+/**
+ * A handle of a block type, as small and cheap to copy as its identifier.
+ *
+ * The block does not hold its type, the properties of the type are found in BlockMap under the
+ * identifier. Constructing a block does not touch the map. A value-initialized block, like Block{}
+ * or zeroed memory, is air. A default-initialized block, like `Block block;`, is left
+ * indeterminate, so arrays of blocks cost nothing to construct.
+ */
 class Block
 {
 public:
-    Block();
-    explicit Block(const BlockId& blockId);
-    Block(const Block& rhs);
+    Block() = default;
+    explicit constexpr Block(const BlockId& blockId)
+        : mId(blockId)
+    {
+    }
 
     /**
      * \brief The type of variable that is used to define the side of the block
@@ -139,7 +150,10 @@ public:
      * Returns a block id
      * @return Identifier of the block
      */
-    [[nodiscard]] BlockId id() const;
+    [[nodiscard]] constexpr BlockId id() const
+    {
+        return mId;
+    }
 
     /**
      * Returns information about whether the block is transparent. For example, it can be glass.
@@ -161,8 +175,8 @@ public:
     [[nodiscard]] bool isFloral() const;
 
     /**
-     * @brief Converts the block to a RGBA color
-     * @return RGBA color
+     * @brief Converts the block to a RGBA color, in which shaders find the textures of its faces
+     * @return RGBA color, encoded once when the block types are loaded
      */
     [[nodiscard]] RGBA toRGBA() const;
 
@@ -173,14 +187,20 @@ public:
 
 
 private:
-    [[nodiscard]] std::array<GLubyte, 4> toBlockInShader() const;
-    static float encodeTextureID(int highPart, int lowPart);
-
+    /**
+     * Returns the properties of the type of the block
+     * @return Type of the block, stored in BlockMap
+     */
+    [[nodiscard]] const BlockType& blockType() const;
 
 private:
-    const BlockType* mBlockType;
+    BlockId mId;
 };
 
+static_assert(std::is_trivially_default_constructible_v<Block> &&
+                  std::is_trivially_copyable_v<Block> && sizeof(Block) == sizeof(BlockId),
+              "Blocks must stay plain handles of their type");
+
 }// namespace Voxino
 
 namespace std
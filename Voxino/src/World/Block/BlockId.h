@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstdint>
+
 namespace Voxino
 {
 
 // clang-format off
-enum class BlockId
+/**
+ * Identifier of a block type. Air is the zero value, so zeroed memory holds air blocks.
+ */
+enum class BlockId : std::uint16_t
 {
     Air          = 0,
     Grass        = 1,
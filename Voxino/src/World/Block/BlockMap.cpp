@@ -15,12 +15,17 @@ const BlockMap& BlockMap::blockMap()
 
 const BlockType& BlockMap::blockType(const BlockId& blockId) const
 {
-    return mBlockMap.at(blockId);
+    return mBlockTypes[static_cast<std::size_t>(blockId)];
 }
 
 BlockMap::BlockMap()
+    : BlockMap("resources/")
 {
-    parseDirectory("resources/");
+}
+
+BlockMap::BlockMap(const std::string& directoryName)
+{
+    parseDirectory(directoryName);
 }
 
 void BlockMap::parseDirectory(const std::string& directoryName)
@@ -37,6 +42,12 @@ void BlockMap::parseDirectory(const std::string& directoryName)
 
     for (auto block: blocks["blocks"])
     {
+        if (currentId >= static_cast<int>(mBlockTypes.size()))
+        {
+            throw std::runtime_error("More blocks are defined in " + directoryName +
+                                     "blocks.yaml than there are block ids");
+        }
+
         BlockType blockType;
         blockType.id = static_cast<BlockId>(currentId++);
         blockType.name = block["name"].as<std::string>();
@@ -46,7 +57,7 @@ void BlockMap::parseDirectory(const std::string& directoryName)
         {
             if (block[setting])
             {
-                blockType.textureId[blockFace] =
+                blockType.textureId[static_cast<std::size_t>(blockFace)] =
                     static_cast<Block::TextureId>(textureMapping[block[setting].as<std::string>()]);
             }
         };
@@ -57,20 +68,18 @@ void BlockMap::parseDirectory(const std::string& directoryName)
                 static_cast<Block::TextureId>(textureMapping[block["texture"].as<std::string>()]);
             for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
             {
-                blockType.textureId[static_cast<Block::Face>(i)] = generalTexture;
+                blockType.textureId[i] = generalTexture;
             }
         }
 
         if (block["textureSide"])
         {
-            blockType.textureId[Block::Face::Left] = static_cast<Block::TextureId>(
-                textureMapping[block["textureSide"].as<std::string>()]);
-            blockType.textureId[Block::Face::Right] = static_cast<Block::TextureId>(
-                textureMapping[block["textureSide"].as<std::string>()]);
-            blockType.textureId[Block::Face::Front] = static_cast<Block::TextureId>(
-                textureMapping[block["textureSide"].as<std::string>()]);
-            blockType.textureId[Block::Face::Back] = static_cast<Block::TextureId>(
+            const auto sideTexture = static_cast<Block::TextureId>(
                 textureMapping[block["textureSide"].as<std::string>()]);
+            blockType.textureId[static_cast<std::size_t>(Block::Face::Left)] = sideTexture;
+            blockType.textureId[static_cast<std::size_t>(Block::Face::Right)] = sideTexture;
+            blockType.textureId[static_cast<std::size_t>(Block::Face::Front)] = sideTexture;
+            blockType.textureId[static_cast<std::size_t>(Block::Face::Back)] = sideTexture;
         }
 
         // Set other texture faces of blocks (optional)
@@ -83,7 +92,8 @@ void BlockMap::parseDirectory(const std::string& directoryName)
 
         blockType.transparent = block["transparent"] ? block["transparent"].as<bool>() : false;
         blockType.collidable = block["transparent"] ? block["transparent"].as<bool>() : true;
-        mBlockMap[blockType.id] = blockType;
+        blockType.encodeTextures();
+        mBlockTypes[static_cast<std::size_t>(blockType.id)] = blockType;
     }
 }
 
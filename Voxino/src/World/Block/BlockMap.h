@@ -6,6 +6,9 @@ namespace Voxino
 
 /**
  * A map containing access to information about the blocks in the game.
+ *
+ * Types are stored in an array indexed by the block id, so looking them up on per-block paths
+ * costs a single indexing.
  */
 class BlockMap
 {
@@ -16,6 +19,12 @@ public:
      */
     const static BlockMap& blockMap();
 
+    /**
+     * Loads the blocks from the given folder instead of the resources of the game
+     * @param directoryName Path to folder containing blocks.yaml and textures.yaml
+     */
+    explicit BlockMap(const std::string& directoryName);
+
     /**
      * Returns the type of block, which is information about the block
      * @param blockId The id of the block
@@ -33,9 +42,9 @@ private:
     void parseDirectory(const std::string& directoryName);
 
     /**
-     * Maps filename to specific BlockType
+     * Types of all blocks, under the index of their id
      */
-    std::unordered_map<BlockId, BlockType> mBlockMap;
+    std::array<BlockType, static_cast<std::size_t>(BlockId::Counter)> mBlockTypes;
 };
 
 }// namespace Voxino
\ No newline at end of file
@@ -1,2 +1,22 @@
 #include "BlockType.h"
-#include "pch.h"
\ No newline at end of file
+#include "pch.h"
+
+namespace Voxino
+{
+
+void BlockType::encodeTextures()
+{
+    auto encodeTextureIds = [this](Block::Face highFace, Block::Face lowFace)
+    {
+        const auto high = static_cast<int>(textureId[static_cast<std::size_t>(highFace)]);
+        const auto low = static_cast<int>(textureId[static_cast<std::size_t>(lowFace)]);
+        return static_cast<GLubyte>((high << 4) | low);
+    };
+
+    rgba.r = encodeTextureIds(Block::Face::Bottom, Block::Face::Top);
+    rgba.g = encodeTextureIds(Block::Face::Left, Block::Face::Right);
+    rgba.b = encodeTextureIds(Block::Face::Front, Block::Face::Back);
+    rgba.a = 255;
+}
+
+}// namespace Voxino
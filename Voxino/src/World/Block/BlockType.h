@@ -9,11 +9,26 @@ namespace Voxino
  */
 struct BlockType
 {
-    BlockId id;
+    BlockId id = BlockId::Air;
     std::string name;
     bool transparent = false;
     bool collidable = true;
-    std::unordered_map<Block::Face, Block::TextureId> textureId;
+
+    /**
+     * Texture of every face of the block, indexed by Block::Face
+     */
+    std::array<Block::TextureId, static_cast<std::size_t>(Block::Face::Counter)> textureId{};
+
+    /**
+     * Textures of all faces packed the way shaders read them, two faces per channel. It is
+     * computed once by encodeTextures(), so uploading blocks does not pack them again.
+     */
+    RGBA rgba{};
+
+    /**
+     * Packs the textures of the faces into rgba. Must be called after textureId is filled.
+     */
+    void encodeTextures();
 };
 
-}// namespace Voxino
\ No newline at end of file
+}// namespace Voxino
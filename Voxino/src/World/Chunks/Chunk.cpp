@@ -19,6 +19,17 @@ Chunk::Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePac
     generateChunkTerrain();
 }
 
+Chunk::Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+             ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : mChunkPosition(std::move(blockPosition))
+    , mTexturePack(texturePack)
+    , mParentContainer(&parent)
+    , mChunkOfBlocks(std::move(chunkBlocks))
+    , mTerrainGenerator(std::make_unique<SimpleTerrainGenerator>())
+{
+    mBorderSlices.rebuild(*mChunkOfBlocks);
+}
+
 Chunk::Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack)
     : mChunkPosition(std::move(blockPosition))
     , mTexturePack(texturePack)
@@ -36,6 +47,8 @@ Chunk::Chunk(Chunk&& rhs) noexcept
     // , mTerrainModel(std::move(rhs.mTerrainModel)) // TODO
     , mChunkOfBlocks(std::move(rhs.mChunkOfBlocks))
     , mTerrainGenerator(std::move(rhs.mTerrainGenerator))
+    , mNeighbourBorders(std::move(rhs.mNeighbourBorders))
+    , mBorderSlices(rhs.mBorderSlices)
 {
 }
 
@@ -66,9 +79,9 @@ bool Chunk::isLocalCoordinateOnChunkEdge(const Block::Coordinate& localCoordinat
 
 void Chunk::removeLocalBlock(const Block::Coordinate& localCoordinates)
 {
-    mChunkOfBlocks->block(localCoordinates).setBlockType(BlockId::Air);
-
-    // rebuildMesh(); // TODO
+    mChunkOfBlocks->setBlock(localCoordinates, BlockId::Air);
+    mBorderSlices.updateBlock(localCoordinates, mChunkOfBlocks->block(localCoordinates));
+    // The mesh is refreshed by the container, see ChunkContainer::onBlockChanged()
 }
 
 Block::Coordinate Chunk::globalToLocalCoordinates(const Block::Coordinate& worldCoordinates) const
@@ -87,20 +100,29 @@ void Chunk::updateImGui()
 {
 }
 
-Block& Chunk::localBlock(const Block::Coordinate& localCoordinates)
+unsigned long Chunk::blocksMemorySize() const
 {
-    return const_cast<Block&>(static_cast<const Chunk&>(*this).localBlock(localCoordinates));
+    return mChunkOfBlocks->memorySize();
 }
 
-Block& Chunk::localNearbyBlock(const Block::Coordinate& position, const Direction& direction)
+const Block& Chunk::localBlock(const Block::Coordinate& localCoordinates) const
 {
-    return const_cast<Block&>(
-        static_cast<const Chunk&>(*this).localNearbyBlock(position, direction));
+    return mChunkOfBlocks->block(localCoordinates);
 }
 
-const Block& Chunk::localBlock(const Block::Coordinate& localCoordinates) const
+const ChunkBlocks& Chunk::blocks() const
 {
-    return mChunkOfBlocks->block(localCoordinates);
+    return *mChunkOfBlocks;
+}
+
+const ChunkBorderSlices& Chunk::borderSlices() const
+{
+    return mBorderSlices;
+}
+
+void Chunk::setNeighbourBorders(std::unique_ptr<ChunkNeighbourBorders> neighbourBorders)
+{
+    mNeighbourBorders = std::move(neighbourBorders);
 }
 
 const Block& Chunk::localNearbyBlock(const Block::Coordinate& localCoordinates,
@@ -167,9 +189,12 @@ bool Chunk::doesBlockFaceHasTransparentNeighbor(const Block::Face& blockFace,
 {
     auto isBlockTransparent = [&blockPos, this](const Direction& face)
     {
-        auto neighbour = neighbourBlockInGivenDirection(blockPos, face);
-        return (not neighbour.has_value()) or
-               (neighbour.has_value() && neighbour.value().isTransparent());
+        const auto blockNeighborPosition = localNearbyBlockPosition(blockPos, face);
+        if (areLocalCoordinatesInsideChunk(blockNeighborPosition))
+        {
+            return localBlock(blockNeighborPosition).isTransparent();
+        }
+        return not isBlockOutsideChunkOpaque(blockNeighborPosition);
     };
 
     switch (blockFace)
@@ -227,6 +252,51 @@ std::optional<Block> Chunk::neighbourBlockInGivenDirection(const Block::Coordina
     return std::nullopt;
 }
 
+bool Chunk::isBlockOutsideChunkOpaque(const Block::Coordinate& localCoordinates) const
+{
+    if (mNeighbourBorders)
+    {
+        return mNeighbourBorders->isOpaque(localCoordinates);
+    }
+
+    if (mParentContainer)
+    {
+        if (const auto& neighborBlock =
+                mParentContainer->worldBlock(localToGlobalCoordinates(localCoordinates)))
+        {
+            return not neighborBlock->isTransparent();
+        }
+    }
+
+    return false;
+}
+
+ChunkBorderSlices::Slice Chunk::neighbourBorderSlice(Direction directionOfNeighbour) const
+{
+    if (mNeighbourBorders)
+    {
+        const auto* border = mNeighbourBorders->border(directionOfNeighbour);
+        return border ? *border : ChunkBorderSlices::Slice{};
+    }
+
+    // Slow path for chunks meshed without a copy of the borders of their neighbours
+    ChunkBorderSlices::Slice slice{};
+    for (auto row = 0; row < ChunkBlocks::BLOCKS_PER_DIMENSION; ++row)
+    {
+        for (auto bit = 0; bit < ChunkBlocks::BLOCKS_PER_DIMENSION; ++bit)
+        {
+            const auto blockOnFace =
+                ChunkBorderSlices::localCoordinates(directionOfNeighbour, row, bit);
+            if (isBlockOutsideChunkOpaque(
+                    localNearbyBlockPosition(blockOnFace, directionOfNeighbour)))
+            {
+                slice[row] |= ChunkBorderSlices::Row{1} << bit;
+            }
+        }
+    }
+    return slice;
+}
+
 const Block::Coordinate& Chunk::positionInBlocks() const
 {
     return mChunkPosition;
@@ -253,13 +323,13 @@ bool Chunk::tryToPlaceBlockInsideThisChunk(const BlockId& blockId,
                                            const Block::Coordinate& localCoordinates,
                                            std::vector<BlockId>& blocksThatMightBeOverplaced)
 {
-    auto& block = mChunkOfBlocks->block(localCoordinates);
-    auto idOfTheBlockToOverplace = block.id();
+    auto idOfTheBlockToOverplace = mChunkOfBlocks->block(localCoordinates).id();
 
     if (canGivenBlockBeOverplaced(blocksThatMightBeOverplaced, idOfTheBlockToOverplace))
     {
-        block.setBlockType(blockId);
-        // rebuildMesh(); // TODO
+        mChunkOfBlocks->setBlock(localCoordinates, blockId);
+        mBorderSlices.updateBlock(localCoordinates, mChunkOfBlocks->block(localCoordinates));
+        // The mesh is refreshed by the container, see ChunkContainer::onBlockChanged()
         return true;
     }
     return false;
@@ -269,6 +339,7 @@ void Chunk::generateChunkTerrain()
 {
     MEASURE_SCOPE;
     mTerrainGenerator->generateTerrain(*this, *mChunkOfBlocks);
+    mBorderSlices.rebuild(*mChunkOfBlocks);
 }
 
 bool Chunk::canGivenBlockBeOverplaced(std::vector<BlockId>& blocksThatMightBeOverplaced,
@@ -1,6 +1,8 @@
 #pragma once
 #include "Renderer/Renderer.h"
 #include "World/Block/Block.h"
+#include "World/Chunks/ChunkBorderSlices.h"
+#include "World/Chunks/ChunkNeighbourBorders.h"
 #include "World/Chunks/SimpleTerrainGenerator.h"
 
 #include <memory>
@@ -20,6 +22,12 @@ class Chunk
 public:
     Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
           ChunkContainerBase& parent);
+
+    /**
+     * \brief Creates the chunk from blocks whose terrain has already been generated.
+     */
+    Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+          ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
     Chunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack);
 
     Chunk(Chunk&& rhs) noexcept;
@@ -37,6 +45,12 @@ public:
      */
     virtual unsigned long memorySize() = 0;
 
+    /**
+     * Returns the size in memory that the blocks of the chunk occupy
+     * @return The size in memory in bytes of the chunk blocks
+     */
+    [[nodiscard]] unsigned long blocksMemorySize() const;
+
     /**
      * Updates the status/logic of the chunk at equal intervals independent of the frame rate.
      * @param deltaTime Time interval
@@ -63,13 +77,6 @@ public:
     virtual void draw(const Renderer& renderer, const Shader& shader,
                       const Camera& camera) const = 0;
 
-    /**
-     * \brief Returns the block according to the coordinates given relative to the chunk position.
-     * \param localCoordinates Position in relation to the chunk
-     * \return Block reference inside chunk
-     */
-    Block& localBlock(const Block::Coordinate& localCoordinates);
-
     /**
      * \brief Removes a block on coordinates given relatively to the position of the chunk
      * \param localCoordinates Coordinates relative to the position of the chunk
@@ -102,6 +109,28 @@ public:
      */
     [[nodiscard]] const Block& localBlock(const Block::Coordinate& localCoordinates) const;
 
+    /**
+     * \brief Returns all blocks of the chunk.
+     * \return Blocks of the chunk
+     */
+    [[nodiscard]] const ChunkBlocks& blocks() const;
+
+    /**
+     * \brief Returns the occupancy of the outermost layers of blocks of the chunk, which is all its
+     * neighbours need to know to cull their faces.
+     * \return Border slices of the chunk
+     */
+    [[nodiscard]] const ChunkBorderSlices& borderSlices() const;
+
+    /**
+     * \brief Makes the chunk look up its neighbours in the given copy of their borders instead of
+     * the parent container. Such a chunk no longer reads the container, so it can be meshed on
+     * another thread.
+     * \param neighbourBorders Border slices of the neighbours touching the faces of the chunk, or
+     * nullptr to go back to the parent container
+     */
+    void setNeighbourBorders(std::unique_ptr<ChunkNeighbourBorders> neighbourBorders);
+
     /**
      * \brief Changes global world coordinates to local ones relative to chunk
      * \param worldCoordinates World coordinates of the block
@@ -145,16 +174,6 @@ public:
     [[nodiscard]] Block::Coordinate localNearbyBlockPosition(const Block::Coordinate& position,
                                                              const Direction& direction) const;
 
-    /**
-     * Returns the block that is close to it, in the direction determined relative to the
-     * block on the local coordinates.
-     * @param position Local block coordinates inside the chunk
-     * @param direction Direction next to which the block are looking for is located
-     * @return Block reference inside chunk
-     */
-    [[nodiscard]] Block& localNearbyBlock(const Block::Coordinate& position,
-                                          const Direction& direction);
-
     /**
      * Returns the block that is close to it, in the direction determined relative to the block on
      * the local coordinates.
@@ -172,7 +191,9 @@ public:
     [[nodiscard]] const Block::Coordinate& positionInBlocks() const;
 
     /**
-     * @brief Finds a neighboring block located in the indicated direction
+     * @brief Finds a neighboring block located in the indicated direction. Blocks of other chunks
+     * are looked up in the parent container, so use isBlockOutsideChunkOpaque() if only the
+     * opacity of the block matters.
      * @param blockPos Position of the block for which the neighbor is sought
      * @param direction Direction from the block for which the neighbor is sought
      * @return Block if it exists, or nullopt if no such block exists.
@@ -180,6 +201,23 @@ public:
     std::optional<Block> neighbourBlockInGivenDirection(const Block::Coordinate& blockPos,
                                                         const Direction& direction);
 
+    /**
+     * @brief Checks whether a block lying right behind one of the faces of this chunk, in one of
+     * the neighbouring chunks, is opaque.
+     * @param localCoordinates Coordinates relative to the position of the chunk
+     * @return True if such a block exists and is opaque, false otherwise.
+     */
+    [[nodiscard]] bool isBlockOutsideChunkOpaque(const Block::Coordinate& localCoordinates) const;
+
+    /**
+     * @brief Returns the border slice of the neighbour lying in the given direction. Its rows and
+     * bits are laid out like the slice of the face of this chunk pointing in that direction.
+     * @param directionOfNeighbour Direction in which the neighbour lies
+     * @return Slice of the neighbour. Empty if there is no neighbour.
+     */
+    [[nodiscard]] ChunkBorderSlices::Slice neighbourBorderSlice(
+        Direction directionOfNeighbour) const;
+
 protected:
     /**
      * It checks whether a given block face has an "air" or other transparent face next to it
@@ -239,6 +277,8 @@ protected:
     const TexturePackArray& mTexturePack;
     std::unique_ptr<SimpleTerrainGenerator> mTerrainGenerator;
     ChunkContainerBase* mParentContainer;
+    std::unique_ptr<ChunkNeighbourBorders> mNeighbourBorders;
+    ChunkBorderSlices mBorderSlices;
 };
 
 }// namespace Voxino
\ No newline at end of file
@@ -2,108 +2,427 @@
 
 #include "Utils/MultiDimensionalArray.h"
 #include "World/Block/Block.h"
+#include "World/Chunks/ChunkBlocksLayout.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
 
 namespace Voxino
 {
 
-class ChunkBlocksIterator;
+template<typename Layout>
 class ConstChunkBlocksIterator;
 
-class ChunkBlocks
+/**
+ * \brief Property of the blocks kept in the occupancy bit masks of the chunk.
+ */
+enum class BlockOccupancy
+{
+    // Blocks which are not transparent and hide the faces of the blocks touching them
+    Opaque,
+    // All blocks other than air, including the transparent ones
+    NonAir,
+    Counter
+};
+
+/**
+ * \brief Blocks of a single chunk stored as indices into a small per-chunk palette.
+ *
+ * Each voxel keeps only a one-byte index into the palette of block types present in the chunk,
+ * instead of the full Block. The palette never holds more entries than there are block types, so
+ * references to palette entries remain valid for the whole lifetime of the chunk.
+ *
+ * A chunk made of a single block type (for example all air or all stone) is kept in a uniform
+ * state without any per-voxel indices. It is expanded into the dense array of indices only on the
+ * first write of a different block type.
+ *
+ * The order of the indices in memory is given by the layout, see ChunkBlocksLayout.h. Iterators
+ * visit the blocks in this order.
+ *
+ * Next to the indices, a dense chunk keeps a bit mask of every row along the x axis for each
+ * BlockOccupancy. The masks are updated on every write, so meshers and acceleration structures
+ * read which blocks are opaque or not air without looking up the block types.
+ * \tparam Layout Policy mapping positions of the blocks to indices and back
+ */
+template<typename Layout>
+class BasicChunkBlocks
 {
 public:
+    using LayoutType = Layout;
+
     // For Binary Greedy Meshing to work all of them must be equal
-    static constexpr auto BLOCKS_PER_DIMENSION = BLOCK_PER_DIMENSION_IN_CHUNK;
+    static constexpr auto BLOCKS_PER_DIMENSION = Layout::BLOCKS_PER_DIMENSION;
     static constexpr auto BLOCKS_PER_X_DIMENSION = BLOCKS_PER_DIMENSION;
     static constexpr auto BLOCKS_PER_Y_DIMENSION = BLOCKS_PER_DIMENSION;
     static constexpr auto BLOCKS_PER_Z_DIMENSION = BLOCKS_PER_DIMENSION;
     static constexpr auto BLOCKS_IN_CHUNK =
         BLOCKS_PER_X_DIMENSION * BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_Z_DIMENSION;
 
-    [[nodiscard]] ChunkBlocksIterator begin();
-    [[nodiscard]] ChunkBlocksIterator end();
+    /**
+     * \brief Type of the index pointing into the palette of the chunk.
+     */
+    using PaletteIndex = std::uint8_t;
+    static constexpr auto MAX_PALETTE_SIZE = static_cast<std::size_t>(BlockId::Counter);
+    static_assert(MAX_PALETTE_SIZE < std::numeric_limits<PaletteIndex>::max(),
+                  "PaletteIndex is too small to index every block type");
 
-    [[nodiscard]] ConstChunkBlocksIterator cbegin() const;
-    [[nodiscard]] ConstChunkBlocksIterator cend() const;
+    /**
+     * \brief One bit mask per row of blocks along the x axis. The row of y and z is stored under
+     * y + z * BLOCKS_PER_Y_DIMENSION, and the block x of the row under the bit x.
+     */
+    using RowMasks = std::array<std::uint64_t, BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_Z_DIMENSION>;
+    static_assert(BLOCKS_PER_X_DIMENSION <= 64, "Every row of the chunk must fit into 64 bits");
 
-    template<typename T>
-    inline Block& block(const T& dimensions)
+    /**
+     * \brief Masks of the rows in which no block or every block has the property.
+     */
+    static constexpr auto EMPTY_ROWS = RowMasks{};
+    static constexpr auto FULL_ROWS = []
+    {
+        RowMasks rows;
+        rows.fill(~std::uint64_t{0} >> (64 - BLOCKS_PER_X_DIMENSION));
+        return rows;
+    }();
+
+    BasicChunkBlocks()
+    {
+        mPalette.reserve(MAX_PALETTE_SIZE);
+        mPaletteLookup.fill(NOT_IN_PALETTE);
+        mUniformIndex = paletteIndex(BlockId::Air);
+    }
+
+    [[nodiscard]] ConstChunkBlocksIterator<Layout> begin() const
+    {
+        return {*this, 0};
+    }
+
+    [[nodiscard]] ConstChunkBlocksIterator<Layout> end() const
+    {
+        return {*this, BLOCKS_IN_CHUNK};
+    }
+
+    [[nodiscard]] ConstChunkBlocksIterator<Layout> cbegin() const
+    {
+        return begin();
+    }
+
+    [[nodiscard]] ConstChunkBlocksIterator<Layout> cend() const
     {
-        auto index = (dimensions.z * BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_X_DIMENSION) +
-                     (dimensions.y * BLOCKS_PER_X_DIMENSION) + dimensions.x;
-        return mBlocks[index];
+        return end();
     }
 
     template<typename T>
     [[nodiscard]] inline const Block& block(const T& dimensions) const
     {
-        auto index = (dimensions.z * BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_X_DIMENSION) +
-                     (dimensions.y * BLOCKS_PER_X_DIMENSION) + dimensions.x;
-        return mBlocks[index];
+        return blockAtIndex(index(dimensions.x, dimensions.y, dimensions.z));
     }
 
     template<typename T>
-    inline Block& block(T x, T y, T z)
+    [[nodiscard]] inline const Block& block(T x, T y, T z) const
     {
-        auto index = (z * BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_X_DIMENSION) +
-                     (y * BLOCKS_PER_X_DIMENSION) + x;
-        return mBlocks[index];
+        return blockAtIndex(index(x, y, z));
     }
 
+    /**
+     * \brief Replaces the block at the given position with a block of the given type.
+     * \param dimensions Position of the block inside the chunk
+     * \param blockId Identifier of the new block type
+     */
     template<typename T>
-    [[nodiscard]] inline const Block& block(T x, T y, T z) const
+    inline void setBlock(const T& dimensions, BlockId blockId)
+    {
+        setBlockAt(static_cast<int>(dimensions.x), static_cast<int>(dimensions.y),
+                   static_cast<int>(dimensions.z), blockId);
+    }
+
+    /**
+     * \brief Replaces the block at the given position with a block of the given type.
+     * \param x, y, z Position of the block inside the chunk
+     * \param blockId Identifier of the new block type
+     */
+    template<typename T>
+    inline void setBlock(T x, T y, T z, BlockId blockId)
+    {
+        setBlockAt(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z), blockId);
+    }
+
+    /**
+     * \brief Replaces a vertical span of blocks in a single column with blocks of the given type.
+     * \param x, z Position of the column inside the chunk
+     * \param beginY First height of the span
+     * \param endY Height right after the last block of the span
+     * \param blockId Identifier of the new block type
+     */
+    void setColumnSpan(int x, int z, int beginY, int endY, BlockId blockId)
+    {
+        if (beginY >= endY)
+        {
+            return;
+        }
+
+        const auto newIndex = paletteIndex(blockId);
+        if (isUniform())
+        {
+            if (newIndex == mUniformIndex)
+            {
+                return;
+            }
+            expandUniformState();
+        }
+
+        for (auto y = beginY; y < endY; ++y)
+        {
+            mIndices[index(x, y, z)] = newIndex;
+            updateOccupancy(x, y, z, newIndex);
+        }
+    }
+
+    /**
+     * \brief Replaces all blocks of the chunk with a block of the given type.
+     *
+     * The chunk returns to the uniform state and releases its per-voxel indices.
+     * \param blockId Identifier of the block type filling the chunk
+     */
+    void fill(BlockId blockId)
+    {
+        mUniformIndex = paletteIndex(blockId);
+        mIndices.clear();
+        mIndices.shrink_to_fit();
+        mOccupancyRows.clear();
+        mOccupancyRows.shrink_to_fit();
+    }
+
+    /**
+     * \brief Returns the block stored under the given index of the layout.
+     * \param index Index of the block
+     * \return Block under the given index
+     */
+    [[nodiscard]] inline const Block& blockAtIndex(int index) const
+    {
+        return mPalette[isUniform() ? mUniformIndex : mIndices[index]];
+    }
+
+    /**
+     * \brief Checks whether all blocks of the chunk are of the same type.
+     *
+     * The answer is exact only for chunks that were never expanded. A dense chunk, whose blocks
+     * happen to be the same, is not reported as uniform.
+     * \return True if the chunk is in the uniform state, false otherwise
+     */
+    [[nodiscard]] inline bool isUniform() const
     {
-        auto index = (z * BLOCKS_PER_Y_DIMENSION * BLOCKS_PER_X_DIMENSION) +
-                     (y * BLOCKS_PER_X_DIMENSION) + x;
-        return mBlocks[index];
+        return mIndices.empty();
+    }
+
+    /**
+     * \brief Returns the block filling the whole chunk. Valid only for uniform chunks.
+     * \return Block of which the chunk is made of
+     */
+    [[nodiscard]] inline const Block& uniformBlock() const
+    {
+        return mPalette[mUniformIndex];
+    }
+
+    /**
+     * \brief Returns the bit mask of every row along the x axis, in which the bits of blocks with
+     * the given property are set. Rows are laid out as described by RowMasks.
+     * \param occupancy Property of the blocks
+     * \return Masks of the rows, valid until the chunk is changed
+     */
+    [[nodiscard]] const RowMasks& occupancyRows(BlockOccupancy occupancy) const
+    {
+        if (isUniform())
+        {
+            return hasOccupancy(mUniformIndex, occupancy) ? FULL_ROWS : EMPTY_ROWS;
+        }
+        return mOccupancyRows[static_cast<std::size_t>(occupancy)];
+    }
+
+    /**
+     * \brief Visits every block of a cube aligned to its size, like an octant of an octree. In
+     * layouts storing such cubes contiguously the blocks are read in a single sweep.
+     * \param origin Corner of the cube with the lowest coordinates, a multiple of the size
+     * \param size Length of the edge of the cube, a power of two
+     * \param visitor Callable taking const Block&
+     */
+    template<typename Visitor>
+    void forEachBlockOfCube(const glm::ivec3& origin, int size, const Visitor& visitor) const
+    {
+        if constexpr (Layout::HAS_CONTIGUOUS_CUBES)
+        {
+            const auto first = index(origin.x, origin.y, origin.z);
+            for (auto i = first; i < first + size * size * size; ++i)
+            {
+                visitor(blockAtIndex(i));
+            }
+        }
+        else
+        {
+            for (auto z = origin.z; z < origin.z + size; ++z)
+            {
+                for (auto y = origin.y; y < origin.y + size; ++y)
+                {
+                    for (auto x = origin.x; x < origin.x + size; ++x)
+                    {
+                        visitor(blockAtIndex(index(x, y, z)));
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * \brief Number of different block types that appeared in the chunk so far.
+     * \return Size of the palette
+     */
+    [[nodiscard]] std::size_t paletteSize() const
+    {
+        return mPalette.size();
+    }
+
+    /**
+     * \brief Returns the size in memory occupied by the blocks of the chunk.
+     * \return The size in bytes of both the palette and the indices
+     */
+    [[nodiscard]] unsigned long memorySize() const
+    {
+        return sizeof(BasicChunkBlocks) + mPalette.capacity() * sizeof(Block) +
+               mIndices.capacity() * sizeof(PaletteIndex) +
+               mOccupancyRows.capacity() * sizeof(RowMasks);
     }
 
 private:
-    std::array<Block, BLOCKS_IN_CHUNK> mBlocks;
-};
+    template<typename T>
+    [[nodiscard]] static inline int index(T x, T y, T z)
+    {
+        return Layout::index(static_cast<int>(x), static_cast<int>(y), static_cast<int>(z));
+    }
 
+    /**
+     * \brief Finds the palette entry of the given block type, adding it if it is not there yet.
+     * \param blockId Identifier of the block type
+     * \return Index inside the palette
+     */
+    PaletteIndex paletteIndex(BlockId blockId)
+    {
+        auto& lookup = mPaletteLookup[static_cast<std::size_t>(blockId)];
+        if (lookup == NOT_IN_PALETTE)
+        {
+            lookup = static_cast<PaletteIndex>(mPalette.size());
+            const auto& block = mPalette.emplace_back(blockId);
+            mPaletteOccupancy[lookup] =
+                occupancyBit(BlockOccupancy::Opaque, not block.isTransparent()) |
+                occupancyBit(BlockOccupancy::NonAir, blockId != BlockId::Air);
+        }
+        return lookup;
+    }
 
-class ChunkBlocksIterator
-{
-public:
-    ChunkBlocksIterator(std::array<Block, ChunkBlocks::BLOCKS_IN_CHUNK>& blocks, int currentIndex)
-        : mBlocks(blocks)
-        , index(currentIndex)
+    [[nodiscard]] static constexpr std::uint8_t occupancyBit(BlockOccupancy occupancy, bool isSet)
     {
+        return isSet ? static_cast<std::uint8_t>(1u << static_cast<unsigned int>(occupancy)) : 0;
     }
 
-    bool operator!=(const ChunkBlocksIterator& other) const
+    [[nodiscard]] bool hasOccupancy(PaletteIndex index, BlockOccupancy occupancy) const
     {
-        return index != other.index;
+        return (mPaletteOccupancy[index] & occupancyBit(occupancy, true)) != 0;
     }
 
-    ChunkBlocksIterator& operator++()
+    /**
+     * \brief Sets or clears the bits of the block in the occupancy masks of a dense chunk.
+     * \param x, y, z Position of the block inside the chunk
+     * \param index Palette index of the block written there
+     */
+    void updateOccupancy(int x, int y, int z, PaletteIndex index)
     {
-        ++index;
-        return *this;
+        const auto bit = std::uint64_t{1} << x;
+        const auto row = static_cast<std::size_t>(y + z * BLOCKS_PER_Y_DIMENSION);
+        for (auto i = std::size_t{0}; i < mOccupancyRows.size(); ++i)
+        {
+            auto& rowMask = mOccupancyRows[i][row];
+            rowMask = hasOccupancy(index, static_cast<BlockOccupancy>(i)) ? (rowMask | bit)
+                                                                          : (rowMask & ~bit);
+        }
     }
 
-    std::tuple<Block::Coordinate, Block&> operator*() const
+    /**
+     * \brief Replaces the block at the given position, expanding the uniform chunk if needed.
+     * \param x, y, z Position of the block inside the chunk
+     * \param blockId Identifier of the new block type
+     */
+    void setBlockAt(int x, int y, int z, BlockId blockId)
     {
-        auto z =
-            index / (ChunkBlocks::BLOCKS_PER_X_DIMENSION * ChunkBlocks::BLOCKS_PER_Y_DIMENSION);
-        auto y =
-            (index / ChunkBlocks::BLOCKS_PER_X_DIMENSION) % ChunkBlocks::BLOCKS_PER_Y_DIMENSION;
-        auto x = index % ChunkBlocks::BLOCKS_PER_X_DIMENSION;
-        Block::Coordinate position{x, y, z};
-        return {position, mBlocks[index]};
+        const auto newIndex = paletteIndex(blockId);
+        if (isUniform())
+        {
+            if (newIndex == mUniformIndex)
+            {
+                return;
+            }
+            expandUniformState();
+        }
+        mIndices[index(x, y, z)] = newIndex;
+        updateOccupancy(x, y, z, newIndex);
+    }
+
+    /**
+     * \brief Allocates the per-voxel indices and the occupancy masks of a uniform chunk, all
+     * describing its block.
+     */
+    void expandUniformState()
+    {
+        mIndices.assign(BLOCKS_IN_CHUNK, mUniformIndex);
+        mOccupancyRows.resize(static_cast<std::size_t>(BlockOccupancy::Counter));
+        for (auto i = std::size_t{0}; i < mOccupancyRows.size(); ++i)
+        {
+            mOccupancyRows[i] = hasOccupancy(mUniformIndex, static_cast<BlockOccupancy>(i))
+                                    ? FULL_ROWS
+                                    : EMPTY_ROWS;
+        }
     }
 
 private:
-    std::array<Block, ChunkBlocks::BLOCKS_IN_CHUNK>& mBlocks;
-    int index{0};
+    static constexpr auto NOT_IN_PALETTE = std::numeric_limits<PaletteIndex>::max();
+
+    std::vector<Block> mPalette;
+    std::array<PaletteIndex, MAX_PALETTE_SIZE> mPaletteLookup;
+    std::array<std::uint8_t, MAX_PALETTE_SIZE> mPaletteOccupancy{};
+    std::vector<PaletteIndex> mIndices;
+    std::vector<RowMasks> mOccupancyRows;
+    PaletteIndex mUniformIndex{0};
 };
 
+inline constexpr int CHUNK_BLOCKS_PER_DIMENSION = BLOCK_PER_DIMENSION_IN_CHUNK;
+
+/**
+ * \brief Layout of the blocks of all chunks of the game. Rows along the x axis are contiguous
+ * unless USE_MORTON_CHUNK_BLOCKS is defined in constants.h.
+ */
+#ifdef USE_MORTON_CHUNK_BLOCKS
+using ChunkBlocksLayout = MortonChunkBlocksLayout<CHUNK_BLOCKS_PER_DIMENSION>;
+#else
+using ChunkBlocksLayout = LinearChunkBlocksLayout<CHUNK_BLOCKS_PER_DIMENSION>;
+#endif
+
+/**
+ * \brief Blocks of a chunk of the game, see BasicChunkBlocks.
+ */
+class ChunkBlocks : public BasicChunkBlocks<ChunkBlocksLayout>
+{
+};
+
+/**
+ * \brief Blocks stored along the Morton curve regardless of the layout chosen for the game.
+ */
+using MortonChunkBlocks = BasicChunkBlocks<MortonChunkBlocksLayout<CHUNK_BLOCKS_PER_DIMENSION>>;
+
+template<typename Layout>
 class ConstChunkBlocksIterator
 {
 public:
-    ConstChunkBlocksIterator(const std::array<Block, ChunkBlocks::BLOCKS_IN_CHUNK>& blocks,
-                             int currentIndex)
+    ConstChunkBlocksIterator(const BasicChunkBlocks<Layout>& blocks, int currentIndex)
         : mBlocks(blocks)
         , index(currentIndex)
     {
@@ -122,17 +441,12 @@ public:
 
     std::tuple<Block::Coordinate, const Block&> operator*() const
     {
-        auto z =
-            index / (ChunkBlocks::BLOCKS_PER_X_DIMENSION * ChunkBlocks::BLOCKS_PER_Y_DIMENSION);
-        auto y =
-            (index / ChunkBlocks::BLOCKS_PER_X_DIMENSION) % ChunkBlocks::BLOCKS_PER_Y_DIMENSION;
-        auto x = index % ChunkBlocks::BLOCKS_PER_X_DIMENSION;
-        Block::Coordinate position{x, y, z};
-        return {position, mBlocks[index]};
+        const auto position = Layout::position(index);
+        return {Block::Coordinate{position.x, position.y, position.z}, mBlocks.blockAtIndex(index)};
     }
 
 private:
-    const std::array<Block, ChunkBlocks::BLOCKS_IN_CHUNK>& mBlocks;
+    const BasicChunkBlocks<Layout>& mBlocks;
     int index{0};
 };
 
@@ -161,7 +475,8 @@ private:
     using ChunkBlocks = MultiDimensionalArray<Block, BLOCKS_PER_X_DIMENSION, BLOCKS_PER_Y_DIMENSION,
                                               BLOCKS_PER_Z_DIMENSION>;
 
-    ChunkBlocks mBlocks;
+    // Value-initialized to zeroes, which are air blocks
+    ChunkBlocks mBlocks{};
 };
 
-}// namespace Voxino
\ No newline at end of file
+}// namespace Voxino
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <glm/vec3.hpp>
+
+namespace Voxino
+{
+
+/**
+ * \brief Order in which the blocks of a cubic chunk are stored, row after row along the x axis.
+ *
+ * The rows along the x axis are contiguous, so bit masks of whole rows are built with a single
+ * sweep. Neighbours along the y and z axis lie a row or a whole layer away.
+ * \tparam Size Number of blocks along every dimension of the chunk
+ */
+template<int Size>
+class LinearChunkBlocksLayout
+{
+public:
+    static constexpr auto BLOCKS_PER_DIMENSION = Size;
+    static constexpr auto HAS_CONTIGUOUS_ROWS = true;
+    static constexpr auto HAS_CONTIGUOUS_CUBES = false;
+
+    /**
+     * \brief Returns the index under which the block is stored.
+     * \param x, y, z Position of the block inside the chunk
+     * \return Index of the block
+     */
+    [[nodiscard]] static constexpr int index(int x, int y, int z)
+    {
+        return (z * Size * Size) + (y * Size) + x;
+    }
+
+    /**
+     * \brief Returns the position of the block stored under the given index.
+     * \param index Index of the block
+     * \return Position of the block inside the chunk
+     */
+    [[nodiscard]] static constexpr glm::ivec3 position(int index)
+    {
+        return {index % Size, (index / Size) % Size, index / (Size * Size)};
+    }
+};
+
+/**
+ * \brief Order in which the blocks of a cubic chunk are stored along the Morton (Z-order) curve.
+ *
+ * The bits of the x, y and z coordinates are interleaved, so every aligned cube of a power of two
+ * size, like an octant of an octree, is stored contiguously and the direct neighbours of a block
+ * usually lie on the same cache line. Rows along any axis are scattered.
+ *
+ * Both directions are done with lookup tables. Encoding takes one lookup per coordinate, decoding
+ * one lookup per group of nine bits of the index.
+ * \tparam Size Number of blocks along every dimension of the chunk, a power of two up to 64
+ */
+template<int Size>
+class MortonChunkBlocksLayout
+{
+    static_assert(std::has_single_bit(static_cast<unsigned int>(Size)) && Size <= 64,
+                  "Morton layout requires a power of two size of up to 64 blocks");
+
+public:
+    static constexpr auto BLOCKS_PER_DIMENSION = Size;
+    static constexpr auto HAS_CONTIGUOUS_ROWS = false;
+    static constexpr auto HAS_CONTIGUOUS_CUBES = true;
+
+    /**
+     * \brief Returns the index under which the block is stored.
+     * \param x, y, z Position of the block inside the chunk
+     * \return Index of the block
+     */
+    [[nodiscard]] static constexpr int index(int x, int y, int z)
+    {
+        return static_cast<int>(SPREAD_BITS[x] | (SPREAD_BITS[y] << 1) | (SPREAD_BITS[z] << 2));
+    }
+
+    /**
+     * \brief Returns the position of the block stored under the given index.
+     * \param index Index of the block
+     * \return Position of the block inside the chunk
+     */
+    [[nodiscard]] static constexpr glm::ivec3 position(int index)
+    {
+        constexpr auto groupMask = (1 << BITS_PER_GROUP) - 1;
+        const auto lower = COMPACTED_BITS[index & groupMask];
+        const auto upper = COMPACTED_BITS[(index >> BITS_PER_GROUP) & groupMask];
+        const auto x = (lower & 0x7) | ((upper & 0x7) << 3);
+        const auto y = ((lower >> 3) & 0x7) | (((upper >> 3) & 0x7) << 3);
+        const auto z = (lower >> 6) | ((upper >> 6) << 3);
+        return {x, y, z};
+    }
+
+private:
+    static constexpr auto BITS_PER_GROUP = 9;
+
+    // Bit i of a coordinate moves to bit 3 * i of the index
+    static constexpr auto SPREAD_BITS = []
+    {
+        std::array<std::uint32_t, 64> spread{};
+        for (auto value = 0u; value < spread.size(); ++value)
+        {
+            for (auto bit = 0u; bit < 6; ++bit)
+            {
+                spread[value] |= ((value >> bit) & 1u) << (3 * bit);
+            }
+        }
+        return spread;
+    }();
+
+    // Nine interleaved bits of the index, compacted into three bits of x, y and z each
+    static constexpr auto COMPACTED_BITS = []
+    {
+        std::array<std::uint16_t, 1 << BITS_PER_GROUP> compacted{};
+        for (auto group = 0u; group < compacted.size(); ++group)
+        {
+            for (auto bit = 0u; bit < BITS_PER_GROUP; ++bit)
+            {
+                const auto axis = bit % 3;
+                const auto axisBit = bit / 3;
+                compacted[group] |= ((group >> bit) & 1u) << (3 * axis + axisBit);
+            }
+        }
+        return compacted;
+    }();
+};
+
+}// namespace Voxino
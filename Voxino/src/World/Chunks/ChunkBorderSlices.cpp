@@ -0,0 +1,142 @@
+#include "ChunkBorderSlices.h"
+#include "pch.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto LAST_BLOCK = SIZE - 1;
+constexpr auto FULL_ROW = (SIZE == 64) ? ~ChunkBorderSlices::Row{0}
+                                       : (ChunkBorderSlices::Row{1} << (SIZE % 64)) - 1;
+constexpr auto FACES = std::array{Direction::Above,      Direction::Below,
+                                  Direction::ToTheLeft,  Direction::ToTheRight,
+                                  Direction::InFront,    Direction::Behind};
+}// namespace
+
+ChunkBorderSlices::ChunkBorderSlices(const ChunkBlocks& blocks)
+{
+    rebuild(blocks);
+}
+
+std::vector<Direction> ChunkBorderSlices::rebuild(const ChunkBlocks& blocks)
+{
+    std::vector<Direction> changedFaces;
+    for (auto face: FACES)
+    {
+        auto newSlice = computeSlice(blocks, face);
+        auto& currentSlice = mSlices[faceIndex(face)];
+        if (newSlice != currentSlice)
+        {
+            currentSlice = newSlice;
+            ++mVersions[faceIndex(face)];
+            changedFaces.push_back(face);
+        }
+    }
+    return changedFaces;
+}
+
+std::vector<Direction> ChunkBorderSlices::updateBlock(const Block::Coordinate& localCoordinates,
+                                                      const Block& block)
+{
+    std::vector<Direction> changedFaces;
+    for (auto face: FACES)
+    {
+        const auto [row, bit] = rowAndBit(face, localCoordinates);
+        const auto blockOnFace = ChunkBorderSlices::localCoordinates(face, row, bit);
+        if (blockOnFace.x != localCoordinates.x || blockOnFace.y != localCoordinates.y ||
+            blockOnFace.z != localCoordinates.z)
+        {
+            continue;
+        }
+
+        auto& sliceRow = mSlices[faceIndex(face)][row];
+        const auto previousRow = sliceRow;
+        const auto mask = Row{1} << bit;
+        sliceRow = block.isTransparent() ? (sliceRow & ~mask) : (sliceRow | mask);
+        if (sliceRow != previousRow)
+        {
+            ++mVersions[faceIndex(face)];
+            changedFaces.push_back(face);
+        }
+    }
+    return changedFaces;
+}
+
+const ChunkBorderSlices::Slice& ChunkBorderSlices::slice(Direction face) const
+{
+    return mSlices[faceIndex(face)];
+}
+
+ChunkBorderSlices::Version ChunkBorderSlices::version(Direction face) const
+{
+    return mVersions[faceIndex(face)];
+}
+
+const ChunkBorderSlices::Versions& ChunkBorderSlices::versions() const
+{
+    return mVersions;
+}
+
+std::pair<int, int> ChunkBorderSlices::rowAndBit(Direction face,
+                                                 const Block::Coordinate& localCoordinates)
+{
+    switch (face)
+    {
+        case Direction::ToTheLeft:
+        case Direction::ToTheRight: return {localCoordinates.y, localCoordinates.z};
+        case Direction::Below:
+        case Direction::Above: return {localCoordinates.z, localCoordinates.x};
+        case Direction::Behind:
+        case Direction::InFront: return {localCoordinates.y, localCoordinates.x};
+        default: throw std::runtime_error("Unsupported Direction value was provided");
+    }
+}
+
+Block::Coordinate ChunkBorderSlices::localCoordinates(Direction face, int row, int bit)
+{
+    switch (face)
+    {
+        case Direction::ToTheLeft: return {0, row, bit};
+        case Direction::ToTheRight: return {LAST_BLOCK, row, bit};
+        case Direction::Below: return {bit, 0, row};
+        case Direction::Above: return {bit, LAST_BLOCK, row};
+        case Direction::Behind: return {bit, row, 0};
+        case Direction::InFront: return {bit, row, LAST_BLOCK};
+        default: throw std::runtime_error("Unsupported Direction value was provided");
+    }
+}
+
+std::size_t ChunkBorderSlices::faceIndex(Direction face)
+{
+    if (face == Direction::None || face == Direction::Counter)
+    {
+        throw std::runtime_error("Unsupported Direction value was provided");
+    }
+    return static_cast<std::size_t>(face) - 1;
+}
+
+ChunkBorderSlices::Slice ChunkBorderSlices::computeSlice(const ChunkBlocks& blocks, Direction face)
+{
+    Slice slice{};
+    if (blocks.isUniform())
+    {
+        slice.fill(blocks.uniformBlock().isTransparent() ? Row{0} : FULL_ROW);
+        return slice;
+    }
+
+    for (auto row = 0; row < SIZE; ++row)
+    {
+        for (auto bit = 0; bit < SIZE; ++bit)
+        {
+            if (not blocks.block(localCoordinates(face, row, bit)).isTransparent())
+            {
+                slice[row] |= Row{1} << bit;
+            }
+        }
+    }
+    return slice;
+}
+
+}// namespace Voxino
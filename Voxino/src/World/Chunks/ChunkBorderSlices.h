@@ -0,0 +1,127 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkBlocks.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Voxino
+{
+
+/**
+ * \brief Occupancy of the six outermost layers of blocks of a chunk, one bit per block.
+ *
+ * Neighbouring chunks only need to know whether the blocks touching them are opaque, so each face
+ * of the chunk is published as a compact slice of bits instead of the blocks themselves. A set bit
+ * means that the block hides the face of the block lying next to it in the neighbouring chunk.
+ *
+ * Rows and bits of the slices are laid out the same way as the columns of the binary greedy
+ * mesher, so the slices can be copied into it directly:
+ * - ToTheLeft and ToTheRight faces: row y, bit z
+ * - Below and Above faces: row z, bit x
+ * - Behind and InFront faces: row y, bit x
+ *
+ * Every slice has a version that changes whenever the slice changes, so it is cheap to find out
+ * which neighbours have to be remeshed after the blocks of the chunk were modified.
+ */
+class ChunkBorderSlices
+{
+public:
+    using Row = std::uint64_t;
+    using Slice = std::array<Row, ChunkBlocks::BLOCKS_PER_DIMENSION>;
+    using Version = std::uint32_t;
+    static constexpr auto NUMBER_OF_FACES = static_cast<std::size_t>(Direction::Counter) - 1;
+    using Versions = std::array<Version, NUMBER_OF_FACES>;
+    static_assert(ChunkBlocks::BLOCKS_PER_DIMENSION <= 64,
+                  "Every row of the slice must fit into 64 bits");
+
+    ChunkBorderSlices() = default;
+
+    /**
+     * \brief Creates slices of the given blocks.
+     * \param blocks Blocks of the chunk
+     */
+    explicit ChunkBorderSlices(const ChunkBlocks& blocks);
+
+    /**
+     * \brief Builds all slices from scratch.
+     * \param blocks Blocks of the chunk
+     * \return Faces whose slices have changed
+     */
+    std::vector<Direction> rebuild(const ChunkBlocks& blocks);
+
+    /**
+     * \brief Updates the slices after a single block of the chunk has changed.
+     * \param localCoordinates Coordinates of the changed block relative to the chunk
+     * \param block New block at these coordinates
+     * \return Faces whose slices have changed. Empty if the block does not lie on any face or its
+     * opacity has not changed.
+     */
+    std::vector<Direction> updateBlock(const Block::Coordinate& localCoordinates,
+                                       const Block& block);
+
+    /**
+     * \brief Returns the slice of the given face of the chunk.
+     * \param face Direction in which the face points
+     * \return Bits of opaque blocks lying on the face
+     */
+    [[nodiscard]] const Slice& slice(Direction face) const;
+
+    /**
+     * \brief Returns the version of the slice of the given face of the chunk.
+     * \param face Direction in which the face points
+     * \return Version which changes every time the slice changes
+     */
+    [[nodiscard]] Version version(Direction face) const;
+
+    /**
+     * \brief Returns the versions of all slices, indexed by faceIndex().
+     * \return Versions of the slices
+     */
+    [[nodiscard]] const Versions& versions() const;
+
+    /**
+     * \brief Returns the row and the bit of the slice of the face under which the block is stored.
+     * The coordinate along the normal of the face is ignored, so it works for blocks lying on
+     * either side of the face.
+     * \param face Direction in which the face points
+     * \param localCoordinates Coordinates relative to the chunk
+     * \return Row and bit of the slice
+     */
+    [[nodiscard]] static std::pair<int, int> rowAndBit(Direction face,
+                                                       const Block::Coordinate& localCoordinates);
+
+    /**
+     * \brief Returns the coordinates of the block of the chunk stored under the given row and bit.
+     * \param face Direction in which the face points
+     * \param row Row of the slice
+     * \param bit Bit of the row
+     * \return Coordinates relative to the chunk of the block lying on the face
+     */
+    [[nodiscard]] static Block::Coordinate localCoordinates(Direction face, int row, int bit);
+
+    /**
+     * \brief Returns the index of the face in the arrays of slices and versions.
+     * \param face Direction in which the face points
+     * \return Index of the face
+     */
+    [[nodiscard]] static std::size_t faceIndex(Direction face);
+
+private:
+    /**
+     * \brief Computes the slice of the face without touching the stored one.
+     * \param blocks Blocks of the chunk
+     * \param face Direction in which the face points
+     * \return Computed slice
+     */
+    [[nodiscard]] static Slice computeSlice(const ChunkBlocks& blocks, Direction face);
+
+private:
+    std::array<Slice, NUMBER_OF_FACES> mSlices{};
+    Versions mVersions{};
+};
+
+}// namespace Voxino
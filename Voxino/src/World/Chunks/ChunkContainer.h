@@ -1,9 +1,13 @@
 #pragma once
 #include "Renderer/Renderer.h"
 #include "Resources/TexturePackArray.h"
+#include "Utils/ParallelFor.h"
 #include "World/Camera.h"
 #include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/ChunkBorderSlices.h"
 #include "World/Chunks/ChunkContainerBase.h"
+#include "World/Chunks/ChunkNeighbourBorders.h"
+#include "World/Chunks/SimpleTerrainGenerator.h"
 
 namespace Voxino
 {
@@ -52,13 +56,6 @@ public:
     [[nodiscard]] const Block* worldBlock(
         const Block::Coordinate& worldBlockCoordinates) const override;
 
-    /**
-     * \brief Finds a block inside a container based on the global position of the block
-     * \param worldBlockCoordinates Global position of the block inside the game world
-     * \return Pointer to block found, or nullptr if not found
-     */
-    [[nodiscard]] Block* worldBlock(const Block::Coordinate& worldBlockCoordinates) override;
-
     /**
      * \brief Returns information about whether a block on a given position has been already created
      * \param worldBlockCoordinates World coordinates of the block
@@ -171,6 +168,53 @@ public:
      */
     std::size_t size() const override;
 
+protected:
+    /**
+     * @brief Creates chunks at the given positions using all processor cores.
+     *
+     * Terrain of all chunks is generated in parallel first. The chunks themselves are constructed
+     * on the calling thread, as their constructors may create OpenGL objects. Once all chunks, and
+     * thus all their neighbours, are inside the container, the CPU side data of every chunk is
+     * prepared in parallel, with the border slices of its neighbours at hand. Finally, the data is uploaded to
+     * the GPU one chunk after another on the calling thread, as it is the only one that can use
+     * OpenGL.
+     * @param chunkPositions Positions of the chunks to create, in blocks
+     * @param prepareChunk Prepares the CPU side data of the chunk. It is called from many threads
+     * at once, so it must not modify the container.
+     * @param uploadChunk Sends the prepared data of the chunk to the GPU
+     */
+    template<typename PrepareChunk, typename UploadChunk>
+    void createChunksInParallel(const std::vector<Block::Coordinate>& chunkPositions,
+                                const PrepareChunk& prepareChunk, const UploadChunk& uploadChunk);
+
+    /**
+     * @brief Copies the border slices of all neighbours of the chunk present in the container.
+     * @param chunk Chunk whose neighbours should be captured
+     * @return Borders of the neighbours of the chunk
+     */
+    [[nodiscard]] std::unique_ptr<ChunkNeighbourBorders> neighbourBordersOf(const ChunkType& chunk);
+
+    /**
+     * @brief Called for every neighbour of a chunk whose border slice touching the neighbour has
+     * changed, as the faces of the neighbour lying against the slice might have become visible or
+     * hidden.
+     * @param neighbour Chunk touching the changed slice
+     */
+    virtual void onNeighbourBorderChanged(const std::shared_ptr<ChunkType>& neighbour)
+    {
+    }
+
+    /**
+     * @brief Called after a block of the chunk has been removed or placed, before the neighbours
+     * are notified about the changed borders.
+     * @param chunk Chunk containing the changed block
+     * @param localCoordinates Coordinates of the changed block relative to the chunk
+     */
+    virtual void onBlockChanged(const std::shared_ptr<ChunkType>& chunk,
+                                const Block::Coordinate& localCoordinates)
+    {
+    }
+
 private:
     /**
      * \brief Based on the position of the block in the game world, it returns the chunk that
@@ -180,6 +224,15 @@ private:
     [[nodiscard]] std::shared_ptr<const ChunkType> blockPositionToChunk(
         const Block::Coordinate& worldBlockCoordinates) const;
 
+    /**
+     * @brief Notifies the neighbours of the chunk touching the border slices that have changed
+     * since the given versions were taken.
+     * @param chunk Chunk whose blocks were modified
+     * @param versionsBefore Versions of the border slices of the chunk before the modification
+     */
+    void notifyNeighboursAboutChangedBorders(const ChunkType& chunk,
+                                             const ChunkBorderSlices::Versions& versionsBefore);
+
 
 private:
     /**
@@ -189,6 +242,86 @@ private:
     const TexturePackArray& mTexturePackArray;
 };
 
+template<typename ChunkType>
+template<typename PrepareChunk, typename UploadChunk>
+void ChunkContainer<ChunkType>::createChunksInParallel(
+    const std::vector<Block::Coordinate>& chunkPositions, const PrepareChunk& prepareChunk,
+    const UploadChunk& uploadChunk)
+{
+    MEASURE_SCOPE;
+    std::vector<std::unique_ptr<ChunkBlocks>> chunksBlocks(chunkPositions.size());
+    parallelFor(chunkPositions.size(),
+                [&](std::size_t chunkIndex)
+                {
+                    auto terrainGenerator = SimpleTerrainGenerator();
+                    chunksBlocks[chunkIndex] = std::make_unique<ChunkBlocks>();
+                    terrainGenerator.generateTerrain(chunkPositions[chunkIndex],
+                                                     *chunksBlocks[chunkIndex]);
+                });
+
+    std::vector<std::shared_ptr<ChunkType>> createdChunks;
+    createdChunks.reserve(chunkPositions.size());
+    for (auto chunkIndex = std::size_t{0}; chunkIndex < chunkPositions.size(); ++chunkIndex)
+    {
+        const auto& chunkPosition = chunkPositions[chunkIndex];
+        auto newChunk = std::make_shared<ChunkType>(chunkPosition, mTexturePackArray, *this,
+                                                    std::move(chunksBlocks[chunkIndex]));
+        createdChunks.push_back(newChunk);
+        emplace(ChunkContainerBase::Coordinate::blockToChunkMetric(chunkPosition),
+                std::move(newChunk));
+    }
+
+    parallelFor(createdChunks.size(),
+                [&](std::size_t chunkIndex)
+                {
+                    auto& chunk = *createdChunks[chunkIndex];
+                    chunk.setNeighbourBorders(neighbourBordersOf(chunk));
+                    prepareChunk(chunk);
+                    chunk.setNeighbourBorders(nullptr);
+                });
+
+    for (const auto& chunk: createdChunks)
+    {
+        uploadChunk(*chunk);
+    }
+}
+
+template<typename ChunkType>
+std::unique_ptr<ChunkNeighbourBorders> ChunkContainer<ChunkType>::neighbourBordersOf(
+    const ChunkType& chunk)
+{
+    auto neighbourBorders = std::make_unique<ChunkNeighbourBorders>();
+    for (auto direction: {Direction::Behind, Direction::InFront, Direction::ToTheLeft,
+                          Direction::ToTheRight, Direction::Above, Direction::Below})
+    {
+        if (const auto chunkClose = chunkNearby(chunk, direction))
+        {
+            neighbourBorders->setBorder(direction, chunkClose->borderSlices());
+        }
+    }
+    return neighbourBorders;
+}
+
+template<typename ChunkType>
+void ChunkContainer<ChunkType>::notifyNeighboursAboutChangedBorders(
+    const ChunkType& chunk, const ChunkBorderSlices::Versions& versionsBefore)
+{
+    for (auto direction: {Direction::Behind, Direction::InFront, Direction::ToTheLeft,
+                          Direction::ToTheRight, Direction::Above, Direction::Below})
+    {
+        if (chunk.borderSlices().version(direction) ==
+            versionsBefore[ChunkBorderSlices::faceIndex(direction)])
+        {
+            continue;
+        }
+
+        if (const auto chunkClose = chunkNearby(chunk, direction))
+        {
+            onNeighbourBorderChanged(chunkClose);
+        }
+    }
+}
+
 template<typename ChunkType>
 void ChunkContainer<ChunkType>::draw(const Renderer& renderer, const Shader& shader,
                                      const Camera& camera) const
@@ -211,13 +344,6 @@ const Block* ChunkContainer<ChunkType>::worldBlock(
     return nullptr;
 }
 
-template<typename ChunkType>
-Block* ChunkContainer<ChunkType>::worldBlock(const Block::Coordinate& worldBlockCoordinates)
-{
-    return const_cast<Block*>(
-        static_cast<const ChunkContainer&>(*this).worldBlock(worldBlockCoordinates));
-}
-
 template<typename ChunkType>
 bool ChunkContainer<ChunkType>::doesWorldBlockExist(
     const Block::Coordinate& worldBlockCoordinates) const
@@ -255,27 +381,18 @@ void ChunkContainer<ChunkType>::removeWorldBlock(const Block::Coordinate& worldB
     if (const auto chunk = blockPositionToChunk(worldBlockCoordinates))
     {
         auto localCoordinates = chunk->globalToLocalCoordinates(worldBlockCoordinates);
+        const auto borderVersions = chunk->borderSlices().versions();
 
         chunk->removeLocalBlock(localCoordinates);
+        onBlockChanged(chunk, localCoordinates);
 
         /*
          * When removing a block, you may find that it is in contact with an adjacent chunk.
          * Rebuilding one chunk doesn't help, because the neighboring chunk remains in the form
          * where it assumes the block is there. This leads to a hole in the chunk. For this reason,
-         * must rebuild all chunks that are in contact with the block being removed.
+         * the chunks touching the changed border slices of the chunk must be rebuilt too.
          */
-        const auto directions =
-            chunk->directionOfBlockFacesInContactWithOtherChunk(localCoordinates);
-        for (auto& blockDirection: directions)
-        {
-            auto neighboringBlockInOtherChunk = chunk->localToGlobalCoordinates(
-                chunk->localNearbyBlockPosition(localCoordinates, blockDirection));
-
-            if (const auto neighboringChunk = blockPositionToChunk(neighboringBlockInOtherChunk))
-            {
-                // neighboringChunk->rebuildMesh(); // TODO
-            }
-        }
+        notifyNeighboursAboutChangedBorders(*chunk, borderVersions);
     }
 }
 
@@ -371,7 +488,12 @@ void ChunkContainer<ChunkType>::tryToPlaceBlock(const BlockId& id,
     if (const auto chunk = blockPositionToChunk(worldCoordinate))
     {
         auto localChunkCoordinates = chunk->globalToLocalCoordinates(worldCoordinate);
-        chunk->tryToPlaceBlock(id, localChunkCoordinates, blocksThatMightBeOverplaced);
+        const auto borderVersions = chunk->borderSlices().versions();
+        if (chunk->tryToPlaceBlock(id, localChunkCoordinates, blocksThatMightBeOverplaced))
+        {
+            onBlockChanged(chunk, localChunkCoordinates);
+        }
+        notifyNeighboursAboutChangedBorders(*chunk, borderVersions);
     }
 }
 
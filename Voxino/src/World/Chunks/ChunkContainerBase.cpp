@@ -1,4 +1,5 @@
 #include "ChunkContainerBase.h"
+#include "Utils/FloorDivide.h"
 #include "World/Chunks/ChunkBlocks.h"
 
 namespace Voxino
@@ -14,22 +15,10 @@ sf::Vector3i ChunkContainerBase::Coordinate::nonChunkMetric() const
 ChunkContainerBase::Coordinate ChunkContainerBase::Coordinate::blockToChunkMetric(
     const Block::Coordinate& worldBlockCoordinate)
 {
-
-    static auto fastFloor = [](const float& numberToFloor)
-    {
-        const auto truncated = static_cast<int>(numberToFloor);
-        return truncated - (truncated > numberToFloor);
-    };
-
-    // clang-format off
-    auto returnVar = ChunkContainerBase::Coordinate(
-        fastFloor(worldBlockCoordinate.x / static_cast<float>(ChunkBlocks::BLOCKS_PER_X_DIMENSION)),
-        fastFloor(worldBlockCoordinate.y / static_cast<float>(ChunkBlocks::BLOCKS_PER_Y_DIMENSION)),
-        fastFloor(worldBlockCoordinate.z / static_cast<float>(ChunkBlocks::BLOCKS_PER_Z_DIMENSION))
-    );
-    // clang-format on
-
-    return returnVar;
+    // Blocks below zero land in the chunk below zero as well
+    return {floorDivide(worldBlockCoordinate.x, ChunkBlocks::BLOCKS_PER_X_DIMENSION),
+            floorDivide(worldBlockCoordinate.y, ChunkBlocks::BLOCKS_PER_Y_DIMENSION),
+            floorDivide(worldBlockCoordinate.z, ChunkBlocks::BLOCKS_PER_Z_DIMENSION)};
 }
 
 }// namespace Voxino
\ No newline at end of file
@@ -62,13 +62,6 @@ public:
     [[nodiscard]] virtual const Block* worldBlock(
         const Block::Coordinate& worldBlockCoordinates) const = 0;
 
-    /**
-     * \brief Finds a block inside a container based on the global position of the block
-     * \param worldBlockCoordinates Global position of the block inside the game world
-     * \return Pointer to block found, or nullptr if not found
-     */
-    [[nodiscard]] virtual Block* worldBlock(const Block::Coordinate& worldBlockCoordinates) = 0;
-
     /**
      * \brief Returns information about whether a block on a given position has been already created
      * \param worldBlockCoordinates World coordinates of the block
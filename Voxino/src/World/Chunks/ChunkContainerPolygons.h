@@ -4,6 +4,13 @@
 #include "Utils/CoordinatesGenerator.h"
 #include "World/Camera.h"
 #include "World/Chunks/ChunkContainer.h"
+#include "World/Polygons/Chunks/ChunkLevelOfDetail.h"
+#include "World/Polygons/Chunks/ChunkMeshJobQueue.h"
+#include "World/Polygons/Chunks/IncrementalRemeshing.h"
+#include "World/Polygons/Meshes/Builders/ChunkArrayPackedMeshBuilder.h"
+#include "World/Polygons/Meshes/ChunkMeshBatch.h"
+
+#include <type_traits>
 
 namespace Voxino
 {
@@ -21,28 +28,118 @@ public:
     using Chunks = std::unordered_map<ChunkContainerBase::Coordinate, std::shared_ptr<ChunkType>,
                                       std::hash<CoordinateBase>>;
 
+    /**
+     * @brief Maximum number of meshes prepared by the mesh workers that are sent to the GPU in a
+     * single frame. The rest waits for the next frames, so the frame time stays flat even when
+     * many chunks are remeshed at once.
+     */
+    static constexpr auto MAX_MESH_UPLOADS_PER_FRAME = 4;
+
+    /**
+     * @brief Maximum number of chunks moved within the arenas in a single frame when their free
+     * space is fragmented, so defragmentation is spread over many frames.
+     */
+    static constexpr auto MAX_DEFRAGMENTATION_MOVES_PER_FRAME = 4;
+
+    /**
+     * @brief Packed meshes of all chunks are kept in shared arenas and drawn with one call per
+     * arena. They have to be drawn with the ChunkPackedBatched shader. Meshes of other formats are
+     * drawn chunk by chunk.
+     */
+    static constexpr bool IS_BATCHED =
+        std::is_same_v<typename ChunkType::MeshBuilderType, Polygons::ChunkArrayPackedMeshBuilder>;
+
+    /**
+     * @brief Coarsest level of detail of the chunks. Zero if the chunks are always meshed in full
+     * detail.
+     */
+    static constexpr int MAX_LEVEL_OF_DETAIL = []
+    {
+        if constexpr (Polygons::HasLevelsOfDetail<ChunkType>)
+        {
+            return ChunkType::MAX_LEVEL_OF_DETAIL;
+        }
+        return 0;
+    }();
+
     ChunkContainerPolygons(const TexturePackArray& texturePackArray,
                            int radius = ChunkContainerBase::CHUNK_RADIUS)
         : ChunkContainer<ChunkType>(texturePackArray)
+        , mMeshBatch(texturePackArray)
+        , mMeshJobs(texturePackArray, *this)
+        , mLevelOfDetail(MAX_LEVEL_OF_DETAIL)
     {
         MEASURE_SCOPE;
         auto center = glm::vec3(0, 0, 0);
         auto coordinates = generateLimitedCoordinatesAround3D(center, radius);
         coordinates.push_back(center);
+        std::vector<Block::Coordinate> chunkPositions;
+        chunkPositions.reserve(coordinates.size());
         for (auto coordinate: coordinates)
         {
-            auto chunkPosition =
-                Block::Coordinate(coordinate.x * ChunkBlocks::BLOCKS_PER_X_DIMENSION,
-                                  coordinate.y * ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
-                                  coordinate.z * ChunkBlocks::BLOCKS_PER_Z_DIMENSION);
-            auto newChunk = std::make_shared<ChunkType>(chunkPosition, texturePackArray, *this);
-            auto chunkCoordinates =
-                ChunkContainerBase::Coordinate::blockToChunkMetric(chunkPosition);
-            this->emplace(chunkCoordinates, std::move(newChunk));
-            this->rebuildChunksAround(chunkCoordinates);
+            chunkPositions.emplace_back(coordinate.x * ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                                        coordinate.y * ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
+                                        coordinate.z * ChunkBlocks::BLOCKS_PER_Z_DIMENSION);
         }
+        this->createChunksInParallel(
+            chunkPositions,
+            [](ChunkType& chunk)
+            {
+                chunk.prepareMesh();
+            },
+            [this](ChunkType& chunk)
+            {
+                if constexpr (IS_BATCHED)
+                {
+                    // The arena keeps the only copy on the GPU, the chunk may keep the mesh
+                    // to patch it after edits of single blocks
+                    replaceMesh(chunk, chunk.takePreparedMesh(), levelOfDetailOf(chunk));
+                }
+                else
+                {
+                    chunk.updateMesh();
+                }
+            });
     }
 
+    /**
+     * \brief Draws the terrain of all chunks in the container. Batched chunks are drawn all at
+     * once.
+     * \param renderer Renderer drawing the 3D game world onto the 2D screen
+     * \param shader Shader with the help of which the object should be drawn
+     * \param camera Camera through which the game world is viewed
+     */
+    void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const override;
+
+    /**
+     * \brief Updates the chunkcontainer logic dependent, or independent of time, every rendered
+     * frame. It also sends to the GPU up to MAX_MESH_UPLOADS_PER_FRAME meshes prepared by the mesh
+     * workers and moves up to MAX_DEFRAGMENTATION_MOVES_PER_FRAME batched meshes to defragment the
+     * arenas.
+     * \param deltaTime the time that has passed since the game was last updated.
+     */
+    void update(const float& deltaTime) override;
+
+    /**
+     * \brief Chooses the level of detail of every chunk from its distance to the camera and queues
+     * rebuilding of the chunks whose level has changed. Does nothing if the chunks have no levels
+     * of detail.
+     * \param cameraPosition Position of the camera in the game world
+     */
+    void updateLevelsOfDetail(const glm::vec3& cameraPosition);
+
+    /**
+     * \brief Updates the ImGui of the chunks and shows the usage of the mesh arenas.
+     */
+    void updateImGui() override;
+
+    /**
+     * @brief Queues rebuilding of the mesh of the given chunk on the mesh workers. The chunk keeps
+     * displaying its current mesh until the new one is uploaded in one of the next updates.
+     * @param chunk Chunk whose mesh should be rebuilt
+     */
+    void rebuildChunk(const std::shared_ptr<ChunkType>& chunk);
+
     /**
      * @brief Rebuilds chunks around a given chunk.
      * @param chunkCoordinates Coordinates chunk around which other chunks should be rebuilt.
@@ -51,6 +148,10 @@ public:
 
     int numberOfVertices() const
     {
+        if constexpr (IS_BATCHED)
+        {
+            return mMeshBatch.numberOfVertices();
+        }
         int vertices = 0;
         for (const auto& chunk: this->data())
         {
@@ -61,6 +162,10 @@ public:
 
     unsigned long memorySize() const
     {
+        if constexpr (IS_BATCHED)
+        {
+            return mMeshBatch.memorySize();
+        }
         int size = 0;
         for (const auto& [_, chunk]: this->data())
         {
@@ -69,19 +174,224 @@ public:
         return size;
     }
 
-    // void draw(const Renderer& renderer, const Shader& shader,
-    //                                  const Camera& camera) const
-    // {
-    //     // MEASURE_SCOPE_WITH_GPU;
-    //     // for (auto& [coordinate, chunk]: this->data())
-    //     // {
-    //     //     chunk->draw(renderer, shader, camera);
-    //     // }
-    //
-    //     // TODO: I could try to batch all draws here into one draw call
-    // }
+    unsigned long blocksMemorySize() const
+    {
+        unsigned long size = 0;
+        for (const auto& [_, chunk]: this->data())
+        {
+            size += chunk->blocksMemorySize();
+        }
+        return size;
+    }
+
+    /**
+     * @brief Erases the chunk with the indicated coordinates, together with its batched mesh.
+     * @param chunkCoordinate Coordinate the chunk to erase.
+     * @return Number of erased chunks
+     */
+    std::size_t erase(const ChunkContainerBase::Coordinate& chunkCoordinate) override;
+
+protected:
+    /**
+     * @brief Queues rebuilding of the neighbour, so only the side of the world where the border
+     * has actually changed is remeshed.
+     * @param neighbour Chunk touching the changed border slice
+     */
+    void onNeighbourBorderChanged(const std::shared_ptr<ChunkType>& neighbour) override;
+
+    /**
+     * @brief Remeshes the chunk right away if it can patch its displayed mesh around the changed
+     * block, so the edit is visible in the same frame. Otherwise queues rebuilding of the chunk.
+     * @param chunk Chunk containing the changed block
+     * @param localCoordinates Coordinates of the changed block relative to the chunk
+     */
+    void onBlockChanged(const std::shared_ptr<ChunkType>& chunk,
+                        const Block::Coordinate& localCoordinates) override;
+
+private:
+    /**
+     * @brief Sends to the GPU the meshes prepared by the mesh workers.
+     * @param maxNumberOfMeshes Maximum number of meshes to upload
+     */
+    void uploadFinishedMeshes(std::size_t maxNumberOfMeshes);
+
+    /**
+     * @brief Replaces the displayed mesh of the chunk, in the batch or in the chunk itself.
+     * @param chunk Chunk whose mesh is replaced
+     * @param mesh New mesh of the chunk
+     * @param levelOfDetail Level of detail the mesh was built at
+     */
+    void replaceMesh(ChunkType& chunk, std::unique_ptr<Polygons::Mesh3D> mesh, int levelOfDetail);
+
+    /**
+     * @brief Returns the current level of detail of the chunk, zero if the chunk has no levels.
+     * @param chunk Chunk to check
+     * @return Level of detail of the chunk
+     */
+    static int levelOfDetailOf(const ChunkType& chunk);
+
+private:
+    Polygons::ChunkMeshBatch mMeshBatch;
+    Polygons::ChunkMeshJobQueue<ChunkType> mMeshJobs;
+    Polygons::ChunkLevelOfDetail mLevelOfDetail;
 };
 
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::draw(const Renderer& renderer, const Shader& shader,
+                                             const Camera& camera) const
+{
+    MEASURE_SCOPE_WITH_GPU;
+    if constexpr (IS_BATCHED)
+    {
+        mMeshBatch.draw(renderer, shader, camera);
+    }
+    else
+    {
+        ChunkContainer<ChunkType>::draw(renderer, shader, camera);
+    }
+}
+
+template<typename ChunkType>
+std::size_t ChunkContainerPolygons<ChunkType>::erase(
+    const ChunkContainerBase::Coordinate& chunkCoordinate)
+{
+    if (const auto chunk = this->data().find(chunkCoordinate); chunk != this->data().end())
+    {
+        mMeshBatch.removeMesh(*chunk->second);
+        mMeshJobs.forget(*chunk->second);
+    }
+    return ChunkContainer<ChunkType>::erase(chunkCoordinate);
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::update(const float& deltaTime)
+{
+    MEASURE_SCOPE;
+    ChunkContainer<ChunkType>::update(deltaTime);
+    uploadFinishedMeshes(MAX_MESH_UPLOADS_PER_FRAME);
+    if constexpr (IS_BATCHED)
+    {
+        mMeshBatch.defragment(MAX_DEFRAGMENTATION_MOVES_PER_FRAME);
+    }
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::updateLevelsOfDetail(const glm::vec3& cameraPosition)
+{
+    MEASURE_SCOPE;
+    if constexpr (Polygons::HasLevelsOfDetail<ChunkType>)
+    {
+        const auto halfOfChunk = glm::vec3(ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                                           ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
+                                           ChunkBlocks::BLOCKS_PER_Z_DIMENSION) /
+                                 2.f;
+        for (const auto& [_, chunk]: this->data())
+        {
+            const auto chunkPosition = static_cast<glm::ivec3>(chunk->positionInBlocks());
+            const auto center = glm::vec3(chunkPosition) + halfOfChunk;
+            const auto level = mLevelOfDetail.select(glm::distance(cameraPosition, center),
+                                                     chunk->levelOfDetail());
+            if (level != chunk->levelOfDetail())
+            {
+                chunk->setLevelOfDetail(level);
+                rebuildChunk(chunk);
+            }
+        }
+    }
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::updateImGui()
+{
+    MEASURE_SCOPE;
+    ChunkContainer<ChunkType>::updateImGui();
+    if constexpr (IS_BATCHED)
+    {
+        mMeshBatch.updateImGui();
+    }
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::rebuildChunk(const std::shared_ptr<ChunkType>& chunk)
+{
+    MEASURE_SCOPE;
+    mMeshJobs.enqueue(chunk, std::make_unique<ChunkBlocks>(chunk->blocks()),
+                      this->neighbourBordersOf(*chunk));
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::onNeighbourBorderChanged(
+    const std::shared_ptr<ChunkType>& neighbour)
+{
+    rebuildChunk(neighbour);
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::onBlockChanged(const std::shared_ptr<ChunkType>& chunk,
+                                                       const Block::Coordinate& localCoordinates)
+{
+    MEASURE_SCOPE;
+    if constexpr (Polygons::HasIncrementalRemeshing<ChunkType>)
+    {
+        chunk->setNeighbourBorders(this->neighbourBordersOf(*chunk));
+        const auto isPatched = chunk->prepareMeshAround(localCoordinates);
+        chunk->setNeighbourBorders(nullptr);
+        if (isPatched)
+        {
+            // Patched meshes are always in full detail
+            replaceMesh(*chunk, chunk->takePreparedMesh(), 0);
+            // A queued job was built from the blocks before the edit, so it has to be queued again
+            if (not mMeshJobs.isPending(*chunk))
+            {
+                return;
+            }
+        }
+    }
+    rebuildChunk(chunk);
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::uploadFinishedMeshes(std::size_t maxNumberOfMeshes)
+{
+    MEASURE_SCOPE;
+    for (auto& [chunk, mesh, levelOfDetail]: mMeshJobs.takeFinishedMeshes(maxNumberOfMeshes))
+    {
+        if (const auto aliveChunk = chunk.lock())
+        {
+            replaceMesh(*aliveChunk, std::move(mesh), levelOfDetail);
+        }
+    }
+}
+
+template<typename ChunkType>
+void ChunkContainerPolygons<ChunkType>::replaceMesh(ChunkType& chunk,
+                                                    std::unique_ptr<Polygons::Mesh3D> mesh,
+                                                    [[maybe_unused]] int levelOfDetail)
+{
+    if constexpr (IS_BATCHED)
+    {
+        mMeshBatch.setMesh(chunk, static_cast<const Polygons::ChunkArrayPackedMesh&>(*mesh));
+        if constexpr (Polygons::HasIncrementalRemeshing<ChunkType>)
+        {
+            chunk.keepDisplayedMesh(std::move(mesh), levelOfDetail);
+        }
+    }
+    else
+    {
+        chunk.replaceMesh(std::move(mesh));
+    }
+}
+
+template<typename ChunkType>
+int ChunkContainerPolygons<ChunkType>::levelOfDetailOf(const ChunkType& chunk)
+{
+    if constexpr (Polygons::HasLevelsOfDetail<ChunkType>)
+    {
+        return chunk.levelOfDetail();
+    }
+    return 0;
+}
+
 
 template<typename ChunkType>
 void ChunkContainerPolygons<ChunkType>::rebuildChunksAround(
@@ -93,8 +403,7 @@ void ChunkContainerPolygons<ChunkType>::rebuildChunksAround(
     {
         if (const auto chunkClose = this->chunkNearby(*chunk, direction))
         {
-            chunkClose->rebuildMesh();
-            chunkClose->updateMesh();
+            rebuildChunk(chunkClose);
         }
     }
 }
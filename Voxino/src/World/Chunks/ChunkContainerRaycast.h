@@ -29,17 +29,24 @@ public:
         auto center = glm::vec3(0, 0, 0);
         auto coordinates = generateLimitedCoordinatesAround3D(center, radius);
         coordinates.push_back(center);
+        std::vector<Block::Coordinate> chunkPositions;
+        chunkPositions.reserve(coordinates.size());
         for (auto coordinate: coordinates)
         {
-            auto chunkPosition =
-                Block::Coordinate(coordinate.x * ChunkBlocks::BLOCKS_PER_X_DIMENSION,
-                                  coordinate.y * ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
-                                  coordinate.z * ChunkBlocks::BLOCKS_PER_Z_DIMENSION);
-            auto newChunk = std::make_shared<ChunkType>(chunkPosition, texturePackArray, *this);
-            auto chunkCoordinates =
-                ChunkContainerBase::Coordinate::blockToChunkMetric(chunkPosition);
-            this->emplace(chunkCoordinates, std::move(newChunk));
+            chunkPositions.emplace_back(coordinate.x * ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                                        coordinate.y * ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
+                                        coordinate.z * ChunkBlocks::BLOCKS_PER_Z_DIMENSION);
         }
+        this->createChunksInParallel(
+            chunkPositions,
+            [](ChunkType& chunk)
+            {
+                chunk.prepareData();
+            },
+            [](ChunkType& chunk)
+            {
+                chunk.updateData();
+            });
     }
 
     void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const
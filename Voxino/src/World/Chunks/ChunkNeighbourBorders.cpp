@@ -0,0 +1,63 @@
+#include "ChunkNeighbourBorders.h"
+#include "pch.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+}// namespace
+
+void ChunkNeighbourBorders::setBorder(Direction directionOfNeighbour,
+                                      const ChunkBorderSlices& neighbourSlices)
+{
+    const auto index = ChunkBorderSlices::faceIndex(directionOfNeighbour);
+    mBorders[index] = neighbourSlices.slice(oppositeDirection(directionOfNeighbour));
+    mIsBorderCaptured[index] = true;
+}
+
+const ChunkBorderSlices::Slice* ChunkNeighbourBorders::border(Direction directionOfNeighbour) const
+{
+    const auto index = ChunkBorderSlices::faceIndex(directionOfNeighbour);
+    return mIsBorderCaptured[index] ? &mBorders[index] : nullptr;
+}
+
+bool ChunkNeighbourBorders::isOpaque(const Block::Coordinate& localCoordinates) const
+{
+    const auto x = localCoordinates.x;
+    const auto y = localCoordinates.y;
+    const auto z = localCoordinates.z;
+    auto isInside = [](int coordinate)
+    {
+        return coordinate >= 0 && coordinate < SIZE;
+    };
+
+    auto direction = Direction::None;
+    if (isInside(y) && isInside(z) && (x == -1 || x == SIZE))
+    {
+        direction = (x == -1) ? Direction::ToTheLeft : Direction::ToTheRight;
+    }
+    else if (isInside(x) && isInside(z) && (y == -1 || y == SIZE))
+    {
+        direction = (y == -1) ? Direction::Below : Direction::Above;
+    }
+    else if (isInside(x) && isInside(y) && (z == -1 || z == SIZE))
+    {
+        direction = (z == -1) ? Direction::Behind : Direction::InFront;
+    }
+    else
+    {
+        return false;
+    }
+
+    const auto* slice = border(direction);
+    if (not slice)
+    {
+        return false;
+    }
+    const auto [row, bit] = ChunkBorderSlices::rowAndBit(direction, localCoordinates);
+    return ((*slice)[row] >> bit) & 1;
+}
+
+}// namespace Voxino
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkBorderSlices.h"
+
+namespace Voxino
+{
+
+/**
+ * \brief Copy of the border slices of the neighbouring chunks that touch the faces of a chunk.
+ *
+ * For each of the six directions it keeps the slice of the neighbouring chunk that lies right
+ * behind the face of the chunk. This is all the mesher needs to know about the neighbours, so a
+ * chunk can be meshed on another thread without looking into the container, which might be
+ * modified in the meantime.
+ */
+class ChunkNeighbourBorders
+{
+public:
+    /**
+     * \brief Copies the slice of the neighbouring chunk that touches the chunk.
+     * \param directionOfNeighbour Direction in which the neighbour lies, seen from the chunk
+     * \param neighbourSlices Border slices of the neighbouring chunk
+     */
+    void setBorder(Direction directionOfNeighbour, const ChunkBorderSlices& neighbourSlices);
+
+    /**
+     * \brief Returns the slice of the neighbour lying in the given direction. Its rows and bits
+     * are laid out like the slice of the face of the chunk pointing in that direction.
+     * \param directionOfNeighbour Direction in which the neighbour lies, seen from the chunk
+     * \return Slice of the neighbour, or nullptr if the neighbour was not captured
+     */
+    [[nodiscard]] const ChunkBorderSlices::Slice* border(Direction directionOfNeighbour) const;
+
+    /**
+     * \brief Checks whether the block of a neighbouring chunk lying right behind the face of the
+     * chunk is opaque.
+     * \param localCoordinates Coordinates relative to the chunk, one block outside of it
+     * \return True if the neighbour was captured and its block is opaque, false otherwise. Blocks
+     * touching the chunk only by an edge or a corner are never captured.
+     */
+    [[nodiscard]] bool isOpaque(const Block::Coordinate& localCoordinates) const;
+
+private:
+    std::array<ChunkBorderSlices::Slice, ChunkBorderSlices::NUMBER_OF_FACES> mBorders{};
+    std::array<bool, ChunkBorderSlices::NUMBER_OF_FACES> mIsBorderCaptured{};
+};
+
+}// namespace Voxino
@@ -2,13 +2,42 @@
 #include "Chunk.h"
 #include "pch.h"
 
+#include <deque>
+#include <mutex>
+
 namespace Voxino
 {
+
+namespace
+{
+struct HeightmapKey
+{
+    int seed;
+    int x;
+    int z;
+
+    bool operator==(const HeightmapKey& rhs) const = default;
+};
+
+struct HeightmapKeyHash
+{
+    std::size_t operator()(const HeightmapKey& key) const
+    {
+        auto hash = std::hash<int>()(key.seed);
+        hash ^= std::hash<int>()(key.x) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<int>()(key.z) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+}// namespace
+
 SimpleTerrainGenerator::SimpleTerrainGenerator(int seed)
-    : mBasicTerrain(seed)
+    : mSeed(seed)
+    , mBasicTerrain(seed)
+    , mBatchedBasicTerrain(seed, BASIC_TERRAIN_FREQUENCY)
 {
     mBasicTerrain.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-    mBasicTerrain.SetFrequency(0.01);
+    mBasicTerrain.SetFrequency(BASIC_TERRAIN_FREQUENCY);
     mBasicTerrain.SetFractalGain(0);
     mBasicTerrain.SetFractalLacunarity(0.f);
     mBasicTerrain.SetFractalOctaves(1);
@@ -17,11 +46,33 @@ SimpleTerrainGenerator::SimpleTerrainGenerator(int seed)
 
 void SimpleTerrainGenerator::generateTerrain(Chunk& chunk, ChunkBlocks& chunkBlocks)
 {
-    generateTerrainForChunk(chunk, chunkBlocks);
+    generateTerrain(chunk.positionInBlocks(), chunkBlocks);
 }
 
+void SimpleTerrainGenerator::generateTerrain(const Block::Coordinate& chunkPosition,
+                                             ChunkBlocks& chunkBlocks)
+{
+    MEASURE_SCOPE;
+    if (const auto uniformBlock = uniformBlockOfChunk(chunkPosition))
+    {
+        chunkBlocks.fill(*uniformBlock);
+        return;
+    }
+
+    const auto chunkHeightmap = heightmap(chunkPosition);
+    const auto globalCoordinateY = lowestColumnLevel(chunkPosition);
+    for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
+    {
+        for (auto x = 0; x < ChunkBlocks::BLOCKS_PER_X_DIMENSION; ++x)
+        {
+            const auto surfaceLevel = (*chunkHeightmap)[z * ChunkBlocks::BLOCKS_PER_X_DIMENSION + x];
+            generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, globalCoordinateY, z);
+        }
+    }
+}
 
-void SimpleTerrainGenerator::generateTerrainForChunk(const Chunk& chunk, ChunkBlocks& chunkBlocks)
+void SimpleTerrainGenerator::generateTerrainVoxelByVoxel(const Block::Coordinate& chunkPosition,
+                                                         ChunkBlocks& chunkBlocks)
 {
     for (auto x = 0; x < ChunkBlocks::BLOCKS_PER_X_DIMENSION; ++x)
     {
@@ -29,28 +80,98 @@ void SimpleTerrainGenerator::generateTerrainForChunk(const Chunk& chunk, ChunkBl
         {
             for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
             {
-                auto globalCoord = chunk.localToGlobalCoordinates({x, y, z});
+                auto globalCoord = chunkPosition + Block::Coordinate{x, y, z};
                 auto surfaceLevel = surfaceLevelAtGivenPosition(globalCoord.x, globalCoord.z);
-                generateColumnOfBlocks(chunkBlocks, surfaceLevel, x, globalCoord.y, z);
+                generateColumnOfBlocksVoxelByVoxel(chunkBlocks, surfaceLevel, x, globalCoord.y, z);
             }
         }
     }
 }
 
+std::shared_ptr<const SimpleTerrainGenerator::Heightmap> SimpleTerrainGenerator::heightmap(
+    const Block::Coordinate& chunkPosition)
+{
+    static std::mutex cacheMutex;
+    static std::unordered_map<HeightmapKey, std::shared_ptr<const Heightmap>, HeightmapKeyHash>
+        cache;
+    static std::deque<HeightmapKey> insertionOrder;
+
+    const auto key = HeightmapKey{mSeed, chunkPosition.x, chunkPosition.z};
+    {
+        std::lock_guard lock(cacheMutex);
+        if (const auto foundHeightmap = cache.find(key); foundHeightmap != cache.end())
+        {
+            return foundHeightmap->second;
+        }
+    }
+
+    // Sampling is done outside the lock. At worst two chunks of the same column generate the
+    // same heightmap, and only one of them is kept.
+    auto generatedHeightmap = std::make_shared<const Heightmap>(generateHeightmap(chunkPosition));
+
+    std::lock_guard lock(cacheMutex);
+    const auto [insertedHeightmap, wasInserted] = cache.emplace(key, generatedHeightmap);
+    if (wasInserted)
+    {
+        insertionOrder.push_back(key);
+        if (insertionOrder.size() > MAX_CACHED_HEIGHTMAPS)
+        {
+            cache.erase(insertionOrder.front());
+            insertionOrder.pop_front();
+        }
+    }
+    return insertedHeightmap->second;
+}
+
+SimpleTerrainGenerator::Heightmap SimpleTerrainGenerator::generateHeightmap(
+    const Block::Coordinate& chunkPosition)
+{
+    MEASURE_SCOPE;
+    std::array<float, std::tuple_size_v<Heightmap>> basicTerrainNoise;
+    mBatchedBasicTerrain.fillGrid(basicTerrainNoise, chunkPosition.x, chunkPosition.z,
+                                  ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                                  ChunkBlocks::BLOCKS_PER_Z_DIMENSION);
+
+    Heightmap generatedHeightmap;
+    std::ranges::transform(basicTerrainNoise, generatedHeightmap.begin(), surfaceLevelForNoise);
+    return generatedHeightmap;
+}
+
 int SimpleTerrainGenerator::surfaceLevelAtGivenPosition(int blockCoordinateX, int blockCoordinateZ)
 {
     auto basicTerrainNoise = mBasicTerrain.GetNoise(static_cast<float>(blockCoordinateX),
                                                     static_cast<float>(blockCoordinateZ));
 
-    auto heightOfBlocks = (basicTerrainNoise * BASIC_TERRAIN_SQUASHING_FACTOR);
+    return surfaceLevelForNoise(basicTerrainNoise);
+}
 
-    heightOfBlocks = (heightOfBlocks + 1 + BASIC_TERRAIN_SQUASHING_FACTOR) /
-                     (1 + BASIC_TERRAIN_SQUASHING_FACTOR + 1 + BASIC_TERRAIN_SQUASHING_FACTOR);
+int SimpleTerrainGenerator::lowestColumnLevel(const Block::Coordinate& chunkPosition)
+{
+    // The voxel by voxel generation regenerated every column for each local y, so the column
+    // generated last, based at the topmost local row, is the one that remained in the chunk.
+    // It is kept this way so the terrain stays the same.
+    return chunkPosition.y + ChunkBlocks::BLOCKS_PER_Y_DIMENSION - 1;
+}
+
+std::optional<BlockId> SimpleTerrainGenerator::uniformBlockOfChunk(
+    const Block::Coordinate& chunkPosition)
+{
+    const auto lowestGlobalY = lowestColumnLevel(chunkPosition);
+    const auto highestGlobalY = lowestGlobalY + ChunkBlocks::BLOCKS_PER_Y_DIMENSION - 1;
 
-    auto surfaceLevel = static_cast<int>(
-        ((heightOfBlocks) * (MAX_HEIGHT_MAP - MINIMAL_TERRAIN_LEVEL)) + MINIMAL_TERRAIN_LEVEL);
+    constexpr auto minSurfaceLevel = surfaceLevelForNoise(-1.f) - SURFACE_LEVEL_MARGIN;
+    constexpr auto maxSurfaceLevel = surfaceLevelForNoise(1.f) + SURFACE_LEVEL_MARGIN;
 
-    return surfaceLevel;
+    // The surface cannot cross the chunk, so no grass, dirt, sand or water can appear in it
+    if (lowestGlobalY > maxSurfaceLevel + 1 && lowestGlobalY >= SEA_LEVEL)
+    {
+        return BlockId::Air;
+    }
+    if (highestGlobalY < minSurfaceLevel - 5)
+    {
+        return BlockId::Stone;
+    }
+    return std::nullopt;
 }
 
 void SimpleTerrainGenerator::generateColumnOfBlocks(ChunkBlocks& chunkBlocks, int surfaceLevel,
@@ -60,38 +181,80 @@ void SimpleTerrainGenerator::generateColumnOfBlocks(ChunkBlocks& chunkBlocks, in
     auto& x = blockCoordinateX;
     auto& z = blockCoordinateZ;
 
+    // Fills the blocks between the given global heights, clipped to the chunk
+    auto fillSpan = [&](int beginGlobalY, int endGlobalY, BlockId blockId)
+    {
+        const auto beginY = std::max(beginGlobalY - globalCoordinateY, 0);
+        const auto endY =
+            std::min(endGlobalY - globalCoordinateY, ChunkBlocks::BLOCKS_PER_Y_DIMENSION);
+        chunkBlocks.setColumnSpan(x, z, beginY, endY, blockId);
+    };
+
+    const auto lowestLevel = globalCoordinateY;
+    const auto highestLevel = globalCoordinateY + ChunkBlocks::BLOCKS_PER_Y_DIMENSION;
+
+    fillSpan(lowestLevel, surfaceLevel - 5, BlockId::Stone);
+    fillSpan(surfaceLevel - 5, surfaceLevel, BlockId::Dirt);
+
+    // Sand lies directly above the surface, if it is not above the sea level. It also turns the
+    // grass below it into sand, but only if that grass is in the same chunk.
+    const auto sandLevel = surfaceLevel + 1;
+    const auto isSandPresent = sandLevel < SEA_LEVEL + 1 && sandLevel >= lowestLevel &&
+                               sandLevel < highestLevel;
+    const auto isGrassTurnedIntoSand = isSandPresent && surfaceLevel >= lowestLevel;
+    fillSpan(surfaceLevel, surfaceLevel + 1, isGrassTurnedIntoSand ? BlockId::Sand : BlockId::Grass);
+
+    auto waterLevel = surfaceLevel + 1;
+    if (sandLevel < SEA_LEVEL + 1)
+    {
+        fillSpan(sandLevel, sandLevel + 1, BlockId::Sand);
+        waterLevel = sandLevel + 1;
+    }
+    fillSpan(waterLevel, SEA_LEVEL, BlockId::Water);
+    fillSpan(std::max(waterLevel, SEA_LEVEL), highestLevel, BlockId::Air);
+}
+
+void SimpleTerrainGenerator::generateColumnOfBlocksVoxelByVoxel(ChunkBlocks& chunkBlocks,
+                                                                int surfaceLevel,
+                                                                int blockCoordinateX,
+                                                                int globalCoordinateY,
+                                                                int blockCoordinateZ)
+{
+    auto& x = blockCoordinateX;
+    auto& z = blockCoordinateZ;
+
     for (auto y = 0; y < ChunkBlocks::BLOCKS_PER_Y_DIMENSION; ++y)
     {
         auto globalY = globalCoordinateY + y;
         if (globalY == surfaceLevel)
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Grass);
+            chunkBlocks.setBlock(x, y, z, BlockId::Grass);
         }
         else if (globalY < surfaceLevel - 5)
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Stone);
+            chunkBlocks.setBlock(x, y, z, BlockId::Stone);
         }
         else if (globalY < surfaceLevel)
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Dirt);
+            chunkBlocks.setBlock(x, y, z, BlockId::Dirt);
         }
         else if (globalY < SEA_LEVEL + 1 && globalY < surfaceLevel + 2)
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Sand);
+            chunkBlocks.setBlock(x, y, z, BlockId::Sand);
 
             // TODO: Change it to more sophisticated system
             if (chunkBlocks.block(x, y - 1, z).id() == BlockId::Grass)
             {
-                chunkBlocks.block(x, y - 1, z).setBlockType(BlockId::Sand);
+                chunkBlocks.setBlock(x, y - 1, z, BlockId::Sand);
             }
         }
         else if (globalY < SEA_LEVEL)
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Water);
+            chunkBlocks.setBlock(x, y, z, BlockId::Water);
         }
         else
         {
-            chunkBlocks.block(x, y, z).setBlockType(BlockId::Air);
+            chunkBlocks.setBlock(x, y, z, BlockId::Air);
         }
     }
 }
@@ -105,4 +268,4 @@ int SimpleTerrainGenerator::randomSeed()
     return uniformDist(e1);
 }
 
-}// namespace Voxino
\ No newline at end of file
+}// namespace Voxino
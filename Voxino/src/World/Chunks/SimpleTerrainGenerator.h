@@ -1,7 +1,10 @@
 #pragma once
 #include "ChunkContainerBase.h"
+#include "Utils/BatchedOpenSimplex2Noise.h"
 #include "World/Chunks/ChunkBlocks.h"
 
+#include <optional>
+
 namespace Voxino
 {
 class Chunk;
@@ -14,6 +17,12 @@ public:
     static constexpr auto SEA_LEVEL = static_cast<int>(MAX_HEIGHT_MAP / 3.f);
     static constexpr auto MINIMAL_TERRAIN_LEVEL = static_cast<int>(MAX_HEIGHT_MAP / 4.f);
 
+    /**
+     * \brief Surface levels of all block columns of a chunk, indexed by z * X_DIMENSION + x.
+     */
+    using Heightmap =
+        std::array<int, ChunkBlocks::BLOCKS_PER_X_DIMENSION * ChunkBlocks::BLOCKS_PER_Z_DIMENSION>;
+
     /**
      * @brief Generates terrain for a given chunk with a given set of blocks
      * @param chunk Reference to the chunk on which the terrain is to be generated
@@ -21,6 +30,32 @@ public:
      */
     void generateTerrain(Chunk& chunk, ChunkBlocks& chunkBlocks);
 
+    /**
+     * @brief Generates terrain for a chunk placed at the given position
+     * @param chunkPosition Position of the chunk in the world, in blocks
+     * @param chunkBlocks Collection of blocks of given chunk
+     */
+    void generateTerrain(const Block::Coordinate& chunkPosition, ChunkBlocks& chunkBlocks);
+
+    /**
+     * @brief Generates terrain the way it was done before heightmaps were introduced: every voxel
+     * samples the noise and regenerates its whole column.
+     *
+     * It is very slow and is kept only as a reference for tests and benchmarks.
+     * @param chunkPosition Position of the chunk in the world, in blocks
+     * @param chunkBlocks Collection of blocks of given chunk
+     */
+    void generateTerrainVoxelByVoxel(const Block::Coordinate& chunkPosition,
+                                     ChunkBlocks& chunkBlocks);
+
+    /**
+     * @brief Returns the heightmap of the column of chunks at the given position. Heightmaps are
+     * cached, so vertically stacked chunks sample the noise only once.
+     * @param chunkPosition Position of any chunk of the column, in blocks
+     * @return Heightmap of the chunk column
+     */
+    std::shared_ptr<const Heightmap> heightmap(const Block::Coordinate& chunkPosition);
+
     /**
      * @brief Returns a random seed that can be used to generate terrain
      * @return Random int value
@@ -29,22 +64,84 @@ public:
 
 private:
     static constexpr auto BASIC_TERRAIN_SQUASHING_FACTOR = 0.25f;
+    static constexpr auto BASIC_TERRAIN_FREQUENCY = 0.01f;
 
     /**
-     * @brief Generates terrain on the indicated chunk using the indicated biome.
-     * @param chunk Chunk on which the site is to be created.
-     * @param chunkBlocks Chunk blocks that are overwritten thus creating terrain.
+     * Maximum number of chunk column heightmaps kept in the cache shared by all generators.
      */
-    void generateTerrainForChunk(const Chunk& chunk, ChunkBlocks& chunkBlocks);
+    static constexpr auto MAX_CACHED_HEIGHTMAPS = 256;
+
+    /**
+     * @brief Converts the value of the terrain noise into the height of the terrain surface.
+     * @param basicTerrainNoise Value of the noise in range [-1, 1]
+     * @return Height of the terrain surface in blocks
+     */
+    static constexpr int surfaceLevelForNoise(float basicTerrainNoise)
+    {
+        auto heightOfBlocks = (basicTerrainNoise * BASIC_TERRAIN_SQUASHING_FACTOR);
+
+        heightOfBlocks = (heightOfBlocks + 1 + BASIC_TERRAIN_SQUASHING_FACTOR) /
+                         (1 + BASIC_TERRAIN_SQUASHING_FACTOR + 1 + BASIC_TERRAIN_SQUASHING_FACTOR);
 
+        return static_cast<int>(((heightOfBlocks) * (MAX_HEIGHT_MAP - MINIMAL_TERRAIN_LEVEL)) +
+                                MINIMAL_TERRAIN_LEVEL);
+    }
+
+    /**
+     * Margin by which the bounds of the terrain surface are widened, as the noise can slightly
+     * exceed its nominal range.
+     */
+    static constexpr auto SURFACE_LEVEL_MARGIN = 2;
+
+    /**
+     * @brief Returns the global height of the lowest block of the columns generated in the chunk.
+     * @param chunkPosition Position of the chunk in the world, in blocks
+     * @return Global height from which the columns of the chunk are generated
+     */
+    static int lowestColumnLevel(const Block::Coordinate& chunkPosition);
+
+    /**
+     * @brief Checks whether the whole chunk lies far enough from the terrain surface to consist of
+     * a single block type.
+     * @param chunkPosition Position of the chunk in the world, in blocks
+     * @return Block type filling the whole chunk, or nullopt if the chunk crosses the surface
+     */
+    static std::optional<BlockId> uniformBlockOfChunk(const Block::Coordinate& chunkPosition);
+
+    /**
+     * @brief Samples the noise for every column of the chunk column at the given position at once.
+     * @param chunkPosition Position of any chunk of the column, in blocks
+     * @return Freshly generated heightmap
+     */
+    Heightmap generateHeightmap(const Block::Coordinate& chunkPosition);
+
+    /**
+     * @brief Fills a column of blocks using spans of the same block type.
+     * @param chunkBlocks Chunk blocks that are overwritten thus creating terrain.
+     * @param surfaceLevel Global height of the terrain surface in this column
+     * @param blockCoordinateX Local x coordinate of the column
+     * @param globalCoordinateY Global height of the lowest block of the column
+     * @param blockCoordinateZ Local z coordinate of the column
+     */
     static void generateColumnOfBlocks(ChunkBlocks& chunkBlocks, int surfaceLevel,
                                        int blockCoordinateX, int globalCoordinateY,
                                        int blockCoordinateZ);
 
+    /**
+     * @brief Fills a column of blocks deciding on the type of every block separately.
+     *
+     * Used only by generateTerrainVoxelByVoxel.
+     */
+    static void generateColumnOfBlocksVoxelByVoxel(ChunkBlocks& chunkBlocks, int surfaceLevel,
+                                                   int blockCoordinateX, int globalCoordinateY,
+                                                   int blockCoordinateZ);
+
     int surfaceLevelAtGivenPosition(int blockCoordinateX, int blockCoordinateZ);
 
 private:
+    int mSeed;
     FastNoiseLite mBasicTerrain;
+    BatchedOpenSimplex2Noise mBatchedBasicTerrain;
 };
 
-}// namespace Voxino
\ No newline at end of file
+}// namespace Voxino
@@ -0,0 +1,73 @@
+#include "ChunkFaceVisibility.h"
+#include "World/Chunks/Chunk.h"
+#include "pch.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+static_assert(ChunkBlocks::BLOCKS_PER_X_DIMENSION == ChunkBlocks::BLOCKS_PER_Y_DIMENSION &&
+                  ChunkBlocks::BLOCKS_PER_Y_DIMENSION == ChunkBlocks::BLOCKS_PER_Z_DIMENSION,
+              "Border slices require a cubic chunk");
+}// namespace
+
+void ChunkFaceVisibility::build(const Chunk& chunk)
+{
+    MEASURE_SCOPE;
+    const auto& blocks = chunk.blocks();
+    const auto& opaqueBlocks = blocks.occupancyRows(BlockOccupancy::Opaque);
+    const auto& nonAirBlocks = blocks.occupancyRows(BlockOccupancy::NonAir);
+
+    const auto leftBorder = chunk.neighbourBorderSlice(Direction::ToTheLeft);
+    const auto rightBorder = chunk.neighbourBorderSlice(Direction::ToTheRight);
+    const auto belowBorder = chunk.neighbourBorderSlice(Direction::Below);
+    const auto aboveBorder = chunk.neighbourBorderSlice(Direction::Above);
+    const auto behindBorder = chunk.neighbourBorderSlice(Direction::Behind);
+    const auto inFrontBorder = chunk.neighbourBorderSlice(Direction::InFront);
+
+    auto& bottom = mVisibleFaces[static_cast<int>(Block::Face::Bottom)];
+    auto& top = mVisibleFaces[static_cast<int>(Block::Face::Top)];
+    auto& left = mVisibleFaces[static_cast<int>(Block::Face::Left)];
+    auto& right = mVisibleFaces[static_cast<int>(Block::Face::Right)];
+    auto& front = mVisibleFaces[static_cast<int>(Block::Face::Front)];
+    auto& back = mVisibleFaces[static_cast<int>(Block::Face::Back)];
+
+    for (auto z = 0; z < SIZE; ++z)
+    {
+        for (auto y = 0; y < SIZE; ++y)
+        {
+            const auto row = y + z * SIZE;
+            const auto opaque = opaqueBlocks[row];
+            const auto nonAir = nonAirBlocks[row];
+
+            // Rows of the neighbours lying against each face of the blocks of this row
+            const auto below = (y > 0) ? opaqueBlocks[row - 1] : belowBorder[z];
+            const auto above = (y < SIZE - 1) ? opaqueBlocks[row + 1] : aboveBorder[z];
+            const auto behind = (z > 0) ? opaqueBlocks[row - SIZE] : behindBorder[y];
+            const auto inFront = (z < SIZE - 1) ? opaqueBlocks[row + SIZE] : inFrontBorder[y];
+
+            // Along the row, the neighbours are the bits next to each other
+            const auto leftmostNeighbour = (leftBorder[y] >> z) & 1;
+            const auto rightmostNeighbour = (rightBorder[y] >> z) & 1;
+            const auto toTheLeft = (opaque << 1) | leftmostNeighbour;
+            const auto toTheRight = (opaque >> 1) | (rightmostNeighbour << (SIZE - 1));
+
+            bottom[row] = nonAir & ~below;
+            top[row] = nonAir & ~above;
+            left[row] = nonAir & ~toTheLeft;
+            right[row] = nonAir & ~toTheRight;
+            front[row] = nonAir & ~inFront;
+            back[row] = nonAir & ~behind;
+        }
+    }
+}
+
+ChunkFaceVisibility& ChunkFaceVisibility::ofCurrentThread()
+{
+    thread_local auto visibility = std::make_unique<ChunkFaceVisibility>();
+    return *visibility;
+}
+
+}// namespace Voxino::Polygons
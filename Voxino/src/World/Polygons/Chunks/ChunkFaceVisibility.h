@@ -0,0 +1,76 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkBlocks.h"
+
+#include <array>
+#include <cstdint>
+
+namespace Voxino
+{
+class Chunk;
+}
+
+namespace Voxino::Polygons
+{
+
+/**
+ * \brief Visible faces of all blocks of a chunk, computed with bitwise operations.
+ *
+ * A face of a block is visible if the block is not air and the block lying against the face is
+ * transparent or does not exist. Instead of asking about every face of every block separately,
+ * the bit masks of rows along the x axis kept by the blocks of the chunk are read, and all faces
+ * of a whole row are tested with a few shifts. Blocks of neighbouring chunks are taken from their
+ * border slices.
+ *
+ * The masks of a 64 blocks wide chunk take a few hundred kilobytes, so meshers reuse a single
+ * instance per thread, see ofCurrentThread().
+ */
+class ChunkFaceVisibility
+{
+public:
+    using Row = std::uint64_t;
+    using RowMasks = ChunkBlocks::RowMasks;
+
+    /**
+     * \brief Computes visible faces of all blocks of the chunk.
+     * \param chunk Chunk whose faces should be computed
+     */
+    void build(const Chunk& chunk);
+
+    /**
+     * \brief Returns the row of blocks along the x axis in which the bits of blocks whose given
+     * face is visible are set.
+     * \param face Face of the blocks
+     * \param y, z Position of the row inside the chunk
+     * \return Bit mask of the row
+     */
+    [[nodiscard]] inline Row visibleRow(Block::Face face, int y, int z) const
+    {
+        return mVisibleFaces[static_cast<int>(face)][y + z * ChunkBlocks::BLOCKS_PER_Y_DIMENSION];
+    }
+
+    /**
+     * \brief Checks whether the given face of the block is visible.
+     * \param face Face of the block
+     * \param position Position of the block inside the chunk
+     * \return True if the face is visible, false otherwise
+     */
+    [[nodiscard]] inline bool isVisible(Block::Face face, const Block::Coordinate& position) const
+    {
+        return (visibleRow(face, position.y, position.z) >> position.x) & 1;
+    }
+
+    /**
+     * \brief Returns the instance owned by the calling thread, allocated on its first use.
+     * \return Instance reused by all meshes built on the thread
+     */
+    static ChunkFaceVisibility& ofCurrentThread();
+
+private:
+    static constexpr auto NUMBER_OF_FACES = static_cast<int>(Block::Face::Counter);
+
+    std::array<RowMasks, NUMBER_OF_FACES> mVisibleFaces;
+};
+
+}// namespace Voxino::Polygons
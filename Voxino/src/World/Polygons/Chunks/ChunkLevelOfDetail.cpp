@@ -0,0 +1,40 @@
+#include "ChunkLevelOfDetail.h"
+#include "pch.h"
+
+#include <algorithm>
+
+namespace Voxino::Polygons
+{
+
+ChunkLevelOfDetail::ChunkLevelOfDetail(int maxLevel, float fullDetailDistance, float hysteresis)
+    : mMaxLevel(maxLevel)
+    , mFullDetailDistance(fullDetailDistance)
+    , mHysteresis(hysteresis)
+{
+}
+
+int ChunkLevelOfDetail::select(float distance, int currentLevel) const
+{
+    auto level = std::clamp(currentLevel, 0, mMaxLevel);
+    while (level < mMaxLevel && distance > startOfLevel(level + 1) * (1.f + mHysteresis))
+    {
+        ++level;
+    }
+    while (level > 0 && distance < startOfLevel(level) * (1.f - mHysteresis))
+    {
+        --level;
+    }
+    return level;
+}
+
+float ChunkLevelOfDetail::startOfLevel(int level) const
+{
+    return mFullDetailDistance * static_cast<float>(1 << (level - 1));
+}
+
+int ChunkLevelOfDetail::maxLevel() const
+{
+    return mMaxLevel;
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <concepts>
+
+namespace Voxino::Polygons
+{
+
+/**
+ * \brief Chunks whose mesh can be built from a downsampled view of their blocks.
+ */
+template<typename ChunkType>
+concept HasLevelsOfDetail = requires(ChunkType& chunk, const ChunkType& constChunk, int level) {
+    { ChunkType::MAX_LEVEL_OF_DETAIL } -> std::convertible_to<int>;
+    chunk.setLevelOfDetail(level);
+    { constChunk.levelOfDetail() } -> std::convertible_to<int>;
+};
+
+/**
+ * \brief Chooses the level of detail of chunks from their distance to the camera.
+ *
+ * Level 0 is the full detail. Every next level starts twice as far as the previous one and meshes
+ * the chunk from cells twice as large. To keep chunks lying close to a boundary between two levels
+ * from being remeshed back and forth while the camera moves, a chunk switches to a coarser level
+ * only once it is further than the boundary plus the hysteresis, and back to a finer level only
+ * once it is closer than the boundary minus the hysteresis.
+ */
+class ChunkLevelOfDetail
+{
+public:
+    static constexpr auto DEFAULT_FULL_DETAIL_DISTANCE = 128.f;
+    static constexpr auto DEFAULT_HYSTERESIS = 0.1f;
+
+    /**
+     * \brief Creates the selector.
+     * \param maxLevel Coarsest level that can be chosen
+     * \param fullDetailDistance Distance in blocks up to which chunks are meshed in full detail
+     * \param hysteresis Fraction of the distance of a boundary by which a chunk must cross it to
+     * switch the level
+     */
+    explicit ChunkLevelOfDetail(int maxLevel,
+                                float fullDetailDistance = DEFAULT_FULL_DETAIL_DISTANCE,
+                                float hysteresis = DEFAULT_HYSTERESIS);
+
+    /**
+     * \brief Chooses the level of detail of a chunk.
+     * \param distance Distance in blocks between the camera and the center of the chunk
+     * \param currentLevel Level at which the chunk is meshed now
+     * \return Level at which the chunk should be meshed
+     */
+    [[nodiscard]] int select(float distance, int currentLevel) const;
+
+    /**
+     * \brief Returns the distance at which the given level starts, without the hysteresis.
+     * \param level Level of detail, at least 1
+     * \return Distance in blocks
+     */
+    [[nodiscard]] float startOfLevel(int level) const;
+
+    /**
+     * \brief Returns the coarsest level that can be chosen.
+     * \return Maximum level of detail
+     */
+    [[nodiscard]] int maxLevel() const;
+
+private:
+    int mMaxLevel;
+    float mFullDetailDistance;
+    float mHysteresis;
+};
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,374 @@
+#pragma once
+
+#include "Resources/TexturePackArray.h"
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/ChunkContainerBase.h"
+#include "World/Chunks/ChunkNeighbourBorders.h"
+#include "World/Polygons/Chunks/ChunkLevelOfDetail.h"
+#include "World/Polygons/Meshes/Mesh3D.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Voxino::Polygons
+{
+
+/**
+ * \brief Prepares meshes of chunks on worker threads.
+ *
+ * A job consists of a copy of the blocks of the chunk and of the borders of its neighbours, so the
+ * worker never touches the chunk or the container, which might change on the main thread in the
+ * meantime. The worker builds a detached chunk of the same type from this copy and prepares its
+ * mesh, at the level of detail the chunk had when the job was queued. Finished meshes wait in the
+ * queue until the main thread takes them and sends them to the GPU, as it is the only thread that
+ * can use OpenGL.
+ *
+ * If a chunk is queued again before its previous job is finished, the result of the previous job
+ * is outdated and it is dropped.
+ */
+template<typename ChunkType>
+class ChunkMeshJobQueue
+{
+public:
+    /**
+     * \brief Mesh prepared on a worker thread, waiting to be sent to the GPU.
+     */
+    struct FinishedMesh
+    {
+        std::weak_ptr<ChunkType> chunk;
+        std::unique_ptr<Mesh3D> mesh;
+        int levelOfDetail;
+    };
+
+    /**
+     * \brief Starts the worker threads.
+     * \param texturePack Texture pack used by the detached chunks
+     * \param container Container to which the chunks belong. Detached chunks never read it.
+     * \param numberOfWorkers Number of worker threads
+     */
+    ChunkMeshJobQueue(const TexturePackArray& texturePack, ChunkContainerBase& container,
+                      std::size_t numberOfWorkers = defaultNumberOfWorkers());
+    ChunkMeshJobQueue(const ChunkMeshJobQueue&) = delete;
+    ChunkMeshJobQueue& operator=(const ChunkMeshJobQueue&) = delete;
+
+    /**
+     * \brief Stops the workers. Jobs that have not started yet are discarded.
+     */
+    ~ChunkMeshJobQueue();
+
+    /**
+     * \brief Queues preparation of a new mesh of the chunk.
+     * \param chunk Chunk whose mesh should be prepared
+     * \param chunkBlocks Copy of the blocks of the chunk
+     * \param neighbourBorders Copy of the borders of the neighbouring chunks
+     */
+    void enqueue(const std::shared_ptr<ChunkType>& chunk, std::unique_ptr<ChunkBlocks> chunkBlocks,
+                 std::unique_ptr<ChunkNeighbourBorders> neighbourBorders);
+
+    /**
+     * \brief Takes meshes that are finished and still up to date, oldest first. If any job threw
+     * an exception, it is rethrown here.
+     * \param maxNumberOfMeshes Maximum number of meshes to take
+     * \return Finished meshes
+     */
+    std::vector<FinishedMesh> takeFinishedMeshes(std::size_t maxNumberOfMeshes);
+
+    /**
+     * \brief Blocks until all queued jobs are finished.
+     */
+    void waitForPendingJobs();
+
+    /**
+     * \brief Returns the number of jobs that are queued or in progress.
+     * \return Number of unfinished jobs
+     */
+    [[nodiscard]] std::size_t numberOfPendingJobs() const;
+
+    /**
+     * \brief Checks if a job of the chunk is queued or in progress, or its mesh was not taken yet.
+     * \param chunk Chunk to check
+     * \return True if a mesh of the chunk is going to arrive from the workers
+     */
+    [[nodiscard]] bool isPending(const ChunkType& chunk) const;
+
+    /**
+     * \brief Drops all jobs and meshes of a chunk removed from the container. Chunks are told
+     * apart by their address, so a chunk allocated later at the same address must not inherit them.
+     * \param chunk Chunk that is being removed
+     */
+    void forget(const ChunkType& chunk);
+
+    /**
+     * \brief Returns the default number of workers. One core is left for the main thread.
+     * \return Number of worker threads
+     */
+    [[nodiscard]] static std::size_t defaultNumberOfWorkers();
+
+private:
+    using Version = unsigned long long;
+
+    struct Job
+    {
+        std::weak_ptr<ChunkType> chunk;
+        const ChunkType* chunkKey;
+        Block::Coordinate chunkPosition;
+        std::unique_ptr<ChunkBlocks> chunkBlocks;
+        std::unique_ptr<ChunkNeighbourBorders> neighbourBorders;
+        int levelOfDetail;
+        Version version;
+    };
+
+    struct VersionedMesh
+    {
+        FinishedMesh finishedMesh;
+        const ChunkType* chunkKey;
+        Version version;
+    };
+
+    /**
+     * \brief Loop of a single worker thread.
+     * \param stopToken Token signalling that the worker should finish
+     */
+    void work(std::stop_token stopToken);
+
+    /**
+     * \brief Builds a detached chunk from the copy stored in the job and prepares its mesh.
+     * \param job Job to execute
+     * \return Prepared mesh
+     */
+    std::unique_ptr<Mesh3D> prepareMesh(Job& job) const;
+
+    /**
+     * \brief Checks if no newer job was queued for the same chunk. Requires the mutex to be held.
+     */
+    [[nodiscard]] bool isLatestVersion(const ChunkType* chunkKey, Version version) const;
+
+private:
+    const TexturePackArray& mTexturePack;
+    ChunkContainerBase& mContainer;
+
+    mutable std::mutex mMutex;
+    std::condition_variable_any mJobAvailable;
+    std::condition_variable mJobFinished;
+    std::deque<Job> mJobs;
+    std::deque<VersionedMesh> mFinishedMeshes;
+    std::unordered_map<const ChunkType*, Version> mLatestVersions;
+    std::size_t mJobsInProgress{0};
+    Version mNextVersion{0};
+    std::exception_ptr mFirstException;
+
+    /**
+     * \brief Workers are declared last so they are stopped before anything they use is destroyed.
+     */
+    std::vector<std::jthread> mWorkers;
+};
+
+template<typename ChunkType>
+ChunkMeshJobQueue<ChunkType>::ChunkMeshJobQueue(const TexturePackArray& texturePack,
+                                                ChunkContainerBase& container,
+                                                std::size_t numberOfWorkers)
+    : mTexturePack(texturePack)
+    , mContainer(container)
+{
+    mWorkers.reserve(numberOfWorkers);
+    for (auto i = std::size_t{0}; i < numberOfWorkers; ++i)
+    {
+        mWorkers.emplace_back(
+            [this](std::stop_token stopToken)
+            {
+                work(stopToken);
+            });
+    }
+}
+
+template<typename ChunkType>
+ChunkMeshJobQueue<ChunkType>::~ChunkMeshJobQueue()
+{
+    for (auto& worker: mWorkers)
+    {
+        worker.request_stop();
+    }
+    mJobAvailable.notify_all();
+    mWorkers.clear();
+}
+
+template<typename ChunkType>
+void ChunkMeshJobQueue<ChunkType>::enqueue(const std::shared_ptr<ChunkType>& chunk,
+                                           std::unique_ptr<ChunkBlocks> chunkBlocks,
+                                           std::unique_ptr<ChunkNeighbourBorders> neighbourBorders)
+{
+    auto levelOfDetail = 0;
+    if constexpr (HasLevelsOfDetail<ChunkType>)
+    {
+        levelOfDetail = chunk->levelOfDetail();
+    }
+
+    {
+        std::lock_guard lock(mMutex);
+        const auto version = mNextVersion++;
+        mLatestVersions[chunk.get()] = version;
+        mJobs.push_back({chunk, chunk.get(), chunk->positionInBlocks(), std::move(chunkBlocks),
+                         std::move(neighbourBorders), levelOfDetail, version});
+    }
+    mJobAvailable.notify_one();
+}
+
+template<typename ChunkType>
+std::vector<typename ChunkMeshJobQueue<ChunkType>::FinishedMesh> ChunkMeshJobQueue<
+    ChunkType>::takeFinishedMeshes(std::size_t maxNumberOfMeshes)
+{
+    std::lock_guard lock(mMutex);
+    if (mFirstException)
+    {
+        std::rethrow_exception(std::exchange(mFirstException, nullptr));
+    }
+
+    std::vector<FinishedMesh> finishedMeshes;
+    while (finishedMeshes.size() < maxNumberOfMeshes && not mFinishedMeshes.empty())
+    {
+        auto versionedMesh = std::move(mFinishedMeshes.front());
+        mFinishedMeshes.pop_front();
+        if (isLatestVersion(versionedMesh.chunkKey, versionedMesh.version))
+        {
+            mLatestVersions.erase(versionedMesh.chunkKey);
+            finishedMeshes.push_back(std::move(versionedMesh.finishedMesh));
+        }
+    }
+    return finishedMeshes;
+}
+
+template<typename ChunkType>
+void ChunkMeshJobQueue<ChunkType>::waitForPendingJobs()
+{
+    std::unique_lock lock(mMutex);
+    mJobFinished.wait(lock,
+                      [this]()
+                      {
+                          return mJobs.empty() && mJobsInProgress == 0;
+                      });
+}
+
+template<typename ChunkType>
+std::size_t ChunkMeshJobQueue<ChunkType>::numberOfPendingJobs() const
+{
+    std::lock_guard lock(mMutex);
+    return mJobs.size() + mJobsInProgress;
+}
+
+template<typename ChunkType>
+bool ChunkMeshJobQueue<ChunkType>::isPending(const ChunkType& chunk) const
+{
+    std::lock_guard lock(mMutex);
+    return mLatestVersions.contains(&chunk);
+}
+
+template<typename ChunkType>
+void ChunkMeshJobQueue<ChunkType>::forget(const ChunkType& chunk)
+{
+    // Jobs and meshes left in the queues are outdated without the latest version and are dropped
+    std::lock_guard lock(mMutex);
+    mLatestVersions.erase(&chunk);
+}
+
+template<typename ChunkType>
+std::size_t ChunkMeshJobQueue<ChunkType>::defaultNumberOfWorkers()
+{
+    return std::max(std::thread::hardware_concurrency(), 2u) - 1;
+}
+
+template<typename ChunkType>
+void ChunkMeshJobQueue<ChunkType>::work(std::stop_token stopToken)
+{
+    while (true)
+    {
+        std::optional<Job> job;
+        {
+            std::unique_lock lock(mMutex);
+            if (not mJobAvailable.wait(lock, stopToken,
+                                       [this]()
+                                       {
+                                           return not mJobs.empty();
+                                       }))
+            {
+                return;
+            }
+            job.emplace(std::move(mJobs.front()));
+            mJobs.pop_front();
+            if (not isLatestVersion(job->chunkKey, job->version))
+            {
+                mJobFinished.notify_all();
+                continue;
+            }
+            ++mJobsInProgress;
+        }
+
+        std::unique_ptr<Mesh3D> mesh;
+        std::exception_ptr exception;
+        try
+        {
+            mesh = prepareMesh(*job);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard lock(mMutex);
+            --mJobsInProgress;
+            if (exception)
+            {
+                if (not mFirstException)
+                {
+                    mFirstException = exception;
+                }
+                // No mesh will come for this version, so the chunk must not stay pending forever
+                if (isLatestVersion(job->chunkKey, job->version))
+                {
+                    mLatestVersions.erase(job->chunkKey);
+                }
+            }
+            else
+            {
+                mFinishedMeshes.push_back(
+                    {{std::move(job->chunk), std::move(mesh), job->levelOfDetail}, job->chunkKey,
+                     job->version});
+            }
+        }
+        mJobFinished.notify_all();
+    }
+}
+
+template<typename ChunkType>
+std::unique_ptr<Mesh3D> ChunkMeshJobQueue<ChunkType>::prepareMesh(Job& job) const
+{
+    MEASURE_SCOPE;
+    auto detachedChunk =
+        ChunkType(job.chunkPosition, mTexturePack, mContainer, std::move(job.chunkBlocks));
+    detachedChunk.setNeighbourBorders(std::move(job.neighbourBorders));
+    if constexpr (HasLevelsOfDetail<ChunkType>)
+    {
+        detachedChunk.setLevelOfDetail(job.levelOfDetail);
+    }
+    detachedChunk.prepareMesh();
+    return detachedChunk.takePreparedMesh();
+}
+
+template<typename ChunkType>
+bool ChunkMeshJobQueue<ChunkType>::isLatestVersion(const ChunkType* chunkKey,
+                                                   Version version) const
+{
+    const auto latestVersion = mLatestVersions.find(chunkKey);
+    return latestVersion != mLatestVersions.end() && latestVersion->second == version;
+}
+
+}// namespace Voxino::Polygons
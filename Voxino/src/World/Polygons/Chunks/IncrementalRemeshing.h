@@ -0,0 +1,24 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Polygons/Meshes/Mesh3D.h"
+
+#include <concepts>
+#include <memory>
+
+namespace Voxino::Polygons
+{
+
+/**
+ * \brief Chunks which can patch their displayed mesh after a single block has changed, instead of
+ * meshing all of their blocks again.
+ */
+template<typename ChunkType>
+concept HasIncrementalRemeshing = requires(ChunkType& chunk, std::unique_ptr<Mesh3D> mesh,
+                                           int levelOfDetail,
+                                           const Block::Coordinate& localCoordinates) {
+    chunk.keepDisplayedMesh(std::move(mesh), levelOfDetail);
+    { chunk.prepareMeshAround(localCoordinates) } -> std::same_as<bool>;
+};
+
+}// namespace Voxino::Polygons
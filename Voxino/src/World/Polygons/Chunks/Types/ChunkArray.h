@@ -13,6 +13,7 @@ template<typename MeshBuilder>
 class ChunkArray : public PolygonChunk
 {
 public:
+    using MeshBuilderType = MeshBuilder;
     using PolygonChunk::PolygonChunk;
 
 
@@ -29,10 +30,34 @@ public:
     unsigned long memorySize() override;
 
     /**
-     * \brief Swaps the current chunk mesh with the latest, most recently generated one
+     * \brief Returns the mesh built by prepareMesh(). It is plain CPU data, available even if the
+     * mesh has never been sent to the GPU.
+     * @return The most recently prepared mesh
+     */
+    [[nodiscard]] const Mesh3D& preparedMesh() const;
+
+    /**
+     * \brief Swaps the current chunk mesh with the latest, most recently generated one. This is
+     * the only place where the mesh is sent to the GPU, so it needs an OpenGL context. The prepared
+     * mesh is moved, not copied, and the storage of the replaced mesh is reused by the next
+     * rebuild.
      */
     void updateMesh() override;
 
+    /**
+     * \brief Moves the most recently prepared mesh out of the chunk without copying it. It is
+     * plain CPU data, so it can be taken on any thread.
+     * @return The prepared mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> takePreparedMesh() override;
+
+    /**
+     * \brief Replaces the current chunk mesh with the given one. It sends the mesh to the GPU, so
+     * it needs an OpenGL context.
+     * @param mesh Mesh to display
+     */
+    void replaceMesh(std::unique_ptr<Mesh3D> mesh) override;
+
     /**
      * It is rebuilding this mesh fresh. Very expensive operation
      */
@@ -45,13 +70,19 @@ protected:
 template<typename MeshBuilder>
 int ChunkArray<MeshBuilder>::numberOfVertices()
 {
-    return mTerrainModel->mesh().numberOfVertices();
+    return mTerrainModel ? mTerrainModel->mesh().numberOfVertices() : 0;
 }
 
 template<typename MeshBuilder>
 unsigned long ChunkArray<MeshBuilder>::memorySize()
 {
-    return mTerrainModel->mesh().memorySize();
+    return mTerrainModel ? mTerrainModel->mesh().memorySize() : 0;
+}
+
+template<typename MeshBuilder>
+const Mesh3D& ChunkArray<MeshBuilder>::preparedMesh() const
+{
+    return mTerrainMeshBuilder.preparedMesh();
 }
 
 template<typename MeshBuilder>
@@ -64,13 +95,31 @@ void ChunkArray<MeshBuilder>::rebuildMesh()
 
 template<typename MeshBuilder>
 void ChunkArray<MeshBuilder>::updateMesh()
+{
+    MEASURE_SCOPE;
+    auto previousMesh = mTerrainModel ? mTerrainModel->takeMesh() : nullptr;
+    replaceMesh(mTerrainMeshBuilder.takeMesh());
+    if (previousMesh)
+    {
+        mTerrainMeshBuilder.recycleMesh(std::move(previousMesh));
+    }
+}
+
+template<typename MeshBuilder>
+std::unique_ptr<Mesh3D> ChunkArray<MeshBuilder>::takePreparedMesh()
+{
+    return mTerrainMeshBuilder.takeMesh();
+}
+
+template<typename MeshBuilder>
+void ChunkArray<MeshBuilder>::replaceMesh(std::unique_ptr<Mesh3D> mesh)
 {
     MEASURE_SCOPE;
     if (!mTerrainModel)
     {
-        mTerrainModel = std::make_unique<MeshBuilder::ModelType>();
+        mTerrainModel = std::make_unique<typename MeshBuilder::ModelType>();
     }
-    mTerrainModel->setMesh(mTerrainMeshBuilder.mesh3D());
+    mTerrainModel->setMesh(std::move(mesh));
 }
 
 }// namespace Voxino::Polygons
\ No newline at end of file
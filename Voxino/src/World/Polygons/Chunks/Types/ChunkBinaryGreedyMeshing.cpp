@@ -1,71 +1,197 @@
 #include "ChunkBinaryGreedyMeshing.h"
+#include "Utils/BitMatrix.h"
 #include "Utils/Bitset3D.h"
 #include "pch.h"
+#include <algorithm>
 #include <bit>
+#include <cstdlib>
+#include <utility>
 
 #include <Resources/TexturePack.h>
 
 namespace Voxino::Polygons
 {
 
-ChunkBinaryGreedyMeshing::AxisEncodedBitSequences ChunkBinaryGreedyMeshing::
-    generateAxisEncodedBitSequences() const
+namespace
 {
-    /**
-     * We construct a cube, where for each x and y we have a sequence of bits (uint64) corresponding
-     * to the z axis. For each x and z, we have a sequence of bits corresponding to the y axis.
-     * And so on
-     **/
-
-    AxisEncodedBitSequences axisEncodedBits{};
+// Faces lying at the lower and the upper end of the blocks along the y, x and z axes. Front faces
+// point along +z, so the pair along z is ordered the other way round than the other two.
+constexpr std::array<int, ChunkBinaryGreedyMeshing::NUMBER_OF_AXES> LOWER_FACES = {
+    static_cast<int>(Block::Face::Bottom), static_cast<int>(Block::Face::Left),
+    static_cast<int>(Block::Face::Back)};
+constexpr std::array<int, ChunkBinaryGreedyMeshing::NUMBER_OF_AXES> UPPER_FACES = {
+    static_cast<int>(Block::Face::Top), static_cast<int>(Block::Face::Right),
+    static_cast<int>(Block::Face::Front)};
+
+// Component of the block coordinates along which every face points, indexed by Block::Face
+constexpr std::array<int, ChunkBinaryGreedyMeshing::NUMBER_OF_FACES> FACE_AXES = {1, 1, 0, 0, 2, 2};
+
+// Step along that component from a block to the block touching the face, indexed by Block::Face
+constexpr std::array<int, ChunkBinaryGreedyMeshing::NUMBER_OF_FACES> FACE_STEPS = {-1, 1, -1,
+                                                                                  1,  1, -1};
+
+// Neighbouring chunk touching the faces lying on the border of the chunk, indexed by Block::Face
+constexpr std::array<Direction, ChunkBinaryGreedyMeshing::NUMBER_OF_FACES> FACE_DIRECTIONS = {
+    Direction::Below,      Direction::Above,   Direction::ToTheLeft,
+    Direction::ToTheRight, Direction::InFront, Direction::Behind};
+}// namespace
+
+ChunkBinaryGreedyMeshing::ScratchArena& ChunkBinaryGreedyMeshing::scratchArena()
+{
+    thread_local auto arena = std::make_unique<ScratchArena>();
+    return *arena;
+}
 
-    for (auto x = 0; x < PLANE_SIZE_P; ++x)
+void ChunkBinaryGreedyMeshing::downsampleBlocks(ScratchArena& arena) const
+{
+    const auto cellSize = 1 << arena.cellLevel;
+    const auto cellsPerDimension = PLANE_SIZE >> arena.cellLevel;
+    const auto blocksPerCell = cellSize * cellSize * cellSize;
+    for (auto cellZ = 0; cellZ < cellsPerDimension; ++cellZ)
     {
-        for (auto y = 0; y < PLANE_SIZE_P; ++y)
+        for (auto cellY = 0; cellY < cellsPerDimension; ++cellY)
         {
-            for (auto z = 0; z < PLANE_SIZE_P; ++z)
+            for (auto cellX = 0; cellX < cellsPerDimension; ++cellX)
             {
-                auto localCoordinates = Block::Coordinate(x - 1, y - 1, z - 1);
+                const Block* topmostSolidBlock = nullptr;
+                const Block* transparentBlock = nullptr;
+                auto solidBlocks = 0;
 
-                // TODO: MAKE USE OF PARENT CONTAINER
-                if (areLocalCoordinatesInsideChunk(localCoordinates))
+                // Top to bottom, so the first solid block found is the topmost one
+                for (auto y = (cellY + 1) * cellSize - 1; y >= cellY * cellSize; --y)
                 {
-                    auto block = mChunkOfBlocks->block(localCoordinates);
-                    if (not block.isTransparent())
+                    for (auto z = cellZ * cellSize; z < (cellZ + 1) * cellSize; ++z)
                     {
-                        // For each x and z we get binary values  representing y axis of chunk
-                        axisEncodedBits[x + (z * PLANE_SIZE_P)] |= 1ULL << y;
-
-                        // For each z and y we get binary values representing x axis of chunk
-                        axisEncodedBits[z + (y * PLANE_SIZE_P) + PLANE_SIZE_P2] |= 1ULL << x;
-
-                        // For each x and y we get binary values representing z axis of chunk
-                        axisEncodedBits[x + (y * PLANE_SIZE_P) + PLANE_SIZE_P2 * 2] |= 1ULL << z;
+                        for (auto x = cellX * cellSize; x < (cellX + 1) * cellSize; ++x)
+                        {
+                            const auto& block = mChunkOfBlocks->block(x, y, z);
+                            if (block.isTransparent())
+                            {
+                                transparentBlock = transparentBlock ? transparentBlock : &block;
+                                continue;
+                            }
+                            topmostSolidBlock = topmostSolidBlock ? topmostSolidBlock : &block;
+                            ++solidBlocks;
+                        }
                     }
                 }
-                else if (mParentContainer)
+
+                const auto isSolid = solidBlocks * 2 >= blocksPerCell;
+                arena.cellBlocks[cellX + (cellY + cellZ * cellsPerDimension) * cellsPerDimension] =
+                    isSolid ? topmostSolidBlock : transparentBlock;
+            }
+        }
+    }
+}
+
+const Block& ChunkBinaryGreedyMeshing::meshedBlock(const ScratchArena& arena, int x, int y,
+                                                   int z) const
+{
+    if (arena.cellLevel == 0)
+    {
+        return mChunkOfBlocks->block(x, y, z);
+    }
+
+    const auto cellsPerDimension = PLANE_SIZE >> arena.cellLevel;
+    const auto cellX = x >> arena.cellLevel;
+    const auto cellY = y >> arena.cellLevel;
+    const auto cellZ = z >> arena.cellLevel;
+    return *arena.cellBlocks[cellX + (cellY + cellZ * cellsPerDimension) * cellsPerDimension];
+}
+
+void ChunkBinaryGreedyMeshing::generateAxisEncodedBitSequences(ScratchArena& arena) const
+{
+    /**
+     * We construct a cube, where for each x and z we have a sequence of bits (uint64) corresponding
+     * to the y axis. For each z and y, we have a sequence of bits corresponding to the x axis.
+     * And so on. A column of a 64 blocks wide chunk has no spare bits, so the blocks of the
+     * neighbouring chunks touching both ends of the column are kept separately.
+     **/
+
+    auto& axisEncodedBits = arena.axisEncodedBits;
+    axisEncodedBits.fill(0);
+
+    if (mChunkOfBlocks->isUniform())
+    {
+        if (not mChunkOfBlocks->uniformBlock().isTransparent())
+        {
+            axisEncodedBits.fill(generateAllOnesMask(PLANE_SIZE));
+        }
+    }
+    else if (arena.cellLevel == 0 && PLANE_SIZE == 64)
+    {
+        // The chunk keeps the opaque blocks as rows along x, bit x of row y + z * PLANE_SIZE. Those
+        // are the columns along x already, the other two axes are 64x64 transposes of them.
+        const auto& opaqueRows = mChunkOfBlocks->occupancyRows(BlockOccupancy::Opaque);
+        std::copy(opaqueRows.begin(), opaqueRows.end(), axisEncodedBits.begin());
+        for (auto z = 0; z < PLANE_SIZE; ++z)
+        {
+            // Rows y of the layer z become columns along y, bit y of row x + z * PLANE_SIZE
+            transposeBitMatrix64(axisEncodedBits.data() + z * PLANE_SIZE);
+            for (auto y = 0; y < PLANE_SIZE; ++y)
+            {
+                axisEncodedBits[z + (y * PLANE_SIZE) + PLANE_SIZE2] =
+                    opaqueRows[y + z * PLANE_SIZE];
+            }
+        }
+        for (auto y = 0; y < PLANE_SIZE; ++y)
+        {
+            // Rows z of the layer y become columns along z, bit z of row x + y * PLANE_SIZE
+            auto* layer = axisEncodedBits.data() + (y * PLANE_SIZE) + PLANE_SIZE2 * 2;
+            for (auto z = 0; z < PLANE_SIZE; ++z)
+            {
+                layer[z] = opaqueRows[y + z * PLANE_SIZE];
+            }
+            transposeBitMatrix64(layer);
+        }
+    }
+    else
+    {
+        for (auto z = 0; z < PLANE_SIZE; ++z)
+        {
+            for (auto y = 0; y < PLANE_SIZE; ++y)
+            {
+                for (auto x = 0; x < PLANE_SIZE; ++x)
                 {
-                    auto block =
-                        mParentContainer->worldBlock(localToGlobalCoordinates(localCoordinates));
-                    if (block and not block->isTransparent())
+                    if (meshedBlock(arena, x, y, z).isTransparent())
                     {
-                        // For each x and z we get binary values  representing y axis of chunk
-                        axisEncodedBits[x + (z * PLANE_SIZE_P)] |= 1ULL << y;
+                        continue;
+                    }
 
-                        // For each z and y we get binary values representing x axis of chunk
-                        axisEncodedBits[z + (y * PLANE_SIZE_P) + PLANE_SIZE_P2] |= 1ULL << x;
+                    // For each x and z we get binary values  representing y axis of chunk
+                    axisEncodedBits[x + (z * PLANE_SIZE)] |= 1ULL << y;
 
-                        // For each x and y we get binary values representing z axis of chunk
-                        axisEncodedBits[x + (y * PLANE_SIZE_P) + PLANE_SIZE_P2 * 2] |= 1ULL << z;
-                    }
+                    // For each z and y we get binary values representing x axis of chunk
+                    axisEncodedBits[z + (y * PLANE_SIZE) + PLANE_SIZE2] |= 1ULL << x;
+
+                    // For each x and y we get binary values representing z axis of chunk
+                    axisEncodedBits[x + (y * PLANE_SIZE) + PLANE_SIZE2 * 2] |= 1ULL << z;
                 }
             }
         }
     }
-    return axisEncodedBits;
+
+    // Border slices of the neighbours are laid out exactly like the columns touching them
+    auto copyNeighbourBorder = [this](Direction directionOfNeighbour, BinaryRow* destination)
+    {
+        const auto border = neighbourBorderSlice(directionOfNeighbour);
+        std::copy(border.begin(), border.end(), destination);
+    };
+
+    // Columns along y axis, bit x of row z
+    copyNeighbourBorder(Direction::Below, arena.lowerNeighbourBits.data());
+    copyNeighbourBorder(Direction::Above, arena.upperNeighbourBits.data());
+
+    // Columns along x axis, bit z of row y
+    copyNeighbourBorder(Direction::ToTheLeft, arena.lowerNeighbourBits.data() + PLANE_SIZE);
+    copyNeighbourBorder(Direction::ToTheRight, arena.upperNeighbourBits.data() + PLANE_SIZE);
+
+    // Columns along z axis, bit x of row y
+    copyNeighbourBorder(Direction::Behind, arena.lowerNeighbourBits.data() + PLANE_SIZE * 2);
+    copyNeighbourBorder(Direction::InFront, arena.upperNeighbourBits.data() + PLANE_SIZE * 2);
 }
 
-ChunkBinaryGreedyMeshing::FaceCullingMask ChunkBinaryGreedyMeshing::buildFaceCullingMasks() const
+void ChunkBinaryGreedyMeshing::buildFaceCullingMasks(ScratchArena& arena) const
 {
     /**
      * Each axis contains a sequence of bits defining the transparency of the block. X and Y
@@ -76,24 +202,27 @@ ChunkBinaryGreedyMeshing::FaceCullingMask ChunkBinaryGreedyMeshing::buildFaceCul
      * resulting bit sequence separately for the left face and separately for the right face.
      **/
 
-    auto axisEncodedBits = generateAxisEncodedBitSequences();
-    FaceCullingMask cullingMask{};
+    generateAxisEncodedBitSequences(arena);
+    auto& cullingMask = arena.faceCullingMasks;
 
-    for (auto axis = 0; axis < 3; ++axis)
+    for (auto axis = 0; axis < NUMBER_OF_AXES; ++axis)
     {
-        for (auto i = 0; i < PLANE_SIZE_P2; ++i)
+        for (auto i = 0; i < PLANE_SIZE2; ++i)
         {
-            // set if current is solid, and next is air
-            auto col = axisEncodedBits[PLANE_SIZE_P2 * axis + i];
+            const auto col = arena.axisEncodedBits[PLANE_SIZE2 * axis + i];
+            const auto neighbourRow = PLANE_SIZE * axis + (i / PLANE_SIZE);
+            const auto neighbourBit = i % PLANE_SIZE;
+            const auto lowerNeighbour = (arena.lowerNeighbourBits[neighbourRow] >> neighbourBit) & 1;
+            const auto upperNeighbour = (arena.upperNeighbourBits[neighbourRow] >> neighbourBit) & 1;
 
             // sample ascending axis, and set true when air meets solid
-            cullingMask[(PLANE_SIZE_P2 * (axis * 2 + 1)) + i] = col & ~(col >> 1);
+            cullingMask[(PLANE_SIZE2 * UPPER_FACES[axis]) + i] =
+                col & ~((col >> 1) | (upperNeighbour << (PLANE_SIZE - 1)));
             // sample descending axis, and set true when air meets solid
-            cullingMask[(PLANE_SIZE_P2 * (axis * 2 + 0)) + i] = col & ~(col << 1);
+            cullingMask[(PLANE_SIZE2 * LOWER_FACES[axis]) + i] =
+                col & ~((col << 1) | lowerNeighbour);
         }
     }
-
-    return cullingMask;
 }
 
 glm::ivec3 ChunkBinaryGreedyMeshing::calculateVoxelPosition(Block::Face blockFace, int x, int y,
@@ -114,130 +243,184 @@ glm::ivec3 ChunkBinaryGreedyMeshing::calculateVoxelPosition(Block::Face blockFac
     throw std::invalid_argument("Invalid axis value");
 }
 
-void ChunkBinaryGreedyMeshing::storeFaceCullingMaskInPlaneForGivenBlock(
-    BlockDataMap& data, int axis, Block::Face blockFace, int z, int x,
-    unsigned long long& faceCullingMask) const
+void ChunkBinaryGreedyMeshing::buildBinaryPlanes(ScratchArena& arena, Block::Face blockFace) const
 {
-    while (faceCullingMask != 0)
+    const auto face = static_cast<int>(blockFace);
+    for (auto z = 0; z < PLANE_SIZE; ++z)
     {
-        auto y = static_cast<unsigned long>(std::countr_zero(faceCullingMask));
-        faceCullingMask &= faceCullingMask - 1;
-
-        auto voxelPos = calculateVoxelPosition(blockFace, x, y, z);
-
-        auto blockHash =
-            static_cast<uint32_t>(mChunkOfBlocks->block(voxelPos).blockTextureId(blockFace));
-        auto& plane = data[axis][blockHash][y];
-        plane[x] |= (1u << z);
+        for (auto x = 0; x < PLANE_SIZE; ++x)
+        {
+            auto faceCullingMask = arena.faceCullingMasks[PLANE_SIZE2 * face + x + (z * PLANE_SIZE)];
+            while (faceCullingMask != 0)
+            {
+                const auto y = std::countr_zero(faceCullingMask);
+                faceCullingMask &= faceCullingMask - 1;
+
+                const auto voxelPos = calculateVoxelPosition(blockFace, x, y, z);
+                const auto& block = meshedBlock(arena, voxelPos.x, voxelPos.y, voxelPos.z);
+                const auto texture = block.blockTextureId(blockFace);
+                const auto slot = textureSlot(arena, texture);
+                arena.planes[slot][y][x] |= 1ULL << z;
+                arena.usedSlices[slot] |= 1ULL << y;
+            }
+        }
     }
 }
 
-ChunkBinaryGreedyMeshing::BlockDataMap ChunkBinaryGreedyMeshing::buildBinaryPlanes() const
+void ChunkBinaryGreedyMeshing::buildSlicePlanes(ScratchArena& arena, Block::Face blockFace,
+                                                int slice) const
 {
-    const auto faceCullingMasks = buildFaceCullingMasks();
-
-    BlockDataMap data;
-    for (auto axis = 0; axis < static_cast<int>(Block::Face::Counter); ++axis)
+    const auto face = static_cast<int>(blockFace);
+    const auto axis = FACE_AXES[face];
+    const auto neighbourSlice = slice + FACE_STEPS[face];
+    const auto isNeighbourOutside = neighbourSlice < 0 || neighbourSlice >= PLANE_SIZE;
+    const auto border = isNeighbourOutside ? neighbourBorderSlice(FACE_DIRECTIONS[face])
+                                           : ChunkBorderSlices::Slice{};
+
+    for (auto z = 0; z < PLANE_SIZE; ++z)
     {
-        auto blockFace = static_cast<Block::Face>(axis);
-        for (auto z = 0; z < PLANE_SIZE; ++z)
+        for (auto x = 0; x < PLANE_SIZE; ++x)
         {
-            for (auto x = 0; x < PLANE_SIZE; ++x)
+            const auto voxelPos = calculateVoxelPosition(blockFace, x, slice, z);
+            const auto& block = mChunkOfBlocks->block(voxelPos.x, voxelPos.y, voxelPos.z);
+            if (block.isTransparent())
             {
-                // skip padded by adding 1(for x padding) and (z+1) for (z padding)
-                auto indexOfBitSequence = 1 + x + ((z + 1) * PLANE_SIZE_P) + PLANE_SIZE_P2 * axis;
-                // removes the right most padding value, because it's invalid
-                auto faceCullingMask = faceCullingMasks[indexOfBitSequence] >> 1;
-                // removes the left most padding value, because it's invalid
-                faceCullingMask &= ~(1ULL << PLANE_SIZE);
-
+                continue;
+            }
 
-                storeFaceCullingMaskInPlaneForGivenBlock(data, axis, blockFace, z, x,
-                                                         faceCullingMask);
+            auto isHidden = false;
+            if (isNeighbourOutside)
+            {
+                // Border slices are laid out like the columns: bit x of row z
+                isHidden = (border[z] >> x) & 1;
             }
+            else
+            {
+                auto neighbourPos = voxelPos;
+                neighbourPos[axis] = neighbourSlice;
+                isHidden = not mChunkOfBlocks->block(neighbourPos.x, neighbourPos.y, neighbourPos.z)
+                                   .isTransparent();
+            }
+            if (isHidden)
+            {
+                continue;
+            }
+
+            const auto slot = textureSlot(arena, block.blockTextureId(blockFace));
+            arena.planes[slot][slice][x] |= 1ULL << z;
+            arena.usedSlices[slot] |= 1ULL << slice;
         }
     }
-    return data;
 }
 
-uint32_t ChunkBinaryGreedyMeshing::generateAllOnesMask(unsigned int shift)
+int ChunkBinaryGreedyMeshing::sliceOfQuad(const ChunkArrayPackedMesh::VertexData& quad)
 {
-    constexpr uint32_t maxShift = 32;
-    if (shift >= maxShift)
+    // All corners of the quad lie on the plane between the slice and the block its face touches
+    const auto face = static_cast<int>(quad.unpackFace());
+    const auto plane = quad.unpackPosition()[FACE_AXES[face]];
+    return FACE_STEPS[face] > 0 ? plane - 1 : plane;
+}
+
+int ChunkBinaryGreedyMeshing::textureSlot(ScratchArena& arena, Block::TextureId texture)
+{
+    for (auto slot = 0; slot < arena.numberOfTextures; ++slot)
     {
-        return ~0u;
+        if (arena.textures[slot] == texture)
+        {
+            return slot;
+        }
+    }
+
+    if (arena.numberOfTextures == MAX_TEXTURES_PER_FACE)
+    {
+        throw std::runtime_error("Too many different textures on a single face of the chunk");
     }
-    uint32_t result = 1u << shift;
-    return result - 1;
+    arena.textures[arena.numberOfTextures] = texture;
+    return arena.numberOfTextures++;
 }
 
-std::vector<ChunkBinaryGreedyMeshing::GreedyQuad> ChunkBinaryGreedyMeshing::greedyMeshSinglePlane(
-    BinaryRow& data, uint32_t planeSize)
+void ChunkBinaryGreedyMeshing::meshBinaryPlanes(ScratchArena& arena, Block::Face blockFace)
 {
-    std::vector<GreedyQuad> quads;
-    size_t rowCount = data.size();
-
-    for (size_t row = 0; row < rowCount; ++row)
+    for (auto slot = 0; slot < arena.numberOfTextures; ++slot)
     {
-        processRowForQuads(data, quads, row, planeSize);
+        auto usedSlices = arena.usedSlices[slot];
+        while (usedSlices != 0)
+        {
+            const auto slice = std::countr_zero(usedSlices);
+            usedSlices &= usedSlices - 1;
+
+            auto& plane = arena.planes[slot][slice];
+            greedyMeshSinglePlane(plane, blockFace, arena.textures[slot], slice);
+            plane.fill(0);
+        }
+        arena.usedSlices[slot] = 0;
     }
+    arena.numberOfTextures = 0;
+}
 
-    return quads;
+ChunkBinaryGreedyMeshing::BinaryRow ChunkBinaryGreedyMeshing::generateAllOnesMask(
+    unsigned int shift)
+{
+    constexpr unsigned int maxShift = 64;
+    if (shift >= maxShift)
+    {
+        return ~0ULL;
+    }
+    return (1ULL << shift) - 1;
 }
 
-void ChunkBinaryGreedyMeshing::processRowForQuads(BinaryRow& data, std::vector<GreedyQuad>& quads,
-                                                  size_t row, uint32_t planeSize)
+void ChunkBinaryGreedyMeshing::greedyMeshSinglePlane(BinaryPlane& plane, Block::Face blockFace,
+                                                     Block::TextureId texture, int slice)
 {
-    uint32_t y = 0;
-    while (y < planeSize)
+    for (size_t row = 0; row < plane.size(); ++row)
     {
-        y += skipLeadingZeros(data[row], y);
-        if (y >= planeSize)
+        uint32_t y = 0;
+        while (y < PLANE_SIZE)
         {
-            break;
-        }
+            y += skipLeadingZeros(plane[row], y);
+            if (y >= PLANE_SIZE)
+            {
+                break;
+            }
 
-        uint32_t segmentWidth = countConsecutiveOnes(data[row], y);
-        uint32_t widthAsMask = generateAllOnesMask(segmentWidth);
-        uint32_t mask = widthAsMask << y;
+            uint32_t segmentWidth = countConsecutiveOnes(plane[row], y);
+            BinaryRow widthAsMask = generateAllOnesMask(segmentWidth);
+            BinaryRow mask = widthAsMask << y;
 
-        uint32_t horizontalGrowth = expandAndClearRow(data, row, y, widthAsMask, mask, planeSize);
-        quads.push_back(GreedyQuad{static_cast<uint32_t>(row), y, horizontalGrowth, segmentWidth});
+            uint32_t horizontalGrowth = expandAndClearRow(plane, row, y, widthAsMask, mask);
+            auto quad = GreedyQuad{static_cast<uint32_t>(row), y, horizontalGrowth, segmentWidth};
+            mTerrainMeshBuilder.addQuad(createMeshRegion(blockFace, texture, slice, quad),
+                                        ChunkMeshBuilder::QuadMode::BINARY_GREEDY);
 
-        y += segmentWidth;
+            y += segmentWidth;
+        }
     }
 }
 
-uint32_t ChunkBinaryGreedyMeshing::skipLeadingZeros(uint32_t rowData, uint32_t startIndex)
+uint32_t ChunkBinaryGreedyMeshing::skipLeadingZeros(BinaryRow rowData, uint32_t startIndex)
 {
     return std::countr_zero(rowData >> startIndex);
 }
 
-uint32_t ChunkBinaryGreedyMeshing::countConsecutiveOnes(uint32_t rowData, uint32_t startIndex)
+uint32_t ChunkBinaryGreedyMeshing::countConsecutiveOnes(BinaryRow rowData, uint32_t startIndex)
 {
     return std::countr_one(rowData >> startIndex);
 }
 
-uint32_t ChunkBinaryGreedyMeshing::generateMask(uint32_t width, uint32_t offset)
-{
-    uint32_t mask = (1U << width) - 1;// Creates a mask of 'width' ones
-    return mask << offset;
-}
-
-uint32_t ChunkBinaryGreedyMeshing::expandAndClearRow(BinaryRow& data, size_t startRow,
-                                                     uint32_t startColumn, uint32_t widthAsMask,
-                                                     uint32_t mask, uint32_t planeSize)
+uint32_t ChunkBinaryGreedyMeshing::expandAndClearRow(BinaryPlane& plane, size_t startRow,
+                                                     uint32_t startColumn, BinaryRow widthAsMask,
+                                                     BinaryRow mask)
 {
     uint32_t width = 1;
-    while ((startRow + width) < planeSize)
+    while ((startRow + width) < PLANE_SIZE)
     {
-        uint32_t nextRowSegment = (data[startRow + width] >> startColumn) & widthAsMask;
+        BinaryRow nextRowSegment = (plane[startRow + width] >> startColumn) & widthAsMask;
         if (nextRowSegment != widthAsMask)
         {
             break;
         }
 
-        data[startRow + width] &= ~mask;
+        plane[startRow + width] &= ~mask;
         ++width;
     }
     return width;
@@ -252,12 +435,20 @@ ChunkBinaryGreedyMeshing::ChunkBinaryGreedyMeshing(const Block::Coordinate& bloc
     initializeChunk();
 }
 
+ChunkBinaryGreedyMeshing::ChunkBinaryGreedyMeshing(const Block::Coordinate& blockPosition,
+                                                   const TexturePackArray& texturePack,
+                                                   ChunkContainerBase& parent,
+                                                   std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : ChunkArray(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 
 ChunkBinaryGreedyMeshing::ChunkBinaryGreedyMeshing(const Block::Coordinate& blockPosition,
                                                    const TexturePackArray& texturePack)
     : ChunkArray(blockPosition, texturePack)
 {
-    initializeChunk();
+    prepareMesh();
 }
 
 void ChunkBinaryGreedyMeshing::initializeChunk()
@@ -272,54 +463,105 @@ void ChunkBinaryGreedyMeshing::initializeChunk()
 void ChunkBinaryGreedyMeshing::prepareMesh()
 {
     MEASURE_SCOPE;
-    auto binaryPlanes = buildBinaryPlanes();
-    for (int axis = 0; axis < static_cast<int>(Block::Face::Counter); ++axis)
+    // A chunk filled with air or another transparent block has no solid faces to mesh
+    if (mChunkOfBlocks->isUniform() and mChunkOfBlocks->uniformBlock().isTransparent())
     {
-        auto meshRegions = generateMeshForAxis(binaryPlanes, axis);
-        for (const auto& meshRegion: meshRegions)
-        {
-            mTerrainMeshBuilder.addQuad(meshRegion, ChunkArrayMeshBuilder::QuadMode::BINARY_GREEDY);
-        }
+        return;
+    }
+
+    auto& arena = scratchArena();
+    // A uniform chunk looks the same at every level, so it is never downsampled
+    arena.cellLevel = mChunkOfBlocks->isUniform() ? 0 : mLevelOfDetail;
+    if (arena.cellLevel > 0)
+    {
+        downsampleBlocks(arena);
+    }
+
+    buildFaceCullingMasks(arena);
+    for (int face = 0; face < NUMBER_OF_FACES; ++face)
+    {
+        buildBinaryPlanes(arena, static_cast<Block::Face>(face));
+        meshBinaryPlanes(arena, static_cast<Block::Face>(face));
+    }
+}
+
+void ChunkBinaryGreedyMeshing::setLevelOfDetail(int level)
+{
+    if (level < 0 || level > MAX_LEVEL_OF_DETAIL)
+    {
+        throw std::invalid_argument("Unsupported level of detail");
     }
+    mLevelOfDetail = level;
 }
 
-std::vector<MeshRegion> ChunkBinaryGreedyMeshing::generateMeshForAxis(BlockDataMap& binaryPlanes,
-                                                                      int axis)
+int ChunkBinaryGreedyMeshing::levelOfDetail() const
 {
-    std::vector<MeshRegion> meshRegions;
-    auto blockFace = static_cast<Block::Face>(axis);
-    auto& planeData = binaryPlanes[axis];
+    return mLevelOfDetail;
+}
 
-    for (auto& [blockType, plane]: planeData)
+void ChunkBinaryGreedyMeshing::keepDisplayedMesh(std::unique_ptr<Mesh3D> mesh, int levelOfDetail)
+{
+    mDisplayedLevelOfDetail = levelOfDetail;
+    auto previousMesh = std::exchange(
+        mDisplayedMesh,
+        std::unique_ptr<ChunkArrayPackedMesh>(static_cast<ChunkArrayPackedMesh*>(mesh.release())));
+    if (previousMesh)
     {
-        auto regions = extractRegionsFromPlane(blockFace, blockType, plane);
-        meshRegions.insert(meshRegions.end(), regions.begin(), regions.end());
+        mTerrainMeshBuilder.recycleMesh(std::move(previousMesh));
     }
-    return meshRegions;
 }
 
-std::vector<MeshRegion> ChunkBinaryGreedyMeshing::extractRegionsFromPlane(Block::Face blockFace,
-                                                                          uint32_t blockType,
-                                                                          BinaryPlane& plane)
+bool ChunkBinaryGreedyMeshing::prepareMeshAround(const Block::Coordinate& localCoordinates)
 {
-    std::vector<MeshRegion> regions;
-    for (auto& [position, singlePlane]: plane)
+    MEASURE_SCOPE;
+    // Slices are patched in full detail, so they cannot be mixed into a downsampled mesh, even if
+    // the chunk itself is already back in full detail and waits for its new mesh
+    if (not mDisplayedMesh || mDisplayedLevelOfDetail > 0)
+    {
+        return false;
+    }
+
+    const auto changedBlock = static_cast<glm::ivec3>(localCoordinates);
+    auto isSliceChanged = [&changedBlock](int face, int slice)
+    {
+        return std::abs(slice - changedBlock[FACE_AXES[face]]) <= 1;
+    };
+
+    mTerrainMeshBuilder.resetMesh();
+    const auto& displayedVertices = mDisplayedMesh->vertices;
+    for (auto quad = std::size_t{0}; quad < displayedVertices.size();
+         quad += ChunkMeshBuilder::VERTICES_PER_QUAD)
+    {
+        const auto& firstVertex = displayedVertices[quad];
+        if (not isSliceChanged(static_cast<int>(firstVertex.unpackFace()),
+                               sliceOfQuad(firstVertex)))
+        {
+            mTerrainMeshBuilder.addPackedQuad(&firstVertex);
+        }
+    }
+
+    auto& arena = scratchArena();
+    arena.cellLevel = 0;
+    for (auto face = 0; face < NUMBER_OF_FACES; ++face)
     {
-        auto quads = greedyMeshSinglePlane(singlePlane, PLANE_SIZE);
-        for (const auto& quad: quads)
+        const auto changedSlice = changedBlock[FACE_AXES[face]];
+        for (auto slice = std::max(changedSlice - 1, 0);
+             slice <= std::min(changedSlice + 1, PLANE_SIZE - 1); ++slice)
         {
-            regions.push_back(createMeshRegion(blockFace, blockType, position, quad));
+            buildSlicePlanes(arena, static_cast<Block::Face>(face), slice);
         }
+        meshBinaryPlanes(arena, static_cast<Block::Face>(face));
     }
-    return regions;
+    return true;
 }
 
-MeshRegion ChunkBinaryGreedyMeshing::createMeshRegion(Block::Face blockFace, uint32_t blockType,
-                                                      int position, const GreedyQuad& quad)
+MeshRegion ChunkBinaryGreedyMeshing::createMeshRegion(Block::Face blockFace,
+                                                      Block::TextureId texture, int position,
+                                                      const GreedyQuad& quad)
 {
     MeshRegion region;
     region.face = blockFace;
-    region.id = blockType;
+    region.id = texture;
     region.width = quad.width;
     region.height = quad.height;
     region.blockPosition = computeBlockCoordinates(blockFace, quad, position);
@@ -327,23 +569,25 @@ MeshRegion ChunkBinaryGreedyMeshing::createMeshRegion(Block::Face blockFace, uin
     return region;
 }
 
-Block::Coordinate ChunkBinaryGreedyMeshing::computeBlockCoordinates(Block::Face blockFace,
-                                                                    const GreedyQuad& quad,
-                                                                    int position)
+glm::ivec3 ChunkBinaryGreedyMeshing::computeBlockCoordinates(Block::Face blockFace,
+                                                             const GreedyQuad& quad, int position)
 {
+    const auto x = static_cast<int>(quad.x);
+    const auto y = static_cast<int>(quad.y);
     switch (blockFace)
     {
         case Block::Face::Bottom:
-        case Block::Face::Top: return Block::Coordinate(quad.x, position, quad.y);
+        case Block::Face::Top: return {x, position, y};
         case Block::Face::Left:
-        case Block::Face::Right: return Block::Coordinate(position, quad.y, quad.x);
-        case Block::Face::Front: return Block::Coordinate(quad.x, quad.y, position - 1);
-        case Block::Face::Back: return Block::Coordinate(quad.x, quad.y, position + 1);
+        case Block::Face::Right: return {position, y, x};
+        case Block::Face::Front: return {x, y, position + 1};
+        case Block::Face::Back: return {x, y, position - 1};
         default: throw std::invalid_argument("Unsupported block face");
     }
 }
 
-std::vector<glm::vec2> ChunkBinaryGreedyMeshing::calculateTextureCoordinates(const GreedyQuad& quad)
+std::array<glm::vec2, 4> ChunkBinaryGreedyMeshing::calculateTextureCoordinates(
+    const GreedyQuad& quad)
 {
     return {
         glm::vec2(quad.width, quad.height),//
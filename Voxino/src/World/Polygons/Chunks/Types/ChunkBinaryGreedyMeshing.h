@@ -2,7 +2,7 @@
 
 #include "World/Chunks/ChunkBlocks.h"
 #include "World/Polygons/Chunks/Types/ChunkArray.h"
-#include "World/Polygons/Meshes/Builders/ChunkArrayMeshBuilder.h"
+#include "World/Polygons/Meshes/Builders/ChunkArrayPackedMeshBuilder.h"
 #include "World/Polygons/Meshes/MeshRegion.h"
 
 namespace Voxino::Polygons
@@ -11,24 +11,85 @@ namespace Voxino::Polygons
 /**
  * \brief A chunk that uses the greedy meshing algorithm.
  */
-class ChunkBinaryGreedyMeshing : public ChunkArray<ChunkArrayMeshBuilder>
+class ChunkBinaryGreedyMeshing : public ChunkArray<ChunkArrayPackedMeshBuilder>
 {
 public:
     static constexpr int PLANE_SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
-    static constexpr int PLANE_SIZE_P = PLANE_SIZE + 2;
-    static constexpr int PLANE_SIZE_P2 = PLANE_SIZE_P * PLANE_SIZE_P;
-    static constexpr int PLANE_SIZE_P3 = PLANE_SIZE_P * PLANE_SIZE_P * PLANE_SIZE_P;
-    using BinaryRow = std::array<uint32_t, PLANE_SIZE>;
-    using BinaryPlane = std::unordered_map<uint32_t, BinaryRow>;
-    using PlaneMap = std::unordered_map<uint32_t, BinaryPlane>;
-    using BlockDataMap = std::array<PlaneMap, static_cast<int>(Block::Face::Counter)>;
-    using FaceCullingMask = std::array<uint64_t, 3 * PLANE_SIZE_P2 * 2>;
-    using AxisEncodedBitSequences = std::array<uint64_t, 3 * PLANE_SIZE_P2>;
+    static constexpr int PLANE_SIZE2 = PLANE_SIZE * PLANE_SIZE;
+    static_assert(PLANE_SIZE <= 64, "Every row of the chunk must fit into 64 bits");
+
+    static constexpr int NUMBER_OF_AXES = 3;
+    static constexpr int NUMBER_OF_FACES = static_cast<int>(Block::Face::Counter);
+    // A single face of a chunk can't have more different textures than there are block types
+    static constexpr int MAX_TEXTURES_PER_FACE = ChunkBlocks::MAX_PALETTE_SIZE;
+
+    // The coarsest level meshes the chunk from cells of 8x8x8 blocks
+    static constexpr int MAX_LEVEL_OF_DETAIL = 3;
+    static constexpr int MAX_CELLS_PER_DIMENSION = PLANE_SIZE / 2;
+    static_assert(PLANE_SIZE % (1 << MAX_LEVEL_OF_DETAIL) == 0,
+                  "Cells of every level of detail must tile the chunk");
+
+    using BinaryRow = uint64_t;
+    using BinaryPlane = std::array<BinaryRow, PLANE_SIZE>;
+    using FaceCullingMask = std::array<BinaryRow, NUMBER_OF_FACES * PLANE_SIZE2>;
+    using AxisEncodedBitSequences = std::array<BinaryRow, NUMBER_OF_AXES * PLANE_SIZE2>;
+
+    /**
+     * \brief Memory used while building the mesh. It is large, so a single arena is allocated
+     * once per meshing thread and reused by all rebuilds done on that thread.
+     */
+    struct ScratchArena
+    {
+        /** For each axis and each column along it, bits of solid blocks in that column. */
+        AxisEncodedBitSequences axisEncodedBits;
+
+        /**
+         * For each axis, bits of solid blocks of the neighbouring chunks lying right before the
+         * first and right after the last block of every column. Column a + b * PLANE_SIZE is
+         * stored as bit a of row b.
+         */
+        std::array<BinaryRow, NUMBER_OF_AXES * PLANE_SIZE> lowerNeighbourBits;
+        std::array<BinaryRow, NUMBER_OF_AXES * PLANE_SIZE> upperNeighbourBits;
+
+        /** For each face and each column, bits of blocks whose face is visible. */
+        FaceCullingMask faceCullingMasks;
+
+        /** Binary planes of the currently meshed face, indexed by texture slot and slice. */
+        std::array<std::array<BinaryPlane, PLANE_SIZE>, MAX_TEXTURES_PER_FACE> planes;
+
+        /** For each texture slot, bits of slices that contain at least one visible face. */
+        std::array<BinaryRow, MAX_TEXTURES_PER_FACE> usedSlices;
+
+        /** Texture assigned to each slot. */
+        std::array<Block::TextureId, MAX_TEXTURES_PER_FACE> textures;
+        int numberOfTextures;
+
+        /**
+         * Level of detail of the currently meshed chunk. Zero if the blocks are meshed directly,
+         * otherwise every cell of 2^level blocks in each dimension is meshed as its block in
+         * cellBlocks, indexed by x + y * cells + z * cells^2.
+         */
+        int cellLevel;
+        std::array<const Block*, MAX_CELLS_PER_DIMENSION * MAX_CELLS_PER_DIMENSION *
+                                     MAX_CELLS_PER_DIMENSION>
+            cellBlocks;
+    };
 
     ChunkBinaryGreedyMeshing(const Block::Coordinate& blockPosition,
                              const TexturePackArray& texturePack,
                              ChunkContainerBase& parent);// TODO
 
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its mesh.
+     */
+    ChunkBinaryGreedyMeshing(const Block::Coordinate& blockPosition,
+                             const TexturePackArray& texturePack, ChunkContainerBase& parent,
+                             std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Creates a standalone chunk and builds its mesh on the CPU only. The mesh is sent to
+     * the GPU by updateMesh(), so the chunk can be created without an OpenGL context.
+     */
     ChunkBinaryGreedyMeshing(const Block::Coordinate& blockPosition,
                              const TexturePackArray& texturePack);
 
@@ -37,6 +98,42 @@ public:
      */
     void prepareMesh() final;
 
+    /**
+     * \brief Sets the level of detail used by the next prepareMesh(). The blocks themselves are
+     * never changed.
+     * @param level 0 for the full detail, or the level at which every cell of 2^level blocks in
+     * each dimension is meshed as a single block, at most MAX_LEVEL_OF_DETAIL.
+     */
+    void setLevelOfDetail(int level);
+
+    /**
+     * \brief Returns the level of detail used by prepareMesh().
+     * @return Level of detail, 0 for the full detail
+     */
+    [[nodiscard]] int levelOfDetail() const;
+
+    /**
+     * \brief Keeps the mesh that is displayed for the chunk, so edits of single blocks can patch it
+     * instead of meshing the whole chunk again. The storage of the previously kept mesh is reused
+     * by the next rebuild.
+     * @param mesh Displayed mesh, built by this chunk
+     * @param levelOfDetail Level of detail the mesh was built at. It may differ from the current
+     * level of the chunk while the mesh of the new level is still being prepared.
+     */
+    void keepDisplayedMesh(std::unique_ptr<Mesh3D> mesh, int levelOfDetail);
+
+    /**
+     * \brief Prepares the mesh after a single block has changed. A face along an axis depends only
+     * on its block and the block next to it, so only the slices at most one block away from the
+     * changed block are meshed again, for every face direction. Quads of all other slices are
+     * copied from the displayed mesh. Borders of the neighbours are used the same way as by
+     * prepareMesh().
+     * @param localCoordinates Coordinates of the changed block relative to the chunk
+     * @return False if no displayed mesh is kept or it was built downsampled, in which case
+     * nothing is prepared and the whole mesh has to be prepared again
+     */
+    bool prepareMeshAround(const Block::Coordinate& localCoordinates);
+
 private:
     /** \brief Represents a quad in the greedy meshing algorithm. */
     struct GreedyQuad
@@ -52,77 +149,117 @@ private:
      */
     void initializeChunk();
 
+    /**
+     * Returns the scratch arena of the calling thread.
+     * @return Scratch arena, allocated on the first use on the thread.
+     */
+    static ScratchArena& scratchArena();
+
+    /**
+     * Chooses a single block for every cell of the level of detail of the chunk. A cell is solid
+     * if at least half of its blocks are solid, and then it takes the topmost solid block, so the
+     * surface of the terrain keeps its look from a distance. Otherwise it takes a transparent
+     * block of the cell.
+     * @param arena Arena in which the blocks of the cells are stored.
+     */
+    void downsampleBlocks(ScratchArena& arena) const;
+
+    /**
+     * Returns the block that is meshed at the given position, which is the block of its cell if
+     * the chunk is downsampled.
+     * @param arena Arena containing the blocks of the cells.
+     * @param x, y, z Position inside the chunk.
+     * @return The meshed block.
+     */
+    const Block& meshedBlock(const ScratchArena& arena, int x, int y, int z) const;
+
     /**
      * Builds culling masks for each face of blocks to optimize rendering.
-     * @return Fully constructed culling masks.
+     * @param arena Arena in which the masks are built.
      */
-    [[nodiscard]] FaceCullingMask buildFaceCullingMasks() const;
+    void buildFaceCullingMasks(ScratchArena& arena) const;
 
     /**
-     * Constructs binary planes to represent block data in terms of visibility and structure.
-     * @return A map of binary plane data organized by block face.
+     * Constructs encoded bit sequences for axes, facilitating efficient space and visibility
+     * checks. Includes the blocks of neighbouring chunks touching the ends of every column.
+     * @param arena Arena in which the bit sequences are built.
      */
-    [[nodiscard]] BlockDataMap buildBinaryPlanes() const;
+    void generateAxisEncodedBitSequences(ScratchArena& arena) const;
 
     /**
-     * Executes a greedy meshing algorithm on a single plane to reduce the number of draw calls.
-     * @param data The binary data representing a single plane.
-     * @param lod_size Level of detail size, affecting the granularity of meshing.
-     * @return A collection of meshed quads.
+     * Constructs binary planes of a single face, one plane for each texture and slice.
+     * @param arena Arena containing the culling masks, in which the planes are built.
+     * @param blockFace The face for which the planes are built.
      */
-    std::vector<GreedyQuad> greedyMeshSinglePlane(std::array<uint32_t, PLANE_SIZE>& data,
-                                                  uint32_t lod_size);
+    void buildBinaryPlanes(ScratchArena& arena, Block::Face blockFace) const;
 
     /**
-     * Calculates the 3D voxel position based on block face and 2D coordinates.
-     * @param blockFace The face of the block determining the axes.
-     * @param x, y, z Coordinate components.
-     * @return The computed 3D voxel position.
+     * Constructs the binary planes of a single face and slice straight from the blocks, without
+     * the culling masks of the whole chunk.
+     * @param arena Arena in which the planes are built.
+     * @param blockFace The face for which the planes are built.
+     * @param slice Position of the slice along the axis of the face.
      */
-    static glm::ivec3 calculateVoxelPosition(Block::Face blockFace, int x, int y, int z);
+    void buildSlicePlanes(ScratchArena& arena, Block::Face blockFace, int slice) const;
 
     /**
-     * Creates a bitmask with all bits set to 1 up to a specified bit position.
-     * @param shift Number of least significant bits set to 1.
-     * @return A bitmask with specified bits set.
+     * Returns the slice in which the quad of the mesh lies.
+     * @param quad The first vertex of the quad.
+     * @return Position of the slice along the axis of the face of the quad.
      */
-    static uint32_t generateAllOnesMask(unsigned int shift);
+    static int sliceOfQuad(const ChunkArrayPackedMesh::VertexData& quad);
 
     /**
-     * Constructs encoded bit sequences for axes, facilitating efficient space and visibility
-     * checks.
-     * @return Encoded bit sequences for all three axes.
+     * Finds the slot of the plane in which faces with the given texture are stored, assigning a
+     * new one if the texture was not seen yet.
+     * @param arena Arena containing the planes.
+     * @param texture Texture of the face.
+     * @return Index of the texture slot.
+     */
+    static int textureSlot(ScratchArena& arena, Block::TextureId texture);
+
+    /**
+     * Meshes all planes of a single face and clears them, so the arena is ready for the next face.
+     * @param arena Arena containing the planes.
+     * @param blockFace The face whose planes are meshed.
+     */
+    void meshBinaryPlanes(ScratchArena& arena, Block::Face blockFace);
+
+    /**
+     * Executes a greedy meshing algorithm on a single plane and adds found quads to the mesh.
+     * @param plane The binary data representing a single plane. It is consumed by the algorithm.
+     * @param blockFace The face of the block.
+     * @param texture The texture of the faces in the plane.
+     * @param slice Position of the plane along the axis.
      */
-    [[nodiscard]] AxisEncodedBitSequences generateAxisEncodedBitSequences() const;
+    void greedyMeshSinglePlane(BinaryPlane& plane, Block::Face blockFace,
+                               Block::TextureId texture, int slice);
 
     /**
-     * Creates mesh regions for a specific axis by analyzing the binary planes.
-     * @param binaryPlanes The binary plane data.
-     * @param axis Index of the axis for which the mesh is generated.
-     * @return A list of mesh regions for efficient rendering.
+     * Calculates the 3D voxel position based on block face and 2D coordinates.
+     * @param blockFace The face of the block determining the axes.
+     * @param x, y, z Coordinate components.
+     * @return The computed 3D voxel position.
      */
-    std::vector<MeshRegion> generateMeshForAxis(BlockDataMap& binaryPlanes, int axis);
+    static glm::ivec3 calculateVoxelPosition(Block::Face blockFace, int x, int y, int z);
 
     /**
-     * Extracts rectangular regions from a binary plane that can be meshed together.
-     * @param blockFace The face of the block being processed.
-     * @param blockType Type identifier for the block.
-     * @param axisPlane The specific plane data for the given block type and axis.
-     * @return Meshable regions derived from the plane.
+     * Creates a bitmask with all bits set to 1 up to a specified bit position.
+     * @param shift Number of least significant bits set to 1.
+     * @return A bitmask with specified bits set.
      */
-    std::vector<MeshRegion> extractRegionsFromPlane(Block::Face blockFace, uint32_t blockType,
-                                                    BinaryPlane& axisPlane);
+    static BinaryRow generateAllOnesMask(unsigned int shift);
 
     /**
      * Constructs a mesh region from a given quad.
      * @param blockFace The face of the block.
-     * @param blockType The type of block.
+     * @param texture The texture of the block face.
      * @param axisPos Position along the axis being processed.
      * @param quad The quad to be converted into a mesh region.
      * @return The constructed mesh region.
      */
-    static MeshRegion createMeshRegion(Block::Face blockFace, uint32_t blockType, int axisPos,
-                                       const GreedyQuad& quad);
+    static MeshRegion createMeshRegion(Block::Face blockFace, Block::TextureId texture,
+                                       int axisPos, const GreedyQuad& quad);
 
     /**
      * Computes block coordinates from a quad's dimensions and position.
@@ -131,26 +268,15 @@ private:
      * @param axis_pos Position along the axis.
      * @return The computed block coordinates.
      */
-    static Block::Coordinate computeBlockCoordinates(Block::Face blockFace, const GreedyQuad& quad,
-                                                     int axis_pos);
+    static glm::ivec3 computeBlockCoordinates(Block::Face blockFace, const GreedyQuad& quad,
+                                              int axis_pos);
 
     /**
      * Calculates texture coordinates for a quad, based on its dimensions.
      * @param quad The quad whose texture coordinates are being calculated.
-     * @return A list of texture coordinates corresponding to the quad corners.
+     * @return Texture coordinates corresponding to the quad corners.
      */
-    static std::vector<glm::vec2> calculateTextureCoordinates(const GreedyQuad& quad);
-
-    /**
-     * Processes binary row data to extract quads, expanding the efficient rendering of contiguous
-     * areas.
-     * @param data The binary row data.
-     * @param quads Collection to store the generated quads.
-     * @param row The current row being processed.
-     * @param planeSize The size of the plane, defining boundary conditions.
-     */
-    static void processRowForQuads(BinaryRow& data, std::vector<GreedyQuad>& quads, size_t row,
-                                   uint32_t planeSize);
+    static std::array<glm::vec2, 4> calculateTextureCoordinates(const GreedyQuad& quad);
 
     /**
      * Identifies the start of non-zero data in a row, optimizing mesh generation.
@@ -158,7 +284,7 @@ private:
      * @param startIndex The starting index for the search.
      * @return The index of the first non-zero element.
      */
-    static uint32_t skipLeadingZeros(uint32_t rowData, uint32_t startIndex);
+    static uint32_t skipLeadingZeros(BinaryRow rowData, uint32_t startIndex);
 
     /**
      * Counts the number of consecutive set bits starting from a given index, aiding in quad
@@ -167,41 +293,24 @@ private:
      * @param startIndex The starting index for counting.
      * @return The count of consecutive ones.
      */
-    static uint32_t countConsecutiveOnes(uint32_t rowData, uint32_t startIndex);
-
-    /**
-     * Generates a shifted bitmask with a specified width of set bits, used in voxel processing.
-     * @param width The width of the mask in bits.
-     * @param offset The starting bit position for the mask.
-     * @return The generated bitmask.
-     */
-    static uint32_t generateMask(uint32_t width, uint32_t offset);
+    static uint32_t countConsecutiveOnes(BinaryRow rowData, uint32_t startIndex);
 
     /**
      * Expands and clears horizontal segments of a row, optimizing space representation in memory.
-     * @param data The binary row data.
+     * @param plane The binary plane data.
      * @param startRow The starting row for expansion.
      * @param startColumn The starting column.
      * @param widthAsMask The width of the mask used for expansion.
      * @param mask The mask applied to clear bits.
-     * @param planeSize The total size of the plane for boundary checks.
      * @return The number of rows successfully expanded and cleared.
      */
-    static uint32_t expandAndClearRow(BinaryRow& data, size_t startRow, uint32_t startColumn,
-                                      uint32_t widthAsMask, uint32_t mask, uint32_t planeSize);
+    static uint32_t expandAndClearRow(BinaryPlane& plane, size_t startRow, uint32_t startColumn,
+                                      BinaryRow widthAsMask, BinaryRow mask);
 
-    /**
-     * Stores culling mask data for a block in a specified plane, aiding in efficient rendering.
-     * @param data Reference to the data structure where masks are stored.
-     * @param axis The axis index being processed.
-     * @param blockFace The face of the block.
-     * @param z The z-coordinate in the plane.
-     * @param x The x-coordinate in the plane.
-     * @param faceCullingMask Reference to the culling mask to be stored.
-     */
-    void storeFaceCullingMaskInPlaneForGivenBlock(BlockDataMap& data, int axis,
-                                                  Block::Face blockFace, int z, int x,
-                                                  unsigned long long& faceCullingMask) const;
+private:
+    int mLevelOfDetail{0};
+    std::unique_ptr<ChunkArrayPackedMesh> mDisplayedMesh;
+    int mDisplayedLevelOfDetail{0};
 };
 
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "World/Chunks/ChunkBlocks.h"
 #include "pch.h"
 
+#include <bit>
+
 namespace Voxino::Polygons
 {
 
@@ -14,11 +16,18 @@ ChunkCullingGpu::ChunkCullingGpu(const Block::Coordinate& blockPosition,
     initializeChunk();
 }
 
+ChunkCullingGpu::ChunkCullingGpu(const Block::Coordinate& blockPosition,
+                                 const TexturePackArray& texturePack, ChunkContainerBase& parent,
+                                 std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : ChunkArray(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 ChunkCullingGpu::ChunkCullingGpu(const Block::Coordinate& blockPosition,
                                  const TexturePackArray& texturePack)
     : ChunkArray(blockPosition, texturePack)
 {
-    initializeChunk();
+    prepareMesh();
 }
 
 void ChunkCullingGpu::initializeChunk()
@@ -44,25 +53,47 @@ void ChunkCullingGpu::drawTerrain(const Renderer& renderer, const Shader& shader
 void ChunkCullingGpu::prepareMesh()
 {
     MEASURE_SCOPE;
-    for (const auto& [position, block]: *mChunkOfBlocks)
+    if (mChunkOfBlocks->isUniform() and mChunkOfBlocks->uniformBlock().id() == BlockId::Air)
     {
-        if (block.id() == BlockId::Air)
+        return;
+    }
+
+    auto& faceVisibility = ChunkFaceVisibility::ofCurrentThread();
+    faceVisibility.build(*this);
+    for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
+    {
+        for (auto y = 0; y < ChunkBlocks::BLOCKS_PER_Y_DIMENSION; ++y)
         {
-            continue;
+            createRowMesh(faceVisibility, y, z);
         }
-
-        createBlockMesh(position, block);
     }
 }
 
-void ChunkCullingGpu::createBlockMesh(const Block::Coordinate& pos, const Block& block)
+void ChunkCullingGpu::createRowMesh(const ChunkFaceVisibility& faceVisibility, int y, int z)
 {
-    for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
+    constexpr auto numberOfFaces = static_cast<int>(Block::Face::Counter);
+    std::array<ChunkFaceVisibility::Row, numberOfFaces> visibleFaces{};
+    ChunkFaceVisibility::Row blocksWithVisibleFaces = 0;
+    for (auto i = 0; i < numberOfFaces; ++i)
     {
-        if (doesBlockFaceHasTransparentNeighbor(static_cast<Block::Face>(i), pos))
+        visibleFaces[i] = faceVisibility.visibleRow(static_cast<Block::Face>(i), y, z);
+        blocksWithVisibleFaces |= visibleFaces[i];
+    }
+
+    while (blocksWithVisibleFaces != 0)
+    {
+        const auto x = std::countr_zero(blocksWithVisibleFaces);
+        blocksWithVisibleFaces &= blocksWithVisibleFaces - 1;
+
+        const auto& block = mChunkOfBlocks->block(x, y, z);
+        const auto position = Block::Coordinate(x, y, z);
+        for (auto i = 0; i < numberOfFaces; ++i)
         {
-            mTerrainMeshBuilder.addPoint(static_cast<Block::Face>(i),
-                                         block.blockTextureId(static_cast<Block::Face>(i)), pos);
+            if ((visibleFaces[i] >> x) & 1)
+            {
+                const auto face = static_cast<Block::Face>(i);
+                mTerrainMeshBuilder.addPoint(face, block.blockTextureId(face), position);
+            }
         }
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "World/Polygons/Chunks/ChunkFaceVisibility.h"
 #include "World/Polygons/Chunks/Types/ChunkArray.h"
 #include "World/Polygons/Meshes/Builders/ChunkArrayCullingGpuMeshBuilder.h"
 
@@ -13,6 +14,17 @@ class ChunkCullingGpu : public ChunkArray<ChunkArrayCullingGpuMeshBuilder>
 public:
     ChunkCullingGpu(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
                     ChunkContainerBase& parent);// TODO
+
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its mesh.
+     */
+    ChunkCullingGpu(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
+                    ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Creates a standalone chunk and builds its mesh on the CPU only. The mesh is sent to
+     * the GPU by updateMesh(), so the chunk can be created without an OpenGL context.
+     */
     ChunkCullingGpu(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack);
     /**
      * \brief Prepares/generates the mesh chunk, but does not replace it yet.
@@ -34,12 +46,12 @@ private:
     void initializeChunk();
 
     /**
-     * Creates the visual representation of a block at a specified position (only for those
-     * faces that are needed).
+     * Creates the visual representation of all blocks of a single row along the x axis (only for
+     * those faces that are visible).
      *
-     * @param pos Position of the block within the chunk.
-     * @param block The block to be visually represented.
+     * @param faceVisibility Visible faces of the blocks of the chunk.
+     * @param y, z Position of the row within the chunk.
      */
-    void createBlockMesh(const Block::Coordinate& pos, const Block& block);
+    void createRowMesh(const ChunkFaceVisibility& faceVisibility, int y, int z);
 };
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "ChunkCullingInstanced.h"
+#include "Resources/TexturePackArray.h"
+#include "World/Chunks/ChunkBlocks.h"
+#include "pch.h"
+
+#include <bit>
+
+namespace Voxino::Polygons
+{
+
+
+ChunkCullingInstanced::ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                                             const TexturePackArray& texturePack,
+                                             ChunkContainerBase& parent)
+    : ChunkArray(blockPosition, texturePack, parent)
+{
+    initializeChunk();
+}
+
+ChunkCullingInstanced::ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                                             const TexturePackArray& texturePack,
+                                             ChunkContainerBase& parent,
+                                             std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : ChunkArray(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
+ChunkCullingInstanced::ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                                             const TexturePackArray& texturePack)
+    : ChunkArray(blockPosition, texturePack)
+{
+    prepareMesh();
+}
+
+void ChunkCullingInstanced::initializeChunk()
+{
+    MEASURE_SCOPE;
+    TracyMessageAuto("Initializing ChunkCullingInstanced");
+    prepareMesh();
+    updateMesh();
+    TracyMessageAuto("End of ChunkCullingInstanced initialization");
+}
+
+void ChunkCullingInstanced::prepareMesh()
+{
+    MEASURE_SCOPE;
+    if (mChunkOfBlocks->isUniform() and mChunkOfBlocks->uniformBlock().id() == BlockId::Air)
+    {
+        return;
+    }
+
+    auto& faceVisibility = ChunkFaceVisibility::ofCurrentThread();
+    faceVisibility.build(*this);
+    for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
+    {
+        for (auto y = 0; y < ChunkBlocks::BLOCKS_PER_Y_DIMENSION; ++y)
+        {
+            createRowMesh(faceVisibility, y, z);
+        }
+    }
+}
+
+void ChunkCullingInstanced::createRowMesh(const ChunkFaceVisibility& faceVisibility, int y, int z)
+{
+    constexpr auto numberOfFaces = static_cast<int>(Block::Face::Counter);
+    std::array<ChunkFaceVisibility::Row, numberOfFaces> visibleFaces{};
+    ChunkFaceVisibility::Row blocksWithVisibleFaces = 0;
+    for (auto i = 0; i < numberOfFaces; ++i)
+    {
+        visibleFaces[i] = faceVisibility.visibleRow(static_cast<Block::Face>(i), y, z);
+        blocksWithVisibleFaces |= visibleFaces[i];
+    }
+
+    while (blocksWithVisibleFaces != 0)
+    {
+        const auto x = std::countr_zero(blocksWithVisibleFaces);
+        blocksWithVisibleFaces &= blocksWithVisibleFaces - 1;
+
+        const auto& block = mChunkOfBlocks->block(x, y, z);
+        const auto position = Block::Coordinate(x, y, z);
+        for (auto i = 0; i < numberOfFaces; ++i)
+        {
+            if ((visibleFaces[i] >> x) & 1)
+            {
+                const auto face = static_cast<Block::Face>(i);
+                mTerrainMeshBuilder.addFace(face, block.blockTextureId(face), position);
+            }
+        }
+    }
+}
+
+}// namespace Voxino::Polygons
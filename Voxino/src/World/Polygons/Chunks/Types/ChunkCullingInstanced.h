@@ -0,0 +1,52 @@
+#pragma once
+#include "World/Polygons/Chunks/ChunkFaceVisibility.h"
+#include "World/Polygons/Chunks/Types/ChunkArray.h"
+#include "World/Polygons/Meshes/Builders/ChunkFaceRecordMeshBuilder.h"
+
+namespace Voxino::Polygons
+{
+
+/**
+ * A chunk that culls hidden faces on the CPU, like ChunkCulling, but stores each visible face as a
+ * single record. Quads are built from the records by the vertex shader, so neither a geometry
+ * shader nor an index buffer is needed.
+ */
+class ChunkCullingInstanced : public ChunkArray<ChunkFaceRecordMeshBuilder>
+{
+public:
+    ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                          const TexturePackArray& texturePack, ChunkContainerBase& parent);
+
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its mesh.
+     */
+    ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                          const TexturePackArray& texturePack, ChunkContainerBase& parent,
+                          std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Creates a standalone chunk and builds its mesh on the CPU only. The mesh is sent to
+     * the GPU by updateMesh(), so the chunk can be created without an OpenGL context.
+     */
+    ChunkCullingInstanced(const Block::Coordinate& blockPosition,
+                          const TexturePackArray& texturePack);
+    /**
+     * \brief Prepares/generates the mesh chunk, but does not replace it yet.
+     */
+    void prepareMesh() final;
+
+private:
+    /**
+     * Initializes the chunk by preparing and updating its mesh.
+     */
+    void initializeChunk();
+
+    /**
+     * Adds records of the visible faces of all blocks of a single row along the x axis.
+     *
+     * @param faceVisibility Visible faces of the blocks of the chunk.
+     * @param y, z Position of the row within the chunk.
+     */
+    void createRowMesh(const ChunkFaceVisibility& faceVisibility, int y, int z);
+};
+}// namespace Voxino::Polygons
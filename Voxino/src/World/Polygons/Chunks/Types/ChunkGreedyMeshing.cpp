@@ -3,6 +3,7 @@
 
 #include "Utils/Bitset3D.h"
 #include <Resources/TexturePack.h>
+#include <bit>
 
 namespace Voxino::Polygons
 {
@@ -15,11 +16,19 @@ ChunkGreedyMeshing::ChunkGreedyMeshing(const Block::Coordinate& blockPosition,
     initializeChunk();
 }
 
+ChunkGreedyMeshing::ChunkGreedyMeshing(const Block::Coordinate& blockPosition,
+                                       const TexturePackArray& texturePack,
+                                       ChunkContainerBase& parent,
+                                       std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : ChunkArray(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 ChunkGreedyMeshing::ChunkGreedyMeshing(const Block::Coordinate& blockPosition,
                                        const TexturePackArray& texturePack)
     : ChunkArray(blockPosition, texturePack)
 {
-    initializeChunk();
+    prepareMesh();
 }
 
 void ChunkGreedyMeshing::initializeChunk()
@@ -34,30 +43,41 @@ void ChunkGreedyMeshing::initializeChunk()
 void ChunkGreedyMeshing::prepareMesh()
 {
     MEASURE_SCOPE;
+    if (mChunkOfBlocks->isUniform() and mChunkOfBlocks->uniformBlock().id() == BlockId::Air)
+    {
+        return;
+    }
+
+    auto& faceVisibility = ChunkFaceVisibility::ofCurrentThread();
+    faceVisibility.build(*this);
     for (auto i = 0; i < static_cast<int>(Block::Face::Counter); ++i)
     {
         ProcessedBlocks processedFaces;
         auto blockFace = static_cast<Block::Face>(i);
         const auto scanDirections = getScanDirectionsForFace(blockFace);
-        for (const auto& [position, block]: *mChunkOfBlocks)
+        for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
         {
-            if (processedFaces.test(position))
+            for (auto y = 0; y < ChunkBlocks::BLOCKS_PER_Y_DIMENSION; ++y)
             {
-                continue;
+                // Only blocks with a visible face can start a new region
+                auto visibleFaces = faceVisibility.visibleRow(blockFace, y, z);
+                while (visibleFaces != 0)
+                {
+                    const auto x = std::countr_zero(visibleFaces);
+                    visibleFaces &= visibleFaces - 1;
+
+                    const auto position = Block::Coordinate(x, y, z);
+                    if (processedFaces.test(position))
+                    {
+                        continue;
+                    }
+
+                    createBlockMesh(tryMergeBiggestRegion(position, processedFaces, faceVisibility,
+                                                          scanDirections, blockFace,
+                                                          mChunkOfBlocks->block(x, y, z)));
+                    processedFaces.set(position, true);
+                }
             }
-
-            const auto isAir = block.id() == BlockId::Air;
-            const auto anyNeighbourTransparent =
-                doesBlockFaceHasTransparentNeighbor(blockFace, position);
-            if (isAir or not anyNeighbourTransparent)
-            {
-                processedFaces.set(position, true);
-                continue;
-            }
-
-            createBlockMesh(
-                tryMergeBiggestRegion(position, processedFaces, scanDirections, blockFace, block));
-            processedFaces.set(position, true);
         }
     }
 }
@@ -69,6 +89,7 @@ void ChunkGreedyMeshing::createBlockMesh(MeshRegion&& meshRegion)
 
 MeshRegion ChunkGreedyMeshing::tryMergeBiggestRegion(const Block::Coordinate& pos,
                                                      ProcessedBlocks& processedFaces,
+                                                     const ChunkFaceVisibility& faceVisibility,
                                                      const ScanDirections& scanDirections,
                                                      const Block::Face& face, const Block& block)
 {
@@ -79,12 +100,12 @@ MeshRegion ChunkGreedyMeshing::tryMergeBiggestRegion(const Block::Coordinate& po
     region.height = 1;
     region.id = block.blockTextureId(face);
 
-    expandRegionHorizontally(region, processedFaces, scanDirections, block.blockTextureId(face),
-                             face);
-    expandRegionVertically(region, processedFaces, scanDirections, block.blockTextureId(face),
-                           face);
+    expandRegionHorizontally(region, processedFaces, faceVisibility, scanDirections,
+                             block.blockTextureId(face), face);
+    expandRegionVertically(region, processedFaces, faceVisibility, scanDirections,
+                           block.blockTextureId(face), face);
 
-    region.textureCoordinates = std::vector{
+    region.textureCoordinates = std::array{
         glm::vec2(region.width, region.height),//
         glm::vec2(0, region.height),           //
         glm::vec2(0, 0),                       //
@@ -96,11 +117,12 @@ MeshRegion ChunkGreedyMeshing::tryMergeBiggestRegion(const Block::Coordinate& po
 
 void ChunkGreedyMeshing::expandRegionHorizontally(MeshRegion& region,
                                                   ProcessedBlocks& processedFaces,
+                                                  const ChunkFaceVisibility& faceVisibility,
                                                   const ScanDirections& scanDirections,
                                                   Block::TextureId id, const Block::Face& face)
 {
     for (auto nextBlockPosition = getNextPosition(region.blockPosition, scanDirections.first);
-         canMerge(processedFaces, nextBlockPosition, id, face);
+         canMerge(processedFaces, faceVisibility, nextBlockPosition, id, face);
          nextBlockPosition = getNextPosition(nextBlockPosition, scanDirections.first))
     {
         ++region.width;
@@ -109,12 +131,13 @@ void ChunkGreedyMeshing::expandRegionHorizontally(MeshRegion& region,
 }
 
 void ChunkGreedyMeshing::expandRegionVertically(MeshRegion& region, ProcessedBlocks& processedFaces,
+                                                const ChunkFaceVisibility& faceVisibility,
                                                 const ScanDirections& scanDirections,
                                                 Block::TextureId id, const Block::Face& face)
 {
     for (auto nextBlockPositionVertical =
              getNextPosition(region.blockPosition, scanDirections.second);
-         canMerge(processedFaces, nextBlockPositionVertical, id, face);
+         canMerge(processedFaces, faceVisibility, nextBlockPositionVertical, id, face);
          nextBlockPositionVertical =
              getNextPosition(nextBlockPositionVertical, scanDirections.second))
     {
@@ -122,7 +145,7 @@ void ChunkGreedyMeshing::expandRegionVertically(MeshRegion& region, ProcessedBlo
         {
             auto nextPosition = getNextPosition(nextBlockPositionVertical,
                                                 static_cast<glm::ivec3>(scanDirections.first) * x);
-            if (not canMerge(processedFaces, nextPosition, id, face))
+            if (not canMerge(processedFaces, faceVisibility, nextPosition, id, face))
             {
                 return;
             }
@@ -145,6 +168,7 @@ Block::Coordinate ChunkGreedyMeshing::getNextPosition(const Block::Coordinate& c
 }
 
 bool ChunkGreedyMeshing::canMerge(ProcessedBlocks& processedFaces,
+                                  const ChunkFaceVisibility& faceVisibility,
                                   const Block::Coordinate& position, Block::TextureId id,
                                   const Block::Face& face)
 {
@@ -155,23 +179,13 @@ bool ChunkGreedyMeshing::canMerge(ProcessedBlocks& processedFaces,
         return false;
     }
 
-    const auto wasProcessedBefore = processedFaces.test(position);
-    const auto isAir = mChunkOfBlocks->block(position).id() == BlockId::Air;
-
-    if (wasProcessedBefore or isAir)
-    {
-        return false;
-    }
-
-    const auto isDifferentTexture = mChunkOfBlocks->block(position).blockTextureId(face) != id;
-    const auto isAnyNeighbourTransparent = doesBlockFaceHasTransparentNeighbor(face, position);
-
-    if (isDifferentTexture or not isAnyNeighbourTransparent)
+    // A visible face always belongs to a block other than air
+    if (processedFaces.test(position) or not faceVisibility.isVisible(face, position))
     {
         return false;
     }
 
-    return true;
+    return mChunkOfBlocks->block(position).blockTextureId(face) == id;
 }
 
 ChunkGreedyMeshing::ScanDirections ChunkGreedyMeshing::getScanDirectionsForFace(Block::Face face)
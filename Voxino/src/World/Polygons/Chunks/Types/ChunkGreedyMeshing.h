@@ -2,8 +2,9 @@
 
 #include "Utils/Bitset3D.h"
 #include "World/Chunks/ChunkBlocks.h"
+#include "World/Polygons/Chunks/ChunkFaceVisibility.h"
 #include "World/Polygons/Chunks/Types/ChunkArray.h"
-#include "World/Polygons/Meshes/Builders/ChunkArrayMeshBuilder.h"
+#include "World/Polygons/Meshes/Builders/ChunkArrayPackedMeshBuilder.h"
 #include "World/Polygons/Meshes/MeshRegion.h"
 
 namespace Voxino::Polygons
@@ -11,11 +12,22 @@ namespace Voxino::Polygons
 /**
  * It is a large object consisting of a multitude of individual blocks contained within it.
  */
-class ChunkGreedyMeshing : public ChunkArray<ChunkArrayMeshBuilder>
+class ChunkGreedyMeshing : public ChunkArray<ChunkArrayPackedMeshBuilder>
 {
 public:
     ChunkGreedyMeshing(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
                        ChunkContainerBase& parent);// TODO
+
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its mesh.
+     */
+    ChunkGreedyMeshing(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
+                       ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Creates a standalone chunk and builds its mesh on the CPU only. The mesh is sent to
+     * the GPU by updateMesh(), so the chunk can be created without an OpenGL context.
+     */
     ChunkGreedyMeshing(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack);
 
     /**
@@ -51,12 +63,14 @@ private:
      *
      * @param pos Position of the current block being processed.
      * @param processedFaces Tracks faces that have already been processed to avoid duplication.
+     * @param faceVisibility Visible faces of the blocks of the chunk.
      * @param scanDirections Directions to check for potential mergeable adjacent faces.
      * @param face The current face of the block being processed.
      * @param block The block instance being processed.
      * @return The largest possible mesh region created from merging adjacent faces.
      */
     MeshRegion tryMergeBiggestRegion(const Block::Coordinate& pos, ProcessedBlocks& processedFaces,
+                                     const ChunkFaceVisibility& faceVisibility,
                                      const ScanDirections& scanDirections, const Block::Face& face,
                                      const Block& block);
 
@@ -72,24 +86,27 @@ private:
      * Checks if the block at a given position with a specific texture ID can be merged
      *
      * @param processedFaces Keeps track of faces that have been considered for merging.
+     * @param faceVisibility Visible faces of the blocks of the chunk.
      * @param position Position of the block to check for merging capability.
      * @param id Texture ID of the block, used to ensure consistency in merging.
      * @param face The face of the block being considered for merging.
      * @return True if the block can be merged, false otherwise.
      */
-    bool canMerge(ProcessedBlocks& processedFaces, const Block::Coordinate& position,
-                  Block::TextureId id, const Block::Face& face);
+    bool canMerge(ProcessedBlocks& processedFaces, const ChunkFaceVisibility& faceVisibility,
+                  const Block::Coordinate& position, Block::TextureId id, const Block::Face& face);
 
     /**
      * Expands a mesh region horizontally based on the available adjacent faces that match criteria.
      *
      * @param region The current mesh region being expanded.
      * @param processedFaces Tracks faces already processed or included in a region.
+     * @param faceVisibility Visible faces of the blocks of the chunk.
      * @param scanDirections Directions to scan for expansion.
      * @param id Texture ID required for expansion to ensure visual consistency.
      * @param face The face orientation guiding the expansion process.
      */
     void expandRegionHorizontally(MeshRegion& region, ProcessedBlocks& processedFaces,
+                                  const ChunkFaceVisibility& faceVisibility,
                                   const ScanDirections& scanDirections, Block::TextureId id,
                                   const Block::Face& face);
 
@@ -98,11 +115,13 @@ private:
      *
      * @param region Mesh region to expand.
      * @param processedFaces Tracks already considered faces.
+     * @param faceVisibility Visible faces of the blocks of the chunk.
      * @param scanDirections Directions to look for possible expansion.
      * @param id Texture ID to maintain consistency in the mesh.
      * @param face The block face that determines expansion direction.
      */
     void expandRegionVertically(MeshRegion& region, ProcessedBlocks& processedFaces,
+                                const ChunkFaceVisibility& faceVisibility,
                                 const ScanDirections& scanDirections, Block::TextureId id,
                                 const Block::Face& face);
 
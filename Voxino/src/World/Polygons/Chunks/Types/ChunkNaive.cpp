@@ -13,10 +13,16 @@ ChunkNaive::ChunkNaive(const Block::Coordinate& blockPosition, const TexturePack
     initializeChunk();
 }
 
+ChunkNaive::ChunkNaive(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
+                       ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : ChunkArray(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 ChunkNaive::ChunkNaive(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack)
     : ChunkArray(blockPosition, texturePack)
 {
-    initializeChunk();
+    prepareMesh();
 }
 
 void ChunkNaive::prepareMesh()
@@ -17,6 +17,17 @@ class ChunkNaive : public ChunkArray<ChunkArrayMeshBuilder>
 public:
     ChunkNaive(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
                ChunkContainerBase& parent);// TODO
+
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its mesh.
+     */
+    ChunkNaive(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
+               ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Creates a standalone chunk and builds its mesh on the CPU only. The mesh is sent to
+     * the GPU by updateMesh(), so the chunk can be created without an OpenGL context.
+     */
     ChunkNaive(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack);
 
     /**
@@ -12,6 +12,7 @@ class Shader;
 namespace Polygons
 {
 class Model3D;
+struct Mesh3D;
 
 /**
  * It is a large object consisting of a multitude of individual blocks contained within it.
@@ -39,6 +40,20 @@ public:
      */
     virtual void updateMesh() = 0;
 
+    /**
+     * \brief Moves the most recently prepared mesh out of the chunk without copying it. It is
+     * plain CPU data, so it can be taken on any thread.
+     * @return The prepared mesh
+     */
+    [[nodiscard]] virtual std::unique_ptr<Mesh3D> takePreparedMesh() = 0;
+
+    /**
+     * \brief Replaces the current chunk mesh with the given one, for example prepared by another
+     * chunk on a worker thread. It sends the mesh to the GPU, so it needs an OpenGL context.
+     * @param mesh Mesh to display
+     */
+    virtual void replaceMesh(std::unique_ptr<Mesh3D> mesh) = 0;
+
     /**
      * It is rebuilding this mesh fresh. Very expensive operation
      */
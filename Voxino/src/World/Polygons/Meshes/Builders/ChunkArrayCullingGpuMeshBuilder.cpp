@@ -30,12 +30,23 @@ void ChunkArrayCullingGpuMeshBuilder::addPoint(const Block::Face& blockFace,
 
 void ChunkArrayCullingGpuMeshBuilder::resetMesh()
 {
-    mMesh = std::make_unique<ChunkArrayCullingGpuMesh>();
-    mIndex = 0;
+    // Keep the capacity of the vertices, so rebuilding the mesh does not allocate again
+    mMesh->vertices.clear();
 }
 
-std::unique_ptr<Mesh3D> ChunkArrayCullingGpuMeshBuilder::mesh3D()
+std::unique_ptr<Mesh3D> ChunkArrayCullingGpuMeshBuilder::takeMesh()
 {
-    return mMesh->clone();
+    return std::exchange(mMesh, std::make_unique<ChunkArrayCullingGpuMesh>());
+}
+
+void ChunkArrayCullingGpuMeshBuilder::recycleMesh(std::unique_ptr<Mesh3D> mesh)
+{
+    mMesh.reset(static_cast<ChunkArrayCullingGpuMesh*>(mesh.release()));
+    mMesh->reset();
+}
+
+const Mesh3D& ChunkArrayCullingGpuMeshBuilder::preparedMesh() const
+{
+    return *mMesh;
 }
 }// namespace Voxino::Polygons
\ No newline at end of file
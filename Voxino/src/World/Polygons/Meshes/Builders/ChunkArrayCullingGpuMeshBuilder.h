@@ -28,10 +28,23 @@ public:
     void resetMesh() override;
 
     /**
-     * Generates and retrieves the 3D mesh based on the added blocks and modifications.
-     * @return A unique pointer to the created 3D mesh, ready for rendering.
+     * Moves the built mesh out of the builder without copying it.
+     * @return The built mesh
      */
-    [[nodiscard]] std::unique_ptr<Mesh3D> mesh3D() override;
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh() override;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating.
+     * @param mesh Mesh of the type built by this builder
+     */
+    void recycleMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Returns the mesh built so far, without copying it.
+     * @return The mesh built so far
+     */
+    [[nodiscard]] const Mesh3D& preparedMesh() const override;
 
     /**
      * Adds a quad to the mesh in place of the designated face at the given coordinates and with the
@@ -22,22 +22,29 @@ public:
     explicit ChunkArrayMeshBuilder(Block::Coordinate origin);
     ChunkArrayMeshBuilder();
 
-    enum QuadMode
-    {
-        BINARY_GREEDY,
-        NORMAL
-    };
-
     /**
      * Resets the builder state, clearing any progress and setting it back to initial conditions.
      */
     void resetMesh() override;
 
     /**
-     * Generates and retrieves the 3D mesh based on the added blocks and modifications.
-     * @return A unique pointer to the created 3D mesh, ready for rendering.
+     * Moves the built mesh out of the builder without copying it.
+     * @return The built mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh() override;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating.
+     * @param mesh Mesh of the type built by this builder
+     */
+    void recycleMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Returns the mesh built so far, without copying it.
+     * @return The mesh built so far
      */
-    [[nodiscard]] std::unique_ptr<Mesh3D> mesh3D() override;
+    [[nodiscard]] const Mesh3D& preparedMesh() const override;
 
     /**
      * Adds a quad to the mesh based on the specified mesh region details.
@@ -55,36 +62,13 @@ public:
     void addQuad(const Block::Face& blockFace, Block::TextureId blockId,
                  const Block::Coordinate& blockPosition);
 
-
 private:
     /**
-     * @brief For a given face block, it adds vertices building it up
-     * @param blockFace Block face ID
-     * @param blockPosition Position of the block in space
-     */
-    [[nodiscard]] glm::vec3 addBlockFaceVertices(const Block::Face& blockFace,
-                                                 const Block::Coordinate& blockPosition,
-                                                 int i) const;
-    /**
-     * Calculates the vertices for a block face within the mesh.
-     *
-     * This method computes the positions of vertices for a given face of a block,
-     * considering the block's position, the dimensions of the face, and a specific index or
-     * identifier that may influence the calculation. It's used to generate the vertex data
-     * necessary for rendering the block face.
-     *
-     * @param blockFace The specific face of the block for which vertices are calculated.
-     * @param blockPosition The position of the block within the chunk.
-     * @param i An index or identifier related to the face's vertex calculation.
-     * @param width The width of the block face for which vertices are calculated.
-     * @param height The height of the block face for which vertices are calculated.
-     * @return The calculated vertices for the specified block face.
+     * Appends the four vertices of a quad to the mesh. The capacity of the vertices is kept
+     * between rebuilds, so this does not allocate once the mesh has been built before.
+     * @return Pointer to the first vertex of the quad
      */
-    [[nodiscard]] glm::vec3 addBlockFaceVertices(const Block::Face& blockFace,
-                                                 const Block::Coordinate& blockPosition, int i,
-                                                 float width, float height, QuadMode mode) const;
-    std::vector<GLfloat> faceVertices(const Block::Face& blockFace, QuadMode mode) const;
-    std::vector<GLfloat> faceVerticesForBinaryGreedy(const Block::Face& blockFace) const;
+    ChunkArrayMesh::VertexData* appendQuad();
 
 protected:
     /* ==== Members ===== */
@@ -0,0 +1,71 @@
+#include "ChunkArrayPackedMeshBuilder.h"
+
+#include <algorithm>
+
+namespace Voxino::Polygons
+{
+ChunkArrayPackedMeshBuilder::ChunkArrayPackedMeshBuilder()
+    : ChunkMeshBuilder()
+    , mMesh(std::make_unique<ChunkArrayPackedMesh>())
+{
+}
+
+void ChunkArrayPackedMeshBuilder::addQuad(const Block::Face& blockFace, Block::TextureId blockId,
+                                          const Block::Coordinate& blockPosition)
+{
+    const auto positions = quadVertices(blockFace, blockPosition);
+    auto* quad = appendQuad();
+    for (auto i = 0; i < VERTICES_PER_QUAD; ++i)
+    {
+        quad[i] = ChunkArrayPackedMesh::VertexData::pack(
+            glm::ivec3(positions[i]), blockFace, glm::ivec2(BLOCK_TEXTURE_QUAD[i]), blockId);
+    }
+}
+
+void ChunkArrayPackedMeshBuilder::addQuad(const MeshRegion& move, QuadMode mode)
+{
+    const auto positions = quadVertices(move.face, move.blockPosition,
+                                        static_cast<float>(move.width),
+                                        static_cast<float>(move.height), mode);
+    auto* quad = appendQuad();
+    for (auto i = 0; i < VERTICES_PER_QUAD; ++i)
+    {
+        quad[i] = ChunkArrayPackedMesh::VertexData::pack(
+            glm::ivec3(positions[i]), move.face, glm::ivec2(move.textureCoordinates[i]), move.id);
+    }
+}
+
+void ChunkArrayPackedMeshBuilder::addPackedQuad(const ChunkArrayPackedMesh::VertexData* quad)
+{
+    std::copy(quad, quad + VERTICES_PER_QUAD, appendQuad());
+}
+
+ChunkArrayPackedMesh::VertexData* ChunkArrayPackedMeshBuilder::appendQuad()
+{
+    auto& vertices = mMesh->vertices;
+    vertices.resize(vertices.size() + VERTICES_PER_QUAD);
+    return &vertices[vertices.size() - VERTICES_PER_QUAD];
+}
+
+void ChunkArrayPackedMeshBuilder::resetMesh()
+{
+    // Keep the capacity of the vertices, so rebuilding the mesh does not allocate again
+    mMesh->vertices.clear();
+}
+
+std::unique_ptr<Mesh3D> ChunkArrayPackedMeshBuilder::takeMesh()
+{
+    return std::exchange(mMesh, std::make_unique<ChunkArrayPackedMesh>());
+}
+
+void ChunkArrayPackedMeshBuilder::recycleMesh(std::unique_ptr<Mesh3D> mesh)
+{
+    mMesh.reset(static_cast<ChunkArrayPackedMesh*>(mesh.release()));
+    mMesh->reset();
+}
+
+const Mesh3D& ChunkArrayPackedMeshBuilder::preparedMesh() const
+{
+    return *mMesh;
+}
+}// namespace Voxino::Polygons
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Polygons/Meshes/Builders/ChunkMeshBuilder.h"
+#include "World/Polygons/Meshes/ChunkArrayPackedMesh.h"
+#include "pch.h"
+
+#include <World/Polygons/Meshes/MeshRegion.h>
+#include <World/Polygons/Meshes/Model3DIndexed.h>
+
+
+namespace Voxino::Polygons
+{
+/**
+ * It generates the same quads as ChunkArrayMeshBuilder, but stores them as packed vertices of
+ * ChunkArrayPackedMesh, which take a third of the memory. The mesh has to be drawn with the
+ * ChunkPacked shader.
+ */
+class ChunkArrayPackedMeshBuilder : public ChunkMeshBuilder
+{
+public:
+    using ModelType = Model3DIndexed;
+    ChunkArrayPackedMeshBuilder();
+
+    /**
+     * Resets the builder state, clearing any progress and setting it back to initial conditions.
+     */
+    void resetMesh() override;
+
+    /**
+     * Moves the built mesh out of the builder without copying it.
+     * @return The built mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh() override;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating.
+     * @param mesh Mesh of the type built by this builder
+     */
+    void recycleMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Returns the mesh built so far, without copying it.
+     * @return The mesh built so far
+     */
+    [[nodiscard]] const Mesh3D& preparedMesh() const override;
+
+    /**
+     * Adds a quad to the mesh based on the specified mesh region details.
+     * @param move The mesh region information used to define the quad's properties and placement.
+     */
+    void addQuad(const MeshRegion& move, QuadMode mode = NORMAL);
+
+    /**
+     * Adds a quad to the mesh in place of the designated face at the given coordinates and with the
+     * given quad texture.
+     * @param blockFace A block face to add
+     * @param blockId Texture identifier of the face
+     * @param blockPosition The position on which the quad will be added
+     */
+    void addQuad(const Block::Face& blockFace, Block::TextureId blockId,
+                 const Block::Coordinate& blockPosition);
+
+    /**
+     * Adds a quad that is already packed, e.g. one taken over from a previous mesh of the chunk.
+     * @param quad The four vertices of the quad
+     */
+    void addPackedQuad(const ChunkArrayPackedMesh::VertexData* quad);
+
+private:
+    /**
+     * Appends the four vertices of a quad to the mesh. The capacity of the vertices is kept
+     * between rebuilds, so this does not allocate once the mesh has been built before.
+     * @return Pointer to the first vertex of the quad
+     */
+    ChunkArrayPackedMesh::VertexData* appendQuad();
+
+protected:
+    /* ==== Members ===== */
+    std::unique_ptr<ChunkArrayPackedMesh> mMesh;
+};
+}// namespace Voxino::Polygons
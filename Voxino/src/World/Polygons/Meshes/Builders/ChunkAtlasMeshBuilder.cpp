@@ -15,50 +15,45 @@ ChunkAtlasMeshBuilder::ChunkAtlasMeshBuilder(Block::Coordinate origin)
 }
 
 void ChunkAtlasMeshBuilder::addQuad(const Block::Face& blockFace,
-                                    const std::vector<glm::vec2>& textureQuad,
+                                    const std::array<glm::vec2, VERTICES_PER_QUAD>& textureQuad,
                                     const Block::Coordinate& blockPosition)
 {
-    auto& indices = mMesh->indices;
-    for (auto i = 0; i < 4; ++i)
+    const auto positions = quadVertices(blockFace, blockPosition);
+    auto* quad = appendQuad();
+    for (auto i = 0; i < VERTICES_PER_QUAD; ++i)
     {
-        auto& vertex = mMesh->vertices.emplace_back();
-        vertex.position = addBlockFaceVertices(blockFace, blockPosition, i);
-        vertex.textureCoordinates = textureQuad[i];
-        // vertex.directionalLightning = addBlockFaceFakeLightning(blockFace);
+        quad[i].position = positions[i];
+        quad[i].textureCoordinates = textureQuad[i];
+        // quad[i].directionalLightning = addBlockFaceFakeLightning(blockFace);
     }
-    addBlockFaceIndices(indices);
 }
 
-glm::vec3 ChunkAtlasMeshBuilder::addBlockFaceVertices(const Block::Face& blockFace,
-                                                      const Block::Coordinate& blockPosition,
-                                                      int i) const
+ChunkAtlasMesh::VertexData* ChunkAtlasMeshBuilder::appendQuad()
 {
-    /*
-     * Some blocks are larger than others.
-     * It would be good if they were not just longer in one plane,
-     * but it was spread out among all of them -- increased relative to the center.
-     */
-    const auto blockSizeDifference = 0;// none now
-    const auto mBlockFaceSize = Block::BLOCK_SIZE;
+    auto& vertices = mMesh->vertices;
+    vertices.resize(vertices.size() + VERTICES_PER_QUAD);
+    return &vertices[vertices.size() - VERTICES_PER_QUAD];
+}
 
-    auto face = faceVertices(blockFace);
-    const auto& originPos = mOrigin.nonBlockMetric();
-    const auto& blockPos = blockPosition.nonBlockMetric();
+void ChunkAtlasMeshBuilder::resetMesh()
+{
+    // Keep the capacity of the vertices, so rebuilding the mesh does not allocate again
+    mMesh->vertices.clear();
+}
 
-    i *= 3;
-    return {face[i] * mBlockFaceSize + originPos.x + blockPos.x - blockSizeDifference,
-            face[i + 1] * mBlockFaceSize + originPos.y + blockPos.y - blockSizeDifference,
-            face[i + 2] * mBlockFaceSize + originPos.z + blockPos.z - blockSizeDifference};
+std::unique_ptr<Mesh3D> ChunkAtlasMeshBuilder::takeMesh()
+{
+    return std::exchange(mMesh, std::make_unique<ChunkAtlasMesh>());
 }
 
-void ChunkAtlasMeshBuilder::resetMesh()
+void ChunkAtlasMeshBuilder::recycleMesh(std::unique_ptr<Mesh3D> mesh)
 {
-    mMesh = std::make_unique<ChunkAtlasMesh>();
-    mIndex = 0;
+    mMesh.reset(static_cast<ChunkAtlasMesh*>(mesh.release()));
+    mMesh->reset();
 }
 
-std::unique_ptr<Mesh3D> ChunkAtlasMeshBuilder::mesh3D()
+const Mesh3D& ChunkAtlasMeshBuilder::preparedMesh() const
 {
-    return mMesh->clone();
+    return *mMesh;
 }
 }// namespace Voxino::Polygons
\ No newline at end of file
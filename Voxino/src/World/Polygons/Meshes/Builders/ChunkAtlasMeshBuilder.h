@@ -26,10 +26,23 @@ public:
     void resetMesh() override;
 
     /**
-     * Returns the 3d mesh created
-     * @return The created 3D mesh
+     * Moves the built mesh out of the builder without copying it.
+     * @return The built mesh
      */
-    [[nodiscard]] std::unique_ptr<Mesh3D> mesh3D() override;
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh() override;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating.
+     * @param mesh Mesh of the type built by this builder
+     */
+    void recycleMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Returns the mesh built so far, without copying it.
+     * @return The mesh built so far
+     */
+    [[nodiscard]] const Mesh3D& preparedMesh() const override;
 
     /**
      * Adds a quad to the mesh in place of the designated face at the given coordinates and with the
@@ -38,18 +51,17 @@ public:
      * @param textureQuad Position in the texture pack of the texture to be displayed
      * @param blockPosition The position on which the quad will be added
      */
-    void addQuad(const Block::Face& blockFace, const std::vector<glm::vec2>& textureQuad,
+    void addQuad(const Block::Face& blockFace,
+                 const std::array<glm::vec2, VERTICES_PER_QUAD>& textureQuad,
                  const Block::Coordinate& blockPosition);
 
 private:
     /**
-     * @brief For a given face block, it adds vertices building it up
-     * @param blockFace Block face ID
-     * @param blockPosition Position of the block in space
+     * Appends the four vertices of a quad to the mesh. The capacity of the vertices is kept
+     * between rebuilds, so this does not allocate once the mesh has been built before.
+     * @return Pointer to the first vertex of the quad
      */
-    [[nodiscard]] glm::vec3 addBlockFaceVertices(const Block::Face& blockFace,
-                                                 const Block::Coordinate& blockPosition,
-                                                 int i) const;
+    ChunkAtlasMesh::VertexData* appendQuad();
 
 protected:
     /* ==== Members ===== */
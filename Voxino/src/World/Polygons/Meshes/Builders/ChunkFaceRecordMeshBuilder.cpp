@@ -0,0 +1,46 @@
+#include "ChunkFaceRecordMeshBuilder.h"
+namespace Voxino::Polygons
+{
+ChunkFaceRecordMeshBuilder::ChunkFaceRecordMeshBuilder()
+    : ChunkMeshBuilder()
+    , mMesh(std::make_unique<ChunkFaceRecordMesh>())
+{
+}
+
+void ChunkFaceRecordMeshBuilder::addFace(const Block::Face& blockFace,
+                                         Block::TextureId blockTextureId,
+                                         const Block::Coordinate& blockPosition)
+{
+    mMesh->faces.push_back(ChunkFaceRecordMesh::FaceRecord::pack(glm::ivec3(blockPosition),
+                                                                 blockFace, blockTextureId));
+}
+
+void ChunkFaceRecordMeshBuilder::addQuad(const MeshRegion& region)
+{
+    mMesh->faces.push_back(ChunkFaceRecordMesh::FaceRecord::pack(
+        glm::ivec3(region.blockPosition), region.face, region.id, static_cast<int>(region.width),
+        static_cast<int>(region.height)));
+}
+
+void ChunkFaceRecordMeshBuilder::resetMesh()
+{
+    // Keep the capacity of the records, so rebuilding the mesh does not allocate again
+    mMesh->faces.clear();
+}
+
+std::unique_ptr<Mesh3D> ChunkFaceRecordMeshBuilder::takeMesh()
+{
+    return std::exchange(mMesh, std::make_unique<ChunkFaceRecordMesh>());
+}
+
+void ChunkFaceRecordMeshBuilder::recycleMesh(std::unique_ptr<Mesh3D> mesh)
+{
+    mMesh.reset(static_cast<ChunkFaceRecordMesh*>(mesh.release()));
+    mMesh->reset();
+}
+
+const Mesh3D& ChunkFaceRecordMeshBuilder::preparedMesh() const
+{
+    return *mMesh;
+}
+}// namespace Voxino::Polygons
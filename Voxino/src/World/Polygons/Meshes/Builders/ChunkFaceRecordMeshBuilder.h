@@ -0,0 +1,65 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Polygons/Meshes/Builders/ChunkMeshBuilder.h"
+#include "World/Polygons/Meshes/ChunkFaceRecordMesh.h"
+#include "World/Polygons/Meshes/MeshRegion.h"
+#include "World/Polygons/Meshes/Model3DInstanced.h"
+
+
+namespace Voxino::Polygons
+{
+/**
+ * It stores every visible face as a single record of ChunkFaceRecordMesh. The vertices of the faces
+ * are never built on the CPU, the shader ChunkCullingInstanced creates them while drawing.
+ */
+class ChunkFaceRecordMeshBuilder : public ChunkMeshBuilder
+{
+public:
+    using ModelType = Model3DInstanced;
+    ChunkFaceRecordMeshBuilder();
+
+    /**
+     * Resets the builder state, clearing any progress and setting it back to initial conditions.
+     */
+    void resetMesh() override;
+
+    /**
+     * Moves the built mesh out of the builder without copying it.
+     * @return The built mesh
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh() override;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating.
+     * @param mesh Mesh of the type built by this builder
+     */
+    void recycleMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Returns the mesh built so far, without copying it.
+     * @return The mesh built so far
+     */
+    [[nodiscard]] const Mesh3D& preparedMesh() const override;
+
+    /**
+     * Adds a record of a single face of the block at the given coordinates.
+     * @param blockFace A block face to add
+     * @param blockTextureId Texture identifier of the face
+     * @param blockPosition Position of the block relative to the chunk
+     */
+    void addFace(const Block::Face& blockFace, Block::TextureId blockTextureId,
+                 const Block::Coordinate& blockPosition);
+
+    /**
+     * Adds a record of a merged quad, which covers width x height faces.
+     * @param region The mesh region describing the quad.
+     */
+    void addQuad(const MeshRegion& region);
+
+protected:
+    /* ==== Members ===== */
+    std::unique_ptr<ChunkFaceRecordMesh> mMesh;
+};
+}// namespace Voxino::Polygons
@@ -19,82 +19,55 @@ float ChunkMeshBuilder::addBlockFaceFakeLightning(const Block::Face& blockFace)
     return 1.0f;
 }
 
-void ChunkMeshBuilder::addBlockFaceIndices(std::vector<GLuint>& indices)
+ChunkMeshBuilder::QuadVertices ChunkMeshBuilder::quadVertices(
+    Block::Face blockFace, const glm::ivec3& blockPosition) const
 {
-    // clang-format off
-    indices.insert(indices.end(),
-                   {
-                    mIndex,
-                    mIndex + 1,
-                    mIndex + 2,
-
-                    mIndex + 2,
-                    mIndex + 3,
-                    mIndex
-                   });
-    // clang-format on
-    mIndex += 4;
+    const auto& face = FACE_VERTICES[static_cast<int>(blockFace)];
+    const auto origin = blockOrigin(blockPosition);
+    constexpr auto blockSize = static_cast<float>(Block::BLOCK_SIZE);
+    return {face[0] * blockSize + origin, face[1] * blockSize + origin,
+            face[2] * blockSize + origin, face[3] * blockSize + origin};
 }
 
-std::vector<GLfloat> ChunkMeshBuilder::faceVertices(const Block::Face& blockFace) const
+ChunkMeshBuilder::QuadVertices ChunkMeshBuilder::quadVertices(Block::Face blockFace,
+                                                              const glm::ivec3& blockPosition,
+                                                              float width, float height,
+                                                              QuadMode mode) const
 {
+    const auto& faces = (mode == BINARY_GREEDY) ? BINARY_GREEDY_FACE_VERTICES : FACE_VERTICES;
+    const auto& face = faces[static_cast<int>(blockFace)];
+    const auto origin = blockOrigin(blockPosition);
+
+    glm::vec3 scale;
     switch (blockFace)
     {
         case Block::Face::Top:
-            return {
-                // x  y  z
-                0, 1, 1,// top far left
-                1, 1, 1,// top far right
-                1, 1, 0,// top close right
-                0, 1, 0,// top close left
-            };
-
+        case Block::Face::Bottom:
+            // For top and bottom, width spans x and height spans z
+            scale = {width, 1.0f, height};
+            break;
         case Block::Face::Left:
-            return {
-                // x  y  z
-                0, 0, 0,// left bottom close
-                0, 0, 1,// left bottom far
-                0, 1, 1,// left top far
-                0, 1, 0 // left top close
-            };
-
         case Block::Face::Right:
-            return {
-                // x  y  z
-                1, 0, 1,// right bottom far
-                1, 0, 0,// right bottom close
-                1, 1, 0,// right top close
-                1, 1, 1 // right top far
-            };
-
-        case Block::Face::Bottom:
-            return {
-                // x  y  z
-                0, 0, 0,// bottom left close
-                1, 0, 0,// bottom right close
-                1, 0, 1,// bottom right far
-                0, 0, 1 // bottom left far
-            };
-
+            // For left and right, width spans z and height spans y
+            scale = {1.0f, height, width};
+            break;
         case Block::Face::Front:
-            return {
-                // x  y  z
-                0, 0, 1,// front left bottom
-                1, 0, 1,// front right bottom
-                1, 1, 1,// front right top
-                0, 1, 1 // front left top
-            };
-
         case Block::Face::Back:
-            return {
-                // x  y  z
-                1, 0, 0,// back right bottom
-                0, 0, 0,// back left bottom
-                0, 1, 0,// back left top
-                1, 1, 0,// back right top
-            };
+            // For front and back, width spans x and height spans y
+            scale = {width, height, 1.0f};
+            break;
         default: throw std::runtime_error("Unsupported Block::Face value was provided");
     }
+
+    return {face[0] * scale + origin, face[1] * scale + origin, face[2] * scale + origin,
+            face[3] * scale + origin};
+}
+
+glm::vec3 ChunkMeshBuilder::blockOrigin(const glm::ivec3& blockPosition) const
+{
+    const auto& originPos = mOrigin.nonBlockMetric();
+    return glm::vec3(originPos.x, originPos.y, originPos.z) +
+           glm::vec3(blockPosition * Block::BLOCK_SIZE);
 }
 
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -15,24 +15,97 @@ class ChunkMeshBuilder : public MeshBuilder
 {
     using MeshBuilder::MeshBuilder;
 
+public:
+    enum QuadMode
+    {
+        BINARY_GREEDY,
+        NORMAL
+    };
+
+    static constexpr auto VERTICES_PER_QUAD = 4;
+    static constexpr auto NUMBER_OF_FACES = static_cast<int>(Block::Face::Counter);
+
+    /** Positions of the four corners of a quad. */
+    using QuadVertices = std::array<glm::vec3, VERTICES_PER_QUAD>;
+
+    /** Texture coordinates of the corners of a quad covering a single block face. */
+    static constexpr auto BLOCK_TEXTURE_QUAD = std::array{
+        glm::vec2(1, 1),//
+        glm::vec2(0, 1),//
+        glm::vec2(0, 0),//
+        glm::vec2(1, 0) //
+    };
+
+    // clang-format off
+    /** Corners of every face of a unit block, indexed by Block::Face. */
+    static constexpr std::array<QuadVertices, NUMBER_OF_FACES> FACE_VERTICES = {{
+        // Bottom: left close, right close, right far, left far
+        {glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 0, 1), glm::vec3(0, 0, 1)},
+        // Top: far left, far right, close right, close left
+        {glm::vec3(0, 1, 1), glm::vec3(1, 1, 1), glm::vec3(1, 1, 0), glm::vec3(0, 1, 0)},
+        // Left: bottom close, bottom far, top far, top close
+        {glm::vec3(0, 0, 0), glm::vec3(0, 0, 1), glm::vec3(0, 1, 1), glm::vec3(0, 1, 0)},
+        // Right: bottom far, bottom close, top close, top far
+        {glm::vec3(1, 0, 1), glm::vec3(1, 0, 0), glm::vec3(1, 1, 0), glm::vec3(1, 1, 1)},
+        // Front: left bottom, right bottom, right top, left top
+        {glm::vec3(0, 0, 1), glm::vec3(1, 0, 1), glm::vec3(1, 1, 1), glm::vec3(0, 1, 1)},
+        // Back: right bottom, left bottom, left top, right top
+        {glm::vec3(1, 0, 0), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0), glm::vec3(1, 1, 0)},
+    }};
+
+    /**
+     * Corners of every face of a unit block used by the binary greedy mesher, indexed by
+     * Block::Face. Front and back faces lie on the opposite side of the unit block and start in a
+     * different corner, matching the block and texture coordinates computed by that mesher.
+     */
+    static constexpr std::array<QuadVertices, NUMBER_OF_FACES> BINARY_GREEDY_FACE_VERTICES = {{
+        FACE_VERTICES[static_cast<int>(Block::Face::Bottom)],
+        FACE_VERTICES[static_cast<int>(Block::Face::Top)],
+        FACE_VERTICES[static_cast<int>(Block::Face::Left)],
+        FACE_VERTICES[static_cast<int>(Block::Face::Right)],
+        // Front: left bottom, right bottom, right top, left top
+        {glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 1, 0), glm::vec3(0, 1, 0)},
+        // Back: right bottom, left bottom, left top, right top
+        {glm::vec3(1, 0, 1), glm::vec3(0, 0, 1), glm::vec3(0, 1, 1), glm::vec3(1, 1, 1)},
+    }};
+    // clang-format on
+
 protected:
     /**
-     * Returns the vertices for a given block face
+     * Returns the corners of a single face of a block.
      * @param blockFace The face of the block
-     * @return The vertices for a given block face
+     * @param blockPosition Position of the block relative to the origin of the builder
+     * @return Positions of the four corners of the face
      */
-    [[nodiscard]] std::vector<GLfloat> faceVertices(const Block::Face& blockFace) const;
+    [[nodiscard]] QuadVertices quadVertices(Block::Face blockFace,
+                                            const glm::ivec3& blockPosition) const;
 
     /**
-     * @brief Adds indices of typical block face
-     * @param indices Indices to which new indices are to be added
+     * Returns the corners of a quad covering width x height faces of blocks lying next to each
+     * other, e.g. a region found by the greedy meshing.
+     * @param blockFace The face of the blocks
+     * @param blockPosition Position of the first block relative to the origin of the builder
+     * @param width Number of blocks covered along the first axis of the face
+     * @param height Number of blocks covered along the second axis of the face
+     * @param mode Selects the table of corners
+     * @return Positions of the four corners of the quad
      */
-    void addBlockFaceIndices(std::vector<GLuint>& indices);
+    [[nodiscard]] QuadVertices quadVertices(Block::Face blockFace,
+                                            const glm::ivec3& blockPosition, float width,
+                                            float height, QuadMode mode) const;
 
     /**
      * @brief Adds false lighting to block wall
      * @param blockFace Block face ID
      */
     [[nodiscard]] float addBlockFaceFakeLightning(const Block::Face& blockFace) const;
+
+private:
+    /**
+     * Returns the position of the corner of the block closest to the origin of the world.
+     * @param blockPosition Position of the block relative to the origin of the builder
+     * @return Position in non-block-grid space
+     */
+    [[nodiscard]] glm::vec3 blockOrigin(const glm::ivec3& blockPosition) const;
 };
-}// namespace Voxino::Polygons
\ No newline at end of file
+}// namespace Voxino::Polygons
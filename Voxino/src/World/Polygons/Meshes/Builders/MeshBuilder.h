@@ -27,13 +27,27 @@ public:
     virtual void resetMesh() = 0;
 
     /**
-     * Returns the 3d mesh created
-     * @return The created 3D mesh
+     * Moves the built mesh out of the builder without copying it. The builder continues with an
+     * empty mesh, or with the storage handed over by recycleMesh().
+     * @return The built mesh
      */
-    [[nodiscard]] virtual std::unique_ptr<Mesh3D> mesh3D() = 0;
+    [[nodiscard]] virtual std::unique_ptr<Mesh3D> takeMesh() = 0;
+
+    /**
+     * Takes over the storage of a mesh that is no longer displayed, so the next mesh is built
+     * without allocating. Anything built since the last takeMesh() is discarded.
+     * @param mesh Mesh of the type built by this builder
+     */
+    virtual void recycleMesh(std::unique_ptr<Mesh3D> mesh) = 0;
+
+    /**
+     * Returns the mesh built so far, without copying it. It holds only CPU data, so it can be
+     * inspected without an OpenGL context.
+     * @return The mesh built so far
+     */
+    [[nodiscard]] virtual const Mesh3D& preparedMesh() const = 0;
 
 protected:
-    GLuint mIndex = 0;
     Block::Coordinate mOrigin;
 };
 
@@ -11,7 +11,6 @@ VertexBuffer ChunkArrayCullingGpuMesh::vertexBuffer()
 void ChunkArrayCullingGpuMesh::reset()
 {
     vertices.clear();
-    indices.clear();
 }
 
 BufferLayout ChunkArrayCullingGpuMesh::bufferLayout()
@@ -29,12 +28,12 @@ std::unique_ptr<Mesh3D> ChunkArrayCullingGpuMesh::clone()
     return std::make_unique<ChunkArrayCullingGpuMesh>(*this);
 }
 
-int ChunkArrayCullingGpuMesh::numberOfVertices()
+int ChunkArrayCullingGpuMesh::numberOfVertices() const
 {
     return vertices.size();
 }
 
-unsigned long ChunkArrayCullingGpuMesh::memorySize()
+unsigned long ChunkArrayCullingGpuMesh::memorySize() const
 {
     return sizeof(VertexData) * vertices.size();
 }
@@ -11,7 +11,6 @@ VertexBuffer ChunkArrayMesh::vertexBuffer()
 void ChunkArrayMesh::reset()
 {
     vertices.clear();
-    indices.clear();
 }
 
 BufferLayout ChunkArrayMesh::bufferLayout()
@@ -29,12 +28,12 @@ std::unique_ptr<Mesh3D> ChunkArrayMesh::clone()
     return std::make_unique<ChunkArrayMesh>(*this);
 }
 
-int ChunkArrayMesh::numberOfVertices()
+int ChunkArrayMesh::numberOfVertices() const
 {
     return vertices.size();
 }
 
-unsigned long ChunkArrayMesh::memorySize()
+unsigned long ChunkArrayMesh::memorySize() const
 {
     return sizeof(VertexData) * vertices.size();
 }
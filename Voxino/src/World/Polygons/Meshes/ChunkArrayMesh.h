@@ -38,13 +38,13 @@ struct ChunkArrayMesh : public Mesh3D
      * Returns the number of vertices.
      * @return Number of vertices.
      */
-    int numberOfVertices() override;
+    int numberOfVertices() const override;
 
     /**
      * Returns the size in memory that the mesh occupies
      * @return The size in memory in bytes that the mesh occupies
      */
-    unsigned long memorySize() override;
+    unsigned long memorySize() const override;
 
     /* ==== Members ===== */
     struct VertexData
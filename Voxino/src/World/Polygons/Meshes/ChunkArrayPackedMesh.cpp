@@ -0,0 +1,87 @@
+#include "ChunkArrayPackedMesh.h"
+
+namespace Voxino::Polygons
+{
+namespace
+{
+constexpr auto COORDINATE_MASK = ChunkArrayPackedMesh::MAX_COORDINATE;
+constexpr auto FACE_MASK = (1u << ChunkArrayPackedMesh::FACE_BITS) - 1;
+constexpr auto Y_SHIFT = ChunkArrayPackedMesh::COORDINATE_BITS;
+constexpr auto Z_SHIFT = 2 * ChunkArrayPackedMesh::COORDINATE_BITS;
+constexpr auto FACE_SHIFT = 3 * ChunkArrayPackedMesh::COORDINATE_BITS;
+constexpr auto V_SHIFT = ChunkArrayPackedMesh::COORDINATE_BITS;
+constexpr auto TEXTURE_ID_SHIFT = 2 * ChunkArrayPackedMesh::COORDINATE_BITS;
+}// namespace
+
+VertexBuffer ChunkArrayPackedMesh::vertexBuffer()
+{
+    VertexBuffer vb(vertices);
+    return vb;
+}
+
+void ChunkArrayPackedMesh::reset()
+{
+    vertices.clear();
+}
+
+BufferLayout ChunkArrayPackedMesh::bufferLayout()
+{
+    BufferLayout bl;
+    bl.push<unsigned int>(1);// position and face
+    bl.push<unsigned int>(1);// texture coordinates and texture id
+    return bl;
+}
+
+std::unique_ptr<Mesh3D> ChunkArrayPackedMesh::clone()
+{
+    return std::make_unique<ChunkArrayPackedMesh>(*this);
+}
+
+int ChunkArrayPackedMesh::numberOfVertices() const
+{
+    return vertices.size();
+}
+
+unsigned long ChunkArrayPackedMesh::memorySize() const
+{
+    return sizeof(VertexData) * vertices.size();
+}
+
+ChunkArrayPackedMesh::VertexData ChunkArrayPackedMesh::VertexData::pack(
+    const glm::ivec3& position, Block::Face face, const glm::ivec2& textureCoordinates,
+    Block::TextureId textureId)
+{
+    VertexData vertex;
+    vertex.position = (static_cast<std::uint32_t>(position.x) & COORDINATE_MASK) |
+                      (static_cast<std::uint32_t>(position.y) & COORDINATE_MASK) << Y_SHIFT |
+                      (static_cast<std::uint32_t>(position.z) & COORDINATE_MASK) << Z_SHIFT |
+                      (static_cast<std::uint32_t>(face) & FACE_MASK) << FACE_SHIFT;
+    vertex.texture = (static_cast<std::uint32_t>(textureCoordinates.x) & COORDINATE_MASK) |
+                     (static_cast<std::uint32_t>(textureCoordinates.y) & COORDINATE_MASK)
+                         << V_SHIFT |
+                     (textureId & MAX_TEXTURE_ID) << TEXTURE_ID_SHIFT;
+    return vertex;
+}
+
+glm::ivec3 ChunkArrayPackedMesh::VertexData::unpackPosition() const
+{
+    return {position & COORDINATE_MASK, (position >> Y_SHIFT) & COORDINATE_MASK,
+            (position >> Z_SHIFT) & COORDINATE_MASK};
+}
+
+Block::Face ChunkArrayPackedMesh::VertexData::unpackFace() const
+{
+    return static_cast<Block::Face>((position >> FACE_SHIFT) & FACE_MASK);
+}
+
+glm::ivec2 ChunkArrayPackedMesh::VertexData::unpackTextureCoordinates() const
+{
+    return {texture & COORDINATE_MASK, (texture >> V_SHIFT) & COORDINATE_MASK};
+}
+
+Block::TextureId ChunkArrayPackedMesh::VertexData::unpackTextureId() const
+{
+    return texture >> TEXTURE_ID_SHIFT;
+}
+
+}// namespace Voxino::Polygons
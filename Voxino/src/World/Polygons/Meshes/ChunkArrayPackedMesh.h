@@ -0,0 +1,113 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Polygons/Meshes/Mesh3D.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace Voxino::Polygons
+{
+/**
+ * @brief Mesh of the blocks of a chunk, in which every vertex is packed into two 32-bit words.
+ *
+ * Positions of the vertices are relative to the chunk, as the chunk is moved into place by the
+ * model matrix, so they fit into a few bits. The shader ChunkPacked.vs unpacks them:
+ * - position word: x in bits 0-6, y in bits 7-13, z in bits 14-20, face in bits 21-23
+ * - texture word: u in bits 0-6, v in bits 7-13, texture id in bits 14-31
+ * Texture coordinates are whole numbers, as the texture repeats once per block of a merged quad.
+ */
+struct ChunkArrayPackedMesh : public Mesh3D
+{
+    static constexpr auto COORDINATE_BITS = 7;
+    static constexpr auto FACE_BITS = 3;
+    static constexpr auto TEXTURE_ID_BITS = 18;
+    static constexpr auto MAX_COORDINATE = (1u << COORDINATE_BITS) - 1;
+    static constexpr auto MAX_TEXTURE_ID = (1u << TEXTURE_ID_BITS) - 1;
+    // Bits of the position word left free, used by ChunkMeshArena to tell the chunks apart
+    static constexpr auto CHUNK_SLOT_SHIFT = 3 * COORDINATE_BITS + FACE_BITS;
+    static constexpr auto CHUNK_SLOT_BITS = 32 - CHUNK_SLOT_SHIFT;
+    static_assert(static_cast<unsigned>(ChunkBlocks::BLOCKS_PER_DIMENSION) <= MAX_COORDINATE,
+                  "Vertices of the chunk must fit into the packed coordinates");
+
+    /**
+     * @brief Returns the Vertex Buffer that creates the mesh
+     * @return Vertex Buffer that creates the mesh
+     */
+    VertexBuffer vertexBuffer() override;
+
+    /**
+     * @brief Resets mesh to initial values (clears it).
+     */
+    void reset() override;
+
+    /**
+     * @brief Returns BufferLayout, which determines the memory layout of a given mesh
+     * @return BufferLayout, which determines the memory layout of a given mesh
+     */
+    BufferLayout bufferLayout() override;
+
+    /**
+     * @brief Copies the mesh and returns a pointer to its copy
+     * @return Pointer to mesh copy
+     */
+    std::unique_ptr<Mesh3D> clone() override;
+
+    /**
+     * Returns the number of vertices.
+     * @return Number of vertices.
+     */
+    int numberOfVertices() const override;
+
+    /**
+     * Returns the size in memory that the mesh occupies
+     * @return The size in memory in bytes that the mesh occupies
+     */
+    unsigned long memorySize() const override;
+
+    /* ==== Members ===== */
+    struct VertexData
+    {
+        std::uint32_t position{};
+        std::uint32_t texture{};
+
+        /**
+         * Packs a single vertex.
+         * @param position Position of the vertex relative to the chunk
+         * @param face Face of the block to which the vertex belongs
+         * @param textureCoordinates Texture coordinates of the vertex
+         * @param textureId Texture of the face
+         * @return Packed vertex
+         */
+        static VertexData pack(const glm::ivec3& position, Block::Face face,
+                               const glm::ivec2& textureCoordinates, Block::TextureId textureId);
+
+        /**
+         * Unpacks the position of the vertex, the same way as the shader does.
+         * @return Position of the vertex relative to the chunk
+         */
+        [[nodiscard]] glm::ivec3 unpackPosition() const;
+
+        /**
+         * Unpacks the face of the block to which the vertex belongs.
+         * @return Face of the block
+         */
+        [[nodiscard]] Block::Face unpackFace() const;
+
+        /**
+         * Unpacks the texture coordinates of the vertex, the same way as the shader does.
+         * @return Texture coordinates of the vertex
+         */
+        [[nodiscard]] glm::ivec2 unpackTextureCoordinates() const;
+
+        /**
+         * Unpacks the texture of the face, the same way as the shader does.
+         * @return Texture of the face
+         */
+        [[nodiscard]] Block::TextureId unpackTextureId() const;
+    };
+    static_assert(sizeof(VertexData) == 8, "Packed vertex must take exactly two words");
+    std::vector<VertexData> vertices;
+};
+}// namespace Voxino::Polygons
@@ -11,7 +11,6 @@ VertexBuffer ChunkAtlasMesh::vertexBuffer()
 void ChunkAtlasMesh::reset()
 {
     vertices.clear();
-    indices.clear();
 }
 
 BufferLayout ChunkAtlasMesh::bufferLayout()
@@ -28,11 +27,11 @@ std::unique_ptr<Mesh3D> ChunkAtlasMesh::clone()
     return std::make_unique<ChunkAtlasMesh>(*this);
 }
 
-int ChunkAtlasMesh::numberOfVertices()
+int ChunkAtlasMesh::numberOfVertices() const
 {
     return vertices.size();
 }
-unsigned long ChunkAtlasMesh::memorySize()
+unsigned long ChunkAtlasMesh::memorySize() const
 {
     return sizeof(VertexData) * vertices.size();
 }
@@ -0,0 +1,89 @@
+#include "ChunkFaceRecordMesh.h"
+
+namespace Voxino::Polygons
+{
+namespace
+{
+constexpr auto COORDINATE_MASK = ChunkFaceRecordMesh::MAX_COORDINATE;
+constexpr auto FACE_MASK = (1u << ChunkFaceRecordMesh::FACE_BITS) - 1;
+constexpr auto Y_SHIFT = ChunkFaceRecordMesh::COORDINATE_BITS;
+constexpr auto Z_SHIFT = 2 * ChunkFaceRecordMesh::COORDINATE_BITS;
+constexpr auto FACE_SHIFT = 3 * ChunkFaceRecordMesh::COORDINATE_BITS;
+constexpr auto WIDTH_SHIFT = ChunkFaceRecordMesh::TEXTURE_ID_BITS;
+constexpr auto HEIGHT_SHIFT = ChunkFaceRecordMesh::TEXTURE_ID_BITS +
+                              ChunkFaceRecordMesh::COORDINATE_BITS;
+}// namespace
+
+VertexBuffer ChunkFaceRecordMesh::vertexBuffer()
+{
+    VertexBuffer vb(faces);
+    return vb;
+}
+
+void ChunkFaceRecordMesh::reset()
+{
+    faces.clear();
+}
+
+BufferLayout ChunkFaceRecordMesh::bufferLayout()
+{
+    BufferLayout bl;
+    bl.push<unsigned int>(1);// position and face
+    bl.push<unsigned int>(1);// texture id and size of the quad
+    return bl;
+}
+
+std::unique_ptr<Mesh3D> ChunkFaceRecordMesh::clone()
+{
+    return std::make_unique<ChunkFaceRecordMesh>(*this);
+}
+
+int ChunkFaceRecordMesh::numberOfVertices() const
+{
+    return faces.size();
+}
+
+unsigned long ChunkFaceRecordMesh::memorySize() const
+{
+    return sizeof(FaceRecord) * faces.size();
+}
+
+ChunkFaceRecordMesh::FaceRecord ChunkFaceRecordMesh::FaceRecord::pack(const glm::ivec3& position,
+                                                                      Block::Face face,
+                                                                      Block::TextureId textureId,
+                                                                      int width, int height)
+{
+    FaceRecord record;
+    record.position = (static_cast<std::uint32_t>(position.x) & COORDINATE_MASK) |
+                      (static_cast<std::uint32_t>(position.y) & COORDINATE_MASK) << Y_SHIFT |
+                      (static_cast<std::uint32_t>(position.z) & COORDINATE_MASK) << Z_SHIFT |
+                      (static_cast<std::uint32_t>(face) & FACE_MASK) << FACE_SHIFT;
+    record.texture = (textureId & MAX_TEXTURE_ID) |
+                     (static_cast<std::uint32_t>(width - 1) & COORDINATE_MASK) << WIDTH_SHIFT |
+                     (static_cast<std::uint32_t>(height - 1) & COORDINATE_MASK) << HEIGHT_SHIFT;
+    return record;
+}
+
+glm::ivec3 ChunkFaceRecordMesh::FaceRecord::unpackPosition() const
+{
+    return {position & COORDINATE_MASK, (position >> Y_SHIFT) & COORDINATE_MASK,
+            (position >> Z_SHIFT) & COORDINATE_MASK};
+}
+
+Block::Face ChunkFaceRecordMesh::FaceRecord::unpackFace() const
+{
+    return static_cast<Block::Face>((position >> FACE_SHIFT) & FACE_MASK);
+}
+
+Block::TextureId ChunkFaceRecordMesh::FaceRecord::unpackTextureId() const
+{
+    return texture & MAX_TEXTURE_ID;
+}
+
+glm::ivec2 ChunkFaceRecordMesh::FaceRecord::unpackSize() const
+{
+    return {((texture >> WIDTH_SHIFT) & COORDINATE_MASK) + 1,
+            ((texture >> HEIGHT_SHIFT) & COORDINATE_MASK) + 1};
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "World/Block/Block.h"
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Polygons/Meshes/Mesh3D.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace Voxino::Polygons
+{
+/**
+ * @brief Mesh of the blocks of a chunk, in which every visible face is a single record of two
+ * 32-bit words instead of four vertices.
+ *
+ * The records are drawn as instances by Model3DInstanced, and the shader ChunkCullingInstanced.vs
+ * builds the six vertices of the quad of every face from gl_VertexID:
+ * - position word: x in bits 0-5, y in bits 6-11, z in bits 12-17, face in bits 18-20
+ * - texture word: texture id in bits 0-15, width - 1 in bits 16-21, height - 1 in bits 22-27
+ * Positions are relative to the chunk, as the chunk is moved into place by the model matrix.
+ */
+struct ChunkFaceRecordMesh : public Mesh3D
+{
+    static constexpr auto COORDINATE_BITS = 6;
+    static constexpr auto FACE_BITS = 3;
+    static constexpr auto TEXTURE_ID_BITS = 16;
+    static constexpr auto MAX_COORDINATE = (1u << COORDINATE_BITS) - 1;
+    static constexpr auto MAX_TEXTURE_ID = (1u << TEXTURE_ID_BITS) - 1;
+    static constexpr auto MAX_QUAD_SIZE = MAX_COORDINATE + 1;
+    static_assert(static_cast<unsigned>(ChunkBlocks::BLOCKS_PER_DIMENSION) <= MAX_QUAD_SIZE,
+                  "Faces of the chunk must fit into the packed coordinates");
+
+    /**
+     * @brief Returns the Vertex Buffer that creates the mesh
+     * @return Vertex Buffer that creates the mesh
+     */
+    VertexBuffer vertexBuffer() override;
+
+    /**
+     * @brief Resets mesh to initial values (clears it).
+     */
+    void reset() override;
+
+    /**
+     * @brief Returns BufferLayout, which determines the memory layout of a given mesh
+     * @return BufferLayout, which determines the memory layout of a given mesh
+     */
+    BufferLayout bufferLayout() override;
+
+    /**
+     * @brief Copies the mesh and returns a pointer to its copy
+     * @return Pointer to mesh copy
+     */
+    std::unique_ptr<Mesh3D> clone() override;
+
+    /**
+     * Returns the number of face records. Every record is drawn as a single instance.
+     * @return Number of face records.
+     */
+    int numberOfVertices() const override;
+
+    /**
+     * Returns the size in memory that the mesh occupies
+     * @return The size in memory in bytes that the mesh occupies
+     */
+    unsigned long memorySize() const override;
+
+    /* ==== Members ===== */
+    struct FaceRecord
+    {
+        std::uint32_t position{};
+        std::uint32_t texture{};
+
+        /**
+         * Packs a single face.
+         * @param position Position of the block relative to the chunk
+         * @param face Face of the block
+         * @param textureId Texture of the face
+         * @param width, height Size of the quad in blocks, 1 for a single face
+         * @return Packed face
+         */
+        static FaceRecord pack(const glm::ivec3& position, Block::Face face,
+                               Block::TextureId textureId, int width = 1, int height = 1);
+
+        /**
+         * Unpacks the position of the block, the same way as the shader does.
+         * @return Position of the block relative to the chunk
+         */
+        [[nodiscard]] glm::ivec3 unpackPosition() const;
+
+        /**
+         * Unpacks the face of the block.
+         * @return Face of the block
+         */
+        [[nodiscard]] Block::Face unpackFace() const;
+
+        /**
+         * Unpacks the texture of the face, the same way as the shader does.
+         * @return Texture of the face
+         */
+        [[nodiscard]] Block::TextureId unpackTextureId() const;
+
+        /**
+         * Unpacks the size of the quad, the same way as the shader does.
+         * @return Width and height of the quad in blocks
+         */
+        [[nodiscard]] glm::ivec2 unpackSize() const;
+    };
+    static_assert(sizeof(FaceRecord) == 8, "Face record must take exactly two words");
+    std::vector<FaceRecord> faces;
+};
+}// namespace Voxino::Polygons
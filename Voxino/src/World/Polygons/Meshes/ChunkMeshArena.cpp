@@ -0,0 +1,186 @@
+#include "ChunkMeshArena.h"
+#include "pch.h"
+
+namespace Voxino::Polygons
+{
+namespace
+{
+constexpr auto INITIAL_CAPACITY = 1u << 16;
+}// namespace
+
+ChunkMeshArena::ChunkMeshArena()
+    : mLayout(INITIAL_CAPACITY)
+    , mBufferLayout(ChunkArrayPackedMesh().bufferLayout())
+{
+    GLCall(glGenBuffers(1, &mOriginsBuffer));
+    GLCall(glBindBuffer(GL_TEXTURE_BUFFER, mOriginsBuffer));
+    GLCall(glBufferData(GL_TEXTURE_BUFFER,
+                        ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS * sizeof(glm::vec4), nullptr,
+                        GL_DYNAMIC_DRAW));
+
+    GLCall(glGenTextures(1, &mOriginsTexture));
+    GLCall(glBindTexture(GL_TEXTURE_BUFFER, mOriginsTexture));
+    GLCall(glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, mOriginsBuffer));
+    GLCall(glBindTexture(GL_TEXTURE_BUFFER, 0));
+    GLCall(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+
+    reallocate(mLayout.capacity());
+}
+
+ChunkMeshArena::~ChunkMeshArena()
+{
+    glDeleteBuffers(1, &mOriginsBuffer);
+    glDeleteTextures(1, &mOriginsTexture);
+}
+
+std::optional<ChunkMeshArena::Slot> ChunkMeshArena::addChunk(const glm::vec3& chunkPosition)
+{
+    const auto slot = mLayout.addChunk();
+    if (slot)
+    {
+        mChunkPositions[*slot] = chunkPosition;
+        const auto origin = glm::vec4(chunkPosition, 0.0f);
+        GLCall(glBindBuffer(GL_TEXTURE_BUFFER, mOriginsBuffer));
+        GLCall(glBufferSubData(GL_TEXTURE_BUFFER, *slot * sizeof(glm::vec4), sizeof(glm::vec4),
+                               glm::value_ptr(origin)));
+        GLCall(glBindBuffer(GL_TEXTURE_BUFFER, 0));
+    }
+    return slot;
+}
+
+void ChunkMeshArena::removeChunk(Slot slot)
+{
+    mLayout.removeChunk(slot);
+}
+
+void ChunkMeshArena::setMesh(Slot slot, const ChunkArrayPackedMesh& mesh)
+{
+    MEASURE_SCOPE;
+    const auto numberOfVertices = static_cast<unsigned int>(mesh.vertices.size());
+    auto verticesPerFace = ChunkMeshArenaLayout::VerticesPerFace{};
+    for (const auto& vertex: mesh.vertices)
+    {
+        ++verticesPerFace[static_cast<int>(vertex.unpackFace())];
+    }
+    const auto firstVertex = mLayout.place(slot, verticesPerFace);
+    if (mLayout.capacity() > mCapacity)
+    {
+        reallocate(mLayout.capacity());
+    }
+    QuadIndexBuffer::instance().reserve(mLayout.maxNumberOfVerticesPerChunk() /
+                                        QuadIndexBuffer::VERTICES_PER_QUAD);
+
+    if (numberOfVertices == 0)
+    {
+        return;
+    }
+
+    // Counting sort by the face direction. It keeps the order within a direction, so the four
+    // vertices of every quad stay together.
+    auto nextVertexOfFace = ChunkMeshArenaLayout::VerticesPerFace{};
+    for (auto face = std::size_t{1}; face < nextVertexOfFace.size(); ++face)
+    {
+        nextVertexOfFace[face] = nextVertexOfFace[face - 1] + verticesPerFace[face - 1];
+    }
+    const auto slotBits = slot << ChunkArrayPackedMesh::CHUNK_SLOT_SHIFT;
+    mUploadedVertices.resize(numberOfVertices);
+    for (const auto& vertex: mesh.vertices)
+    {
+        auto& uploadedVertex =
+            mUploadedVertices[nextVertexOfFace[static_cast<int>(vertex.unpackFace())]++];
+        uploadedVertex = vertex;
+        uploadedVertex.position |= slotBits;
+    }
+    mVertexBuffer.setBufferSubData(firstVertex * VERTEX_SIZE,
+                                   mUploadedVertices.data(), numberOfVertices * VERTEX_SIZE);
+}
+
+void ChunkMeshArena::draw(const Renderer& renderer, const Shader& shader,
+                          const Camera& camera) const
+{
+    MEASURE_SCOPE_WITH_GPU;
+    const auto cameraPosition = camera.cameraPosition();
+    const auto chunkSize = glm::vec3(ChunkBlocks::BLOCKS_PER_X_DIMENSION,
+                                     ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
+                                     ChunkBlocks::BLOCKS_PER_Z_DIMENSION) *
+                           static_cast<float>(Block::BLOCK_SIZE);
+    for (auto slot: mLayout.usedSlots())
+    {
+        const auto& chunkPosition = mChunkPositions[slot];
+        mVisibleFaces[slot] = ChunkMeshArenaLayout::facesFacing(cameraPosition, chunkPosition,
+                                                                chunkPosition + chunkSize);
+    }
+    mSkippedFaces = mLayout.buildDrawCommands(mVisibleFaces, mVisibleDrawCommands);
+
+    const auto& commands = mVisibleDrawCommands;
+    if (commands.numbersOfIndices.empty())
+    {
+        return;
+    }
+
+    GLCall(glActiveTexture(GL_TEXTURE0 + ORIGINS_TEXTURE_UNIT));
+    GLCall(glBindTexture(GL_TEXTURE_BUFFER, mOriginsTexture));
+    GLCall(glActiveTexture(GL_TEXTURE0));
+    shader.bind();
+    shader.setUniform("u_ChunkOrigins", ORIGINS_TEXTURE_UNIT);
+    renderer.draw3DMultiple(mVertexArray, QuadIndexBuffer::instance(), commands.numbersOfIndices,
+                            commands.indexOffsets, commands.baseVertices, shader, camera);
+}
+
+int ChunkMeshArena::defragment(int maxNumberOfMoves)
+{
+    MEASURE_SCOPE;
+    auto numberOfMoves = 0;
+    while (numberOfMoves < maxNumberOfMoves && mLayout.needsDefragmentation())
+    {
+        const auto move = mLayout.defragmentationStep();
+        if (not move)
+        {
+            break;
+        }
+        // The chunk is moved into a free range, so the source and the destination never overlap
+        mVertexBuffer.copyFrom(mVertexBuffer, move->fromVertex * VERTEX_SIZE,
+                               move->toVertex * VERTEX_SIZE, move->numberOfVertices * VERTEX_SIZE);
+        ++numberOfMoves;
+    }
+    return numberOfMoves;
+}
+
+int ChunkMeshArena::numberOfVertices() const
+{
+    return static_cast<int>(mLayout.numberOfVertices());
+}
+
+unsigned long ChunkMeshArena::memorySize() const
+{
+    return static_cast<unsigned long>(mCapacity) * VERTEX_SIZE;
+}
+
+BufferRangeAllocator::Statistics ChunkMeshArena::statistics() const
+{
+    return mLayout.statistics();
+}
+
+ChunkMeshArenaLayout::SkippedFaces ChunkMeshArena::skippedFaces() const
+{
+    return mSkippedFaces;
+}
+
+void ChunkMeshArena::reallocate(unsigned int capacity)
+{
+    MEASURE_SCOPE;
+    auto vertexBuffer = VertexBuffer(nullptr, capacity * VERTEX_SIZE);
+    if (mCapacity > 0)
+    {
+        vertexBuffer.copyFrom(mVertexBuffer, 0, 0, mCapacity * VERTEX_SIZE);
+    }
+    mVertexBuffer = std::move(vertexBuffer);
+    mCapacity = capacity;
+    mVertexArray.setBuffer(mVertexBuffer, mBufferLayout);
+
+#ifdef _DEBUG
+    mVertexArray.unbind();
+#endif
+}
+
+}// namespace Voxino::Polygons
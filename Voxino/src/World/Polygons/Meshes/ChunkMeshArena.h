@@ -0,0 +1,124 @@
+#pragma once
+#include "Renderer/Core/Buffers/BufferLayout.h"
+#include "Renderer/Core/Buffers/VertexBuffer.h"
+#include "Renderer/Core/VertexArray.h"
+#include "Renderer/Renderer.h"
+#include "World/Polygons/Meshes/ChunkArrayPackedMesh.h"
+#include "World/Polygons/Meshes/ChunkMeshArenaLayout.h"
+
+namespace Voxino::Polygons
+{
+/**
+ * @brief A single vertex buffer holding the packed meshes of up to
+ * ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS chunks, drawn all at once by one
+ * glMultiDrawElementsBaseVertex call.
+ *
+ * Vertices of the meshes are relative to their chunks. The slot of the chunk is written into the
+ * free bits of every vertex, and the shader ChunkPackedBatched reads the position of the chunk
+ * from a buffer texture at that slot, so no uniform has to be set per chunk.
+ *
+ * Ranges of the buffer are handed out by ChunkMeshArenaLayout. Remeshing a chunk only overwrites
+ * its range, and once the free ranges become fragmented, defragment() moves a few chunks per call
+ * within the same buffer.
+ *
+ * Vertices of every chunk are uploaded sorted by the face direction, and draw() leaves out the
+ * directions that cannot face the camera from anywhere in the bounding box of the chunk. This
+ * skips roughly half of the faces before they reach the vertex shader, which GL_CULL_FACE would
+ * only reject after shading them.
+ */
+class ChunkMeshArena
+{
+public:
+    using Slot = ChunkMeshArenaLayout::Slot;
+
+    ChunkMeshArena();
+    ChunkMeshArena(const ChunkMeshArena&) = delete;
+    ChunkMeshArena& operator=(const ChunkMeshArena&) = delete;
+    ~ChunkMeshArena();
+
+    /**
+     * Reserves a slot for a new chunk.
+     * @param chunkPosition Position of the chunk in the world, added to its vertices by the shader
+     * @return Slot of the chunk or nothing if the arena is full
+     */
+    [[nodiscard]] std::optional<Slot> addChunk(const glm::vec3& chunkPosition);
+
+    /**
+     * Removes the mesh of the chunk and frees its slot.
+     * @param slot Slot of the chunk
+     */
+    void removeChunk(Slot slot);
+
+    /**
+     * Replaces the mesh of the chunk. The buffer grows when no free range is large enough.
+     * @param slot Slot of the chunk
+     * @param mesh New mesh of the chunk
+     */
+    void setMesh(Slot slot, const ChunkArrayPackedMesh& mesh);
+
+    /**
+     * Draws the meshes of all chunks of the arena. The textures of the blocks have to be bound.
+     * @param renderer Renderer drawing the 3D game world onto the 2D screen
+     * @param shader Shader with the help of which the chunks should be drawn
+     * @param camera Camera through which the game world is viewed
+     */
+    void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const;
+
+    /**
+     * Moves a few chunks into the free ranges lying before them, if the free space of the buffer
+     * is fragmented. Spread over many frames, so no frame has to copy the whole buffer.
+     * @param maxNumberOfMoves Maximum number of chunks to move
+     * @return Number of moved chunks
+     */
+    int defragment(int maxNumberOfMoves);
+
+    /**
+     * Returns the number of vertices of the meshes of all chunks.
+     * @return Number of vertices
+     */
+    [[nodiscard]] int numberOfVertices() const;
+
+    /**
+     * Returns the size of the vertex buffer on the GPU.
+     * @return Size in bytes, including unused vertices
+     */
+    [[nodiscard]] unsigned long memorySize() const;
+
+    /**
+     * Returns the usage of the vertex buffer.
+     * @return Statistics of the buffer, in vertices
+     */
+    [[nodiscard]] BufferRangeAllocator::Statistics statistics() const;
+
+    /**
+     * Returns the face directions that were left out by the last draw().
+     * @return Number of skipped ranges and their vertices
+     */
+    [[nodiscard]] ChunkMeshArenaLayout::SkippedFaces skippedFaces() const;
+
+private:
+    /**
+     * Replaces the vertex buffer with a larger one, copying the current vertices into it.
+     * @param capacity Number of vertices of the new buffer
+     */
+    void reallocate(unsigned int capacity);
+
+private:
+    static constexpr auto VERTEX_SIZE = sizeof(ChunkArrayPackedMesh::VertexData);
+    static constexpr auto ORIGINS_TEXTURE_UNIT = 1;
+
+    ChunkMeshArenaLayout mLayout;
+    VertexArray mVertexArray;
+    VertexBuffer mVertexBuffer;
+    BufferLayout mBufferLayout;
+    unsigned int mCapacity{0};
+    std::vector<ChunkArrayPackedMesh::VertexData> mUploadedVertices;
+    std::array<glm::vec3, ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS> mChunkPositions{};
+    mutable std::array<ChunkMeshArenaLayout::FaceMask, ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS>
+        mVisibleFaces{};
+    mutable ChunkMeshArenaLayout::DrawCommands mVisibleDrawCommands;
+    mutable ChunkMeshArenaLayout::SkippedFaces mSkippedFaces;
+    GLuint mOriginsBuffer{0};
+    GLuint mOriginsTexture{0};
+};
+}// namespace Voxino::Polygons
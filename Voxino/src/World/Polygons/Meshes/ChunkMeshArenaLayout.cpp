@@ -0,0 +1,266 @@
+#include "ChunkMeshArenaLayout.h"
+#include "Renderer/Core/Buffers/QuadIndexBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace Voxino::Polygons
+{
+namespace
+{
+// Small free spaces are not worth moving the chunks
+constexpr auto MIN_FREE_VERTICES_TO_DEFRAGMENT = 1u << 16;
+}// namespace
+
+ChunkMeshArenaLayout::ChunkMeshArenaLayout(unsigned int capacity)
+    : mAllocator(capacity)
+{
+    mFreeSlots.reserve(MAX_NUMBER_OF_CHUNKS);
+    mUsedSlots.reserve(MAX_NUMBER_OF_CHUNKS);
+    for (auto slot = MAX_NUMBER_OF_CHUNKS; slot > 0; --slot)
+    {
+        mFreeSlots.push_back(slot - 1);
+    }
+}
+
+std::optional<ChunkMeshArenaLayout::Slot> ChunkMeshArenaLayout::addChunk()
+{
+    if (mFreeSlots.empty())
+    {
+        return std::nullopt;
+    }
+    const auto slot = mFreeSlots.back();
+    mFreeSlots.pop_back();
+    mIsSlotUsed[slot] = true;
+    mUsedSlots.insert(std::ranges::lower_bound(mUsedSlots, slot), slot);
+    mRanges[slot] = {};
+    return slot;
+}
+
+void ChunkMeshArenaLayout::removeChunk(Slot slot)
+{
+    assert(mIsSlotUsed[slot]);
+    const auto previousNumberOfVertices = mRanges[slot].numberOfVertices;
+    releaseRange(mRanges[slot]);
+    mIsSlotUsed[slot] = false;
+    mUsedSlots.erase(std::ranges::lower_bound(mUsedSlots, slot));
+    mFreeSlots.push_back(slot);
+    updateMaxNumberOfVerticesPerChunk(previousNumberOfVertices, 0);
+}
+
+unsigned int ChunkMeshArenaLayout::place(Slot slot, const VerticesPerFace& verticesPerFace)
+{
+    assert(mIsSlotUsed[slot]);
+    auto numberOfVertices = 0u;
+    for (const auto vertices: verticesPerFace)
+    {
+        numberOfVertices += vertices;
+    }
+
+    auto& range = mRanges[slot];
+    if (numberOfVertices > range.capacity)
+    {
+        releaseRange(range);
+        auto firstVertex = mAllocator.allocate(numberOfVertices);
+        if (not firstVertex)
+        {
+            const auto capacity = mAllocator.capacity();
+            mAllocator.grow(std::max(2 * capacity, capacity + numberOfVertices));
+            firstVertex = mAllocator.allocate(numberOfVertices);
+        }
+        range.firstVertex = *firstVertex;
+        range.capacity = numberOfVertices;
+    }
+    else if (numberOfVertices < range.capacity / 2)
+    {
+        // Give back what the much smaller mesh does not need, but keep some room to grow
+        const auto capacity = std::max(numberOfVertices, range.capacity / 4);
+        if (capacity < range.capacity)
+        {
+            mAllocator.free(range.firstVertex + capacity, range.capacity - capacity);
+            range.capacity = capacity;
+        }
+    }
+    const auto previousNumberOfVertices = range.numberOfVertices;
+    mNumberOfVertices += numberOfVertices;
+    mNumberOfVertices -= previousNumberOfVertices;
+    range.numberOfVertices = numberOfVertices;
+    range.verticesPerFace = verticesPerFace;
+    updateMaxNumberOfVerticesPerChunk(previousNumberOfVertices, numberOfVertices);
+    return range.firstVertex;
+}
+
+bool ChunkMeshArenaLayout::needsDefragmentation() const
+{
+    const auto statistics = mAllocator.statistics();
+    return statistics.freeSize >= MIN_FREE_VERTICES_TO_DEFRAGMENT &&
+           statistics.fragmentation() > MAX_FRAGMENTATION;
+}
+
+std::optional<ChunkMeshArenaLayout::Move> ChunkMeshArenaLayout::defragmentationStep()
+{
+    std::vector<Slot> slots;
+    for (auto slot: mUsedSlots)
+    {
+        if (mRanges[slot].capacity > 0)
+        {
+            slots.push_back(slot);
+        }
+    }
+    std::sort(slots.begin(), slots.end(),
+              [this](Slot lhs, Slot rhs)
+              {
+                  return mRanges[lhs].firstVertex > mRanges[rhs].firstVertex;
+              });
+
+    for (auto slot: slots)
+    {
+        auto& range = mRanges[slot];
+        if (const auto firstVertex = mAllocator.allocateBefore(range.capacity, range.firstVertex))
+        {
+            mAllocator.free(range.firstVertex, range.capacity);
+            const auto move = Move{range.firstVertex, *firstVertex, range.numberOfVertices};
+            range.firstVertex = *firstVertex;
+            return move;
+        }
+    }
+    return std::nullopt;
+}
+
+const ChunkMeshArenaLayout::Range& ChunkMeshArenaLayout::range(Slot slot) const
+{
+    return mRanges[slot];
+}
+
+bool ChunkMeshArenaLayout::isFull() const
+{
+    return mFreeSlots.empty();
+}
+
+unsigned int ChunkMeshArenaLayout::capacity() const
+{
+    return mAllocator.capacity();
+}
+
+unsigned int ChunkMeshArenaLayout::numberOfVertices() const
+{
+    return mNumberOfVertices;
+}
+
+unsigned int ChunkMeshArenaLayout::maxNumberOfVerticesPerChunk() const
+{
+    return mMaxNumberOfVerticesPerChunk;
+}
+
+BufferRangeAllocator::Statistics ChunkMeshArenaLayout::statistics() const
+{
+    return mAllocator.statistics();
+}
+
+const std::vector<ChunkMeshArenaLayout::Slot>& ChunkMeshArenaLayout::usedSlots() const
+{
+    return mUsedSlots;
+}
+
+ChunkMeshArenaLayout::SkippedFaces ChunkMeshArenaLayout::buildDrawCommands(
+    const std::array<FaceMask, MAX_NUMBER_OF_CHUNKS>& visibleFaces, DrawCommands& commands) const
+{
+    commands.numbersOfIndices.clear();
+    commands.indexOffsets.clear();
+    commands.baseVertices.clear();
+    auto skippedFaces = SkippedFaces{};
+    for (auto slot: mUsedSlots)
+    {
+        const auto& range = mRanges[slot];
+        if (range.numberOfVertices == 0)
+        {
+            continue;
+        }
+
+        auto firstVertex = range.firstVertex;
+        auto isPreviousFaceDrawn = false;
+        for (auto face = std::size_t{0}; face < NUMBER_OF_FACES; ++face)
+        {
+            const auto vertices = range.verticesPerFace[face];
+            if (vertices == 0)
+            {
+                continue;
+            }
+
+            if (not((visibleFaces[slot] >> face) & 1))
+            {
+                ++skippedFaces.numberOfRanges;
+                skippedFaces.numberOfVertices += vertices;
+                isPreviousFaceDrawn = false;
+            }
+            else
+            {
+                const auto numberOfIndices = static_cast<int>(
+                    vertices / QuadIndexBuffer::VERTICES_PER_QUAD * QuadIndexBuffer::INDICES_PER_QUAD);
+                if (isPreviousFaceDrawn)
+                {
+                    // Every quad uses the same pattern of indices, so the previous command grows
+                    commands.numbersOfIndices.back() += numberOfIndices;
+                }
+                else
+                {
+                    commands.numbersOfIndices.push_back(numberOfIndices);
+                    commands.indexOffsets.push_back(nullptr);
+                    commands.baseVertices.push_back(static_cast<int>(firstVertex));
+                    isPreviousFaceDrawn = true;
+                }
+            }
+            firstVertex += vertices;
+        }
+    }
+    return skippedFaces;
+}
+
+ChunkMeshArenaLayout::FaceMask ChunkMeshArenaLayout::facesFacing(const glm::vec3& point,
+                                                                 const glm::vec3& boxMin,
+                                                                 const glm::vec3& boxMax)
+{
+    auto faceBit = [](Block::Face face, bool isFacing)
+    {
+        return static_cast<FaceMask>(isFacing ? 1u << static_cast<int>(face) : 0u);
+    };
+    return faceBit(Block::Face::Bottom, point.y < boxMax.y) |
+           faceBit(Block::Face::Top, point.y > boxMin.y) |
+           faceBit(Block::Face::Left, point.x < boxMax.x) |
+           faceBit(Block::Face::Right, point.x > boxMin.x) |
+           faceBit(Block::Face::Front, point.z > boxMin.z) |
+           faceBit(Block::Face::Back, point.z < boxMax.z);
+}
+
+void ChunkMeshArenaLayout::releaseRange(Range& range)
+{
+    if (range.capacity > 0)
+    {
+        mAllocator.free(range.firstVertex, range.capacity);
+    }
+    mNumberOfVertices -= range.numberOfVertices;
+    range = {};
+}
+
+void ChunkMeshArenaLayout::updateMaxNumberOfVerticesPerChunk(
+    unsigned int previousNumberOfVertices, unsigned int numberOfVertices)
+{
+    if (numberOfVertices >= mMaxNumberOfVerticesPerChunk)
+    {
+        mMaxNumberOfVerticesPerChunk = numberOfVertices;
+        return;
+    }
+    if (previousNumberOfVertices < mMaxNumberOfVerticesPerChunk)
+    {
+        return;
+    }
+
+    mMaxNumberOfVerticesPerChunk = 0;
+    for (auto slot: mUsedSlots)
+    {
+        mMaxNumberOfVerticesPerChunk =
+            std::max(mMaxNumberOfVerticesPerChunk, mRanges[slot].numberOfVertices);
+    }
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Renderer/Core/Buffers/BufferRangeAllocator.h"
+#include "World/Polygons/Meshes/ChunkArrayPackedMesh.h"
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Voxino::Polygons
+{
+/**
+ * @brief Decides where in the shared vertex buffer of ChunkMeshArena the mesh of every chunk lies.
+ *
+ * It is plain bookkeeping without any OpenGL calls. Every chunk gets a slot and a range of
+ * vertices handed out by a BufferRangeAllocator. A mesh that still fits into the range of its chunk
+ * is written in place, a larger one gets a new range, reusing ranges freed by other chunks where
+ * possible. The buffer grows only when no free range is large enough.
+ *
+ * Once the free space becomes too fragmented, chunks lying at the end of the buffer are moved one
+ * by one into the free ranges before them, a few per frame, until the free space is in one piece
+ * again.
+ *
+ * The vertices of every chunk are sorted by the face of the blocks they belong to, so each of the
+ * six directions lies in its own sub-range. buildDrawCommands() leaves out the directions that
+ * cannot face the camera, so they never reach the vertex shader.
+ */
+class ChunkMeshArenaLayout
+{
+public:
+    using Slot = unsigned int;
+    static constexpr Slot MAX_NUMBER_OF_CHUNKS = 1u << ChunkArrayPackedMesh::CHUNK_SLOT_BITS;
+
+    /** Fragmentation above which the chunks are moved to make the free space contiguous. */
+    static constexpr float MAX_FRAGMENTATION = 0.5f;
+
+    static constexpr auto NUMBER_OF_FACES = static_cast<std::size_t>(Block::Face::Counter);
+
+    /** Number of vertices of every face direction, indexed by Block::Face. */
+    using VerticesPerFace = std::array<unsigned int, NUMBER_OF_FACES>;
+
+    /** Set of face directions, bit i stands for Block::Face i. */
+    using FaceMask = std::uint8_t;
+    static constexpr FaceMask ALL_FACES = (1u << NUMBER_OF_FACES) - 1;
+
+    /** Vertices of the buffer reserved for a single chunk, sorted by the face direction. */
+    struct Range
+    {
+        unsigned int firstVertex{0};
+        unsigned int numberOfVertices{0};
+        unsigned int capacity{0};
+        VerticesPerFace verticesPerFace{};
+    };
+
+    /** Vertices that have to be copied within the buffer to defragment it. */
+    struct Move
+    {
+        unsigned int fromVertex;
+        unsigned int toVertex;
+        unsigned int numberOfVertices;
+    };
+
+    /** Arguments of glMultiDrawElementsBaseVertex, one element per drawn range of vertices. */
+    struct DrawCommands
+    {
+        std::vector<int> numbersOfIndices;
+        std::vector<const void*> indexOffsets;
+        std::vector<int> baseVertices;
+    };
+
+    /** Face directions left out by buildDrawCommands(). */
+    struct SkippedFaces
+    {
+        unsigned int numberOfRanges{0};
+        unsigned int numberOfVertices{0};
+    };
+
+    /**
+     * @param capacity Initial number of vertices of the buffer
+     */
+    explicit ChunkMeshArenaLayout(unsigned int capacity = 0);
+
+    /**
+     * Reserves a slot for a new chunk.
+     * @return Slot of the chunk or nothing if all slots are taken
+     */
+    [[nodiscard]] std::optional<Slot> addChunk();
+
+    /**
+     * Frees the slot and the vertices of the chunk.
+     * @param slot Slot of the chunk
+     */
+    void removeChunk(Slot slot);
+
+    /**
+     * Finds the place for the new mesh of the chunk. If no free range is large enough, the
+     * capacity of the buffer grows.
+     * @param slot Slot of the chunk
+     * @param verticesPerFace Number of vertices of every face direction of the new mesh. The mesh
+     * has to be written sorted by the face, in the order of Block::Face.
+     * @return Index of the first vertex at which the mesh should be written
+     */
+    unsigned int place(Slot slot, const VerticesPerFace& verticesPerFace);
+
+    /**
+     * Checks if the free space is so fragmented that chunks should be moved.
+     * @return True if defragmentationStep() should be called
+     */
+    [[nodiscard]] bool needsDefragmentation() const;
+
+    /**
+     * Moves the last chunk that fits into a free range lying before it.
+     * @return Vertices that have to be copied within the buffer, or nothing if no chunk can be
+     * moved
+     */
+    std::optional<Move> defragmentationStep();
+
+    /**
+     * Returns the range of vertices of the chunk.
+     * @param slot Slot of the chunk
+     * @return Range of vertices
+     */
+    [[nodiscard]] const Range& range(Slot slot) const;
+
+    /**
+     * Checks if there is no free slot left.
+     * @return True if no more chunks can be added
+     */
+    [[nodiscard]] bool isFull() const;
+
+    /**
+     * Returns the number of vertices the buffer has to be able to hold.
+     * @return Capacity of the buffer in vertices
+     */
+    [[nodiscard]] unsigned int capacity() const;
+
+    /**
+     * Returns the number of vertices of the meshes of all chunks.
+     * @return Number of vertices that are drawn
+     */
+    [[nodiscard]] unsigned int numberOfVertices() const;
+
+    /**
+     * Returns the number of vertices of the largest mesh, so the shared index buffer can be large
+     * enough for all of them.
+     * @return Number of vertices of the largest mesh
+     */
+    [[nodiscard]] unsigned int maxNumberOfVerticesPerChunk() const;
+
+    /**
+     * Returns the usage of the buffer, in vertices.
+     * @return Statistics of the buffer
+     */
+    [[nodiscard]] BufferRangeAllocator::Statistics statistics() const;
+
+    /**
+     * Returns the slots of all chunks that were added and not removed yet.
+     * @return Used slots in ascending order
+     */
+    [[nodiscard]] const std::vector<Slot>& usedSlots() const;
+
+    /**
+     * Builds the arguments of glMultiDrawElementsBaseVertex drawing only the given face directions
+     * of every chunk. Neighbouring drawn directions are merged into a single command.
+     * @param visibleFaces Face directions to draw, indexed by the slot of the chunk
+     * @param commands Draw commands, replaced by the new ones
+     * @return Face directions that had vertices but were left out
+     */
+    SkippedFaces buildDrawCommands(const std::array<FaceMask, MAX_NUMBER_OF_CHUNKS>& visibleFaces,
+                                   DrawCommands& commands) const;
+
+    /**
+     * Returns the face directions of a box that can face the given point. A face lying on a plane
+     * faces the point only if the point lies in front of the plane, so e.g. no top face of the box
+     * can be seen from below its lowest point.
+     * @param point Point from which the box is viewed, usually the camera
+     * @param boxMin Corner of the box with the lowest coordinates
+     * @param boxMax Corner of the box with the highest coordinates
+     * @return Face directions that can be seen from the point
+     */
+    [[nodiscard]] static FaceMask facesFacing(const glm::vec3& point, const glm::vec3& boxMin,
+                                              const glm::vec3& boxMax);
+
+private:
+    /**
+     * Returns the range of the chunk to the allocator.
+     */
+    void releaseRange(Range& range);
+
+    /**
+     * Keeps the number of vertices of the largest mesh up to date after the mesh of a chunk has
+     * changed. All chunks are visited only when the largest mesh became smaller.
+     * @param previousNumberOfVertices Number of vertices of the chunk before the change
+     * @param numberOfVertices Number of vertices of the chunk after the change
+     */
+    void updateMaxNumberOfVerticesPerChunk(unsigned int previousNumberOfVertices,
+                                           unsigned int numberOfVertices);
+
+private:
+    BufferRangeAllocator mAllocator;
+    std::array<Range, MAX_NUMBER_OF_CHUNKS> mRanges{};
+    std::array<bool, MAX_NUMBER_OF_CHUNKS> mIsSlotUsed{};
+    std::vector<Slot> mFreeSlots;
+    std::vector<Slot> mUsedSlots;
+    unsigned int mNumberOfVertices{0};
+    unsigned int mMaxNumberOfVerticesPerChunk{0};
+};
+}// namespace Voxino::Polygons
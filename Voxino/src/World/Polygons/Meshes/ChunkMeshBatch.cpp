@@ -0,0 +1,135 @@
+#include "ChunkMeshBatch.h"
+#include "World/Polygons/Chunks/Types/PolygonChunk.h"
+#include "pch.h"
+
+#include <algorithm>
+
+namespace Voxino::Polygons
+{
+
+ChunkMeshBatch::ChunkMeshBatch(const TexturePackArray& texturePack)
+    : mTexturePack(texturePack)
+{
+}
+
+void ChunkMeshBatch::setMesh(const PolygonChunk& chunk, const ChunkArrayPackedMesh& mesh)
+{
+    MEASURE_SCOPE;
+    auto location = mLocations.find(&chunk);
+    if (location == mLocations.end())
+    {
+        location = mLocations.emplace(&chunk, addChunk(chunk)).first;
+    }
+    const auto& [arena, slot] = location->second;
+    mArenas[arena]->setMesh(slot, mesh);
+}
+
+void ChunkMeshBatch::removeMesh(const PolygonChunk& chunk)
+{
+    if (const auto location = mLocations.find(&chunk); location != mLocations.end())
+    {
+        const auto& [arena, slot] = location->second;
+        mArenas[arena]->removeChunk(slot);
+        mLocations.erase(location);
+    }
+}
+
+void ChunkMeshBatch::draw(const Renderer& renderer, const Shader& shader,
+                          const Camera& camera) const
+{
+    MEASURE_SCOPE_WITH_GPU;
+    mTexturePack.bind(TexturePack::Spritesheet::Blocks);
+    for (const auto& arena: mArenas)
+    {
+        arena->draw(renderer, shader, camera);
+    }
+}
+
+void ChunkMeshBatch::defragment(int maxNumberOfMoves)
+{
+    for (const auto& arena: mArenas)
+    {
+        if (maxNumberOfMoves <= 0)
+        {
+            return;
+        }
+        maxNumberOfMoves -= arena->defragment(maxNumberOfMoves);
+    }
+}
+
+int ChunkMeshBatch::numberOfVertices() const
+{
+    auto vertices = 0;
+    for (const auto& arena: mArenas)
+    {
+        vertices += arena->numberOfVertices();
+    }
+    return vertices;
+}
+
+unsigned long ChunkMeshBatch::memorySize() const
+{
+    auto size = 0ul;
+    for (const auto& arena: mArenas)
+    {
+        size += arena->memorySize();
+    }
+    return size;
+}
+
+BufferRangeAllocator::Statistics ChunkMeshBatch::statistics() const
+{
+    auto statistics = BufferRangeAllocator::Statistics{};
+    for (const auto& arena: mArenas)
+    {
+        const auto arenaStatistics = arena->statistics();
+        statistics.capacity += arenaStatistics.capacity;
+        statistics.usedSize += arenaStatistics.usedSize;
+        statistics.freeSize += arenaStatistics.freeSize;
+        statistics.largestFreeRange =
+            std::max(statistics.largestFreeRange, arenaStatistics.largestFreeRange);
+        statistics.numberOfFreeRanges += arenaStatistics.numberOfFreeRanges;
+    }
+    return statistics;
+}
+
+ChunkMeshArenaLayout::SkippedFaces ChunkMeshBatch::skippedFaces() const
+{
+    auto skippedFaces = ChunkMeshArenaLayout::SkippedFaces{};
+    for (const auto& arena: mArenas)
+    {
+        const auto arenaSkippedFaces = arena->skippedFaces();
+        skippedFaces.numberOfRanges += arenaSkippedFaces.numberOfRanges;
+        skippedFaces.numberOfVertices += arenaSkippedFaces.numberOfVertices;
+    }
+    return skippedFaces;
+}
+
+void ChunkMeshBatch::updateImGui() const
+{
+    const auto statistics = this->statistics();
+    ImGui::Text("Mesh arenas: %zu", mArenas.size());
+    ImGui::Text("Arena utilisation: %.1f%%", 100.0f * statistics.utilisation());
+    ImGui::Text("Arena fragmentation: %.1f%% (%u free ranges)", 100.0f * statistics.fragmentation(),
+                statistics.numberOfFreeRanges);
+    const auto skippedFaces = this->skippedFaces();
+    ImGui::Text("Skipped face ranges: %u (%u vertices)", skippedFaces.numberOfRanges,
+                skippedFaces.numberOfVertices);
+}
+
+ChunkMeshBatch::Location ChunkMeshBatch::addChunk(const PolygonChunk& chunk)
+{
+    const auto& position = chunk.positionInBlocks();
+    const auto chunkPosition = glm::vec3(position.x, position.y, position.z);
+    for (auto arena = std::size_t{0}; arena < mArenas.size(); ++arena)
+    {
+        if (const auto slot = mArenas[arena]->addChunk(chunkPosition))
+        {
+            return {arena, *slot};
+        }
+    }
+    mArenas.push_back(std::make_unique<ChunkMeshArena>());
+    return {mArenas.size() - 1, *mArenas.back()->addChunk(chunkPosition)};
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,106 @@
+#pragma once
+#include "Renderer/Renderer.h"
+#include "Resources/TexturePackArray.h"
+#include "World/Polygons/Meshes/ChunkArrayPackedMesh.h"
+#include "World/Polygons/Meshes/ChunkMeshArena.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Voxino::Polygons
+{
+class PolygonChunk;
+
+/**
+ * @brief Keeps the packed meshes of many chunks in a few ChunkMeshArena, so all of them are drawn
+ * with one call per arena instead of one call per chunk.
+ *
+ * Chunks whose meshes are kept here do not need a model of their own.
+ */
+class ChunkMeshBatch
+{
+public:
+    /**
+     * @param texturePack Textures of the blocks, bound once before drawing all arenas
+     */
+    explicit ChunkMeshBatch(const TexturePackArray& texturePack);
+
+    /**
+     * Replaces the mesh of the chunk, adding the chunk to one of the arenas if it is new.
+     * @param chunk Chunk to which the mesh belongs
+     * @param mesh New mesh of the chunk
+     */
+    void setMesh(const PolygonChunk& chunk, const ChunkArrayPackedMesh& mesh);
+
+    /**
+     * Removes the mesh of the chunk. Nothing happens if the chunk has no mesh here.
+     * @param chunk Chunk whose mesh should be removed
+     */
+    void removeMesh(const PolygonChunk& chunk);
+
+    /**
+     * Draws the meshes of all chunks.
+     * @param renderer Renderer drawing the 3D game world onto the 2D screen
+     * @param shader Shader with the help of which the chunks should be drawn
+     * @param camera Camera through which the game world is viewed
+     */
+    void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const;
+
+    /**
+     * Moves a few chunks of the arenas whose free space is fragmented.
+     * @param maxNumberOfMoves Maximum number of chunks to move in all arenas together
+     */
+    void defragment(int maxNumberOfMoves);
+
+    /**
+     * Returns the number of vertices of the meshes of all chunks.
+     * @return Number of vertices
+     */
+    [[nodiscard]] int numberOfVertices() const;
+
+    /**
+     * Returns the size of the vertex buffers of all arenas.
+     * @return Size in bytes
+     */
+    [[nodiscard]] unsigned long memorySize() const;
+
+    /**
+     * Returns the usage of the vertex buffers of all arenas together. The largest free range is
+     * the largest one of any arena.
+     * @return Statistics of the buffers, in vertices
+     */
+    [[nodiscard]] BufferRangeAllocator::Statistics statistics() const;
+
+    /**
+     * Returns the face directions of all arenas that were left out by the last draw(), as they
+     * could not face the camera.
+     * @return Number of skipped ranges and their vertices
+     */
+    [[nodiscard]] ChunkMeshArenaLayout::SkippedFaces skippedFaces() const;
+
+    /**
+     * Shows the usage of the vertex buffers and the skipped faces in the debug window.
+     */
+    void updateImGui() const;
+
+private:
+    struct Location
+    {
+        std::size_t arena;
+        ChunkMeshArena::Slot slot;
+    };
+
+    /**
+     * Adds the chunk to the first arena with a free slot, creating a new arena if all are full.
+     * @param chunk Chunk to add
+     * @return Location of the chunk
+     */
+    Location addChunk(const PolygonChunk& chunk);
+
+private:
+    const TexturePackArray& mTexturePack;
+    std::vector<std::unique_ptr<ChunkMeshArena>> mArenas;
+    std::unordered_map<const PolygonChunk*, Location> mLocations;
+};
+}// namespace Voxino::Polygons
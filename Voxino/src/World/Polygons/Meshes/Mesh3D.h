@@ -39,14 +39,11 @@ struct Mesh3D
      * Returns the number of vertices.
      * @return Number of vertices.
      */
-    virtual int numberOfVertices() = 0;
+    virtual int numberOfVertices() const = 0;
 
     /**
      * The size in memory that the mesh occupies
      */
-    virtual unsigned long memorySize() = 0;
-
-    /* ==== Members ===== */
-    std::vector<GLuint> indices;
+    virtual unsigned long memorySize() const = 0;
 };
 }// namespace Voxino::Polygons
\ No newline at end of file
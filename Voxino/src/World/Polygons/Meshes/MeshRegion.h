@@ -1,16 +1,27 @@
 #pragma once
 
+#include "World/Block/Block.h"
+
+#include <array>
+#include <type_traits>
+
 namespace Voxino::Polygons
 {
 
+/**
+ * A rectangle of faces of blocks merged into a single quad by the greedy meshing. It is trivially
+ * copyable, so regions are passed around without touching the heap.
+ */
 struct MeshRegion
 {
     Block::TextureId id{};
     Block::Face face{};
-    Block::Coordinate blockPosition{0, 0, 0};
-    std::vector<glm::vec2> textureCoordinates{};
+    glm::ivec3 blockPosition{0, 0, 0};
+    std::array<glm::vec2, 4> textureCoordinates{};
     unsigned width{0};
     unsigned height{0};
 };
 
+static_assert(std::is_trivially_copyable_v<MeshRegion>);
+
 };// namespace Voxino::Polygons
\ No newline at end of file
@@ -18,4 +18,9 @@ const Mesh3D& Model3D::mesh() const
 {
     return *mMesh;
 }
+
+std::unique_ptr<Mesh3D> Model3D::takeMesh()
+{
+    return std::move(mMesh);
+}
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -60,6 +60,13 @@ public:
      */
     [[nodiscard]] const Mesh3D& mesh() const;
 
+    /**
+     * Moves the mesh out of the model, e.g. to reuse its storage for the next mesh. The model
+     * has no mesh until setMesh() is called again.
+     * @return The mesh of the model
+     */
+    [[nodiscard]] std::unique_ptr<Mesh3D> takeMesh();
+
 protected:
     BufferLayout mBufferLayout;
     std::unique_ptr<Mesh3D> mMesh;
@@ -10,24 +10,25 @@ void Model3DIndexed::setMesh(std::unique_ptr<Mesh3D> mesh)
     mVertexBuffer = mMesh->vertexBuffer();
     mBufferLayout = mMesh->bufferLayout();
     mVertexArray.setBuffer(mVertexBuffer, mBufferLayout);
-    mIndices.setBuffer(mMesh->indices.data(), static_cast<unsigned int>(mMesh->indices.size()));
+    mNumberOfQuads = mMesh->numberOfVertices() / QuadIndexBuffer::VERTICES_PER_QUAD;
+    QuadIndexBuffer::instance().reserve(mNumberOfQuads);
 
 #ifdef _DEBUG
     mVertexArray.unbind();
-    mIndices.unbind();
 #endif
 }
 
 void Model3DIndexed::draw(const Renderer& renderer, const Shader& shader,
                           const Camera& camera) const
 {
-    renderer.draw3D(mVertexArray, mIndices, shader, camera);
+    renderer.draw3D(mVertexArray, QuadIndexBuffer::instance(), mNumberOfQuads, shader, camera);
 }
 
 void Model3DIndexed::draw(const Renderer& renderer, const Shader& shader, const Camera& camera,
                           const Renderer::DrawMode& drawMode) const
 {
-    renderer.draw3D(mVertexArray, mIndices, shader, camera, drawMode);
+    renderer.draw3D(mVertexArray, QuadIndexBuffer::instance(), mNumberOfQuads, shader, camera,
+                    drawMode);
 }
 
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 #include "Renderer/Core/Buffers/BufferLayout.h"
-#include "Renderer/Core/Buffers/IndexBuffer.h"
+#include "Renderer/Core/Buffers/QuadIndexBuffer.h"
 #include "Renderer/Core/Buffers/VertexBuffer.h"
 #include "Renderer/Core/VertexArray.h"
 #include "Renderer/Renderer.h"
@@ -10,7 +10,8 @@
 namespace Voxino::Polygons
 {
 /**
- * 3D model consisting of a mesh, which allows to directly draw on the screen.
+ * 3D model consisting of a mesh made of quads, which allows to directly draw on the screen. The
+ * quads are indexed by the QuadIndexBuffer shared by all models, so meshes carry vertices only.
  */
 class Model3DIndexed : public Model3D
 {
@@ -39,7 +40,7 @@ public:
 
 private:
     VertexArray mVertexArray;
-    IndexBuffer mIndices;
     VertexBuffer mVertexBuffer;
+    unsigned int mNumberOfQuads{0};
 };
 }// namespace Voxino::Polygons
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include "Model3DInstanced.h"
+#include "pch.h"
+
+namespace Voxino::Polygons
+{
+
+void Model3DInstanced::setMesh(std::unique_ptr<Mesh3D> mesh)
+{
+    mMesh = std::move(mesh);
+    mVertexBuffer = mMesh->vertexBuffer();
+    mBufferLayout = mMesh->bufferLayout();
+    mVertexArray.setInstanceBuffer(mVertexBuffer, mBufferLayout);
+
+#ifdef _DEBUG
+    mVertexArray.unbind();
+#endif
+}
+
+void Model3DInstanced::draw(const Renderer& renderer, const Shader& shader,
+                            const Camera& camera) const
+{
+    renderer.draw3DInstanced(mVertexArray, VERTICES_PER_INSTANCE, mMesh->numberOfVertices(),
+                             shader, camera);
+}
+
+void Model3DInstanced::draw(const Renderer& renderer, const Shader& shader, const Camera& camera,
+                            const Renderer::DrawMode& drawMode) const
+{
+    renderer.draw3DInstanced(mVertexArray, VERTICES_PER_INSTANCE, mMesh->numberOfVertices(),
+                             shader, camera, drawMode);
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,46 @@
+#pragma once
+#include "Renderer/Core/Buffers/BufferLayout.h"
+#include "Renderer/Core/Buffers/VertexBuffer.h"
+#include "Renderer/Core/VertexArray.h"
+#include "Renderer/Renderer.h"
+#include "World/Polygons/Meshes/Mesh3D.h"
+#include "World/Polygons/Meshes/Model3D.h"
+
+namespace Voxino::Polygons
+{
+/**
+ * 3D model whose mesh consists of quads stored as a single element per quad. Every element is
+ * drawn as an instance of two triangles, whose vertices are built by the vertex shader.
+ */
+class Model3DInstanced : public Model3D
+{
+public:
+    static constexpr auto VERTICES_PER_INSTANCE = 6;
+
+    /**
+     * \brief This function expects that mesh data
+     * will be available through all Model3DInstanced existance
+     * \param mesh Mesh to display, one vertex of which describes a whole quad
+     */
+    void setMesh(std::unique_ptr<Mesh3D> mesh) override;
+
+    /**
+     * Draws this 3D Model to the game screen
+     * @param renderer Renderer drawing the 3D game world onto the 2D screen
+     * @param shader Shader with the help of which the object should be drawn
+     */
+    void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const override;
+
+    /**
+     * Draws this 3D Model to the game screen
+     * @param renderer Renderer drawing the 3D game world onto the 2D screen
+     * @param shader Shader with the help of which the object should be drawn
+     */
+    void draw(const Renderer& renderer, const Shader& shader, const Camera& camera,
+              const Renderer::DrawMode& drawMode) const override;
+
+private:
+    VertexArray mVertexArray;
+    VertexBuffer mVertexBuffer;
+};
+}// namespace Voxino::Polygons
@@ -47,12 +47,14 @@ void Voxino::Raycast::OctreeGpu::updateCounters()
 
 void Voxino::Raycast::OctreeGpu::fillData(ChunkBlocks& chunk)
 {
-    constexpr auto startingPosition = glm::ivec3(0, 0, 0);
-    constexpr auto startingNode = 0;
-    buildOctree(chunk, startingPosition, ChunkBlocks::BLOCKS_PER_DIMENSION, startingNode);
-    auto serializedData = serializeOctree();
-    mAllocatedBytes = serializedData.size() * sizeof(OctreeNode);
-    uploadDataToOpenGL(serializedData);
+    prepareData(chunk);
+    updateData();
+}
+
+void Voxino::Raycast::OctreeGpu::updateData()
+{
+    uploadDataToOpenGL(mPreparedData);
+    mPreparedData = {};
 }
 
 std::vector<Voxino::Raycast::OctreeNode> Voxino::Raycast::OctreeGpu::serializeOctree()
@@ -72,73 +74,11 @@ std::vector<Voxino::Raycast::OctreeNode> Voxino::Raycast::OctreeGpu::serializeOc
     return flatData;
 }
 
-Voxino::Raycast::OctreeGpu::Statistics Voxino::Raycast::OctreeGpu::gatherStatistics(
-    const ChunkBlocks& chunk, const glm::ivec3& position, int size)
+void Voxino::Raycast::OctreeGpu::setLeafBlock(int nodeIndex, const Block& block)
 {
-    std::unordered_map<Block, int> blockCount;
-    const auto& firstBlock = chunk.block(position.x, position.y, position.z);
-    auto firstBlockId = firstBlock.id();
-    bool areAllBlocksSame = true;
-
-    for (int x = 0; x < size; ++x)
+    nodes[nodeIndex].block(block);
+    if (block.id() == BlockId::Air)
     {
-        for (int y = 0; y < size; ++y)
-        {
-            for (int z = 0; z < size; ++z)
-            {
-                const auto& currentBlock =
-                    chunk.block(position.x + x, position.y + y, position.z + z);
-                blockCount[currentBlock]++;
-                if (currentBlock.id() != firstBlockId)
-                {
-                    areAllBlocksSame = false;
-                }
-            }
-        }
+        nodes[nodeIndex].setNoChildren();
     }
-
-    const auto& [block, count] = *std::ranges::max_element(std::as_const(blockCount),
-                                                           [](const auto& a, const auto& b)
-                                                           {
-                                                               return a.second < b.second;
-                                                           });
-
-    return {areAllBlocksSame, block};
 }
-
-void Voxino::Raycast::OctreeGpu::buildOctree(const ChunkBlocks& chunk, const glm::ivec3& position,
-                                             int size, int nodeIndex)
-{
-    auto stats = gatherStatistics(chunk, position, size);
-    if (stats.areAllBlocksTheSame)
-    {
-        nodes[nodeIndex].block(stats.mostCommonBlock);
-        if (stats.mostCommonBlock.id() == BlockId::Air)
-        {
-            nodes[nodeIndex].setNoChildren();
-        }
-        return;
-    }
-
-    if (size == 1)
-    {
-        return;// Base case
-    }
-
-    int half = size / 2;
-    for (int dx = 0; dx < size; dx += half)
-    {
-        for (int dy = 0; dy < size; dy += half)
-        {
-            for (int dz = 0; dz < size; dz += half)
-            {
-                glm::ivec3 childPos = position + glm::ivec3(dx, dy, dz);
-                const auto childIndex = nodes.size();
-                const auto index = (dx / half) + (dy / half) * 2 + (dz / half) * 4;
-                nodes[nodeIndex].child(index, childIndex);
-                nodes.emplace_back();
-                buildOctree(chunk, childPos, half, childIndex);
-            }
-        }
-    }
-}
\ No newline at end of file
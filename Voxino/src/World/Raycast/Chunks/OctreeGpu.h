@@ -4,8 +4,10 @@
 #include "World/Block/Block.h"
 #include "World/Chunks/ChunkBlocks.h"
 #include <Renderer/Core/Buffers/AtomicCounter.h>
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <iterator>
 #include <ranges>
 #include <vector>
 
@@ -105,6 +107,19 @@ public:
 
     void fillData(ChunkBlocks& chunk);
 
+    /**
+     * \brief Builds the octree of the chunk, but does not send it to the GPU yet. It does not use
+     * OpenGL, so it can be called from any thread.
+     * \param chunk Blocks of the chunk, in any layout
+     */
+    template<typename Blocks>
+    void prepareData(const Blocks& chunk);
+
+    /**
+     * \brief Sends the most recently prepared octree to the GPU.
+     */
+    void updateData();
+
     std::vector<OctreeNode> serializeOctree();
     void draw(const Renderer& renderer, const Shader& shader, const Camera& camera) const;
 
@@ -127,6 +142,7 @@ public:
 
 private:
     std::vector<OctreeGpuNode> nodes;
+    std::vector<OctreeNode> mPreparedData;
     GLuint bufferID, texBufferID;
     struct Statistics
     {
@@ -142,10 +158,39 @@ private:
 
 
 private:
-    [[nodiscard]] static Statistics gatherStatistics(const ChunkBlocks& chunk,
+    /**
+     * \brief Counts the blocks of the octant. Layouts storing octants contiguously are read in a
+     * single sweep.
+     * \param chunk Blocks of the chunk
+     * \param position Corner of the octant with the lowest coordinates
+     * \param size Length of the edge of the octant
+     * \return Whether the octant is made of a single block type and its most common block
+     */
+    template<typename Blocks>
+    [[nodiscard]] static Statistics gatherStatistics(const Blocks& chunk,
                                                      const glm::ivec3& position, int size);
 
-    void buildOctree(const ChunkBlocks& chunk, const glm::ivec3& position, int size, int nodeIndex);
+    /**
+     * \brief Checks whether the octant holds only air, reading the occupancy masks of the chunk
+     * instead of the blocks.
+     * \param chunk Blocks of the chunk
+     * \param position Corner of the octant with the lowest coordinates
+     * \param size Length of the edge of the octant
+     * \return True if there is no block other than air in the octant, false otherwise
+     */
+    template<typename Blocks>
+    [[nodiscard]] static bool isOctantEmpty(const Blocks& chunk, const glm::ivec3& position,
+                                            int size);
+
+    template<typename Blocks>
+    void buildOctree(const Blocks& chunk, const glm::ivec3& position, int size, int nodeIndex);
+
+    /**
+     * \brief Turns the node into a leaf representing a region filled with a single block.
+     * \param nodeIndex Index of the node
+     * \param block Block filling the whole region of the node
+     */
+    void setLeafBlock(int nodeIndex, const Block& block);
 
     GLuint uploadDataToOpenGL(const std::vector<OctreeNode>& data)
     {
@@ -165,4 +210,97 @@ private:
     }
 };
 
+template<typename Blocks>
+void OctreeGpu::prepareData(const Blocks& chunk)
+{
+    constexpr auto startingPosition = glm::ivec3(0, 0, 0);
+    constexpr auto startingNode = 0;
+    if (chunk.isUniform())
+    {
+        setLeafBlock(startingNode, chunk.uniformBlock());
+    }
+    else
+    {
+        buildOctree(chunk, startingPosition, Blocks::BLOCKS_PER_DIMENSION, startingNode);
+    }
+    mPreparedData = serializeOctree();
+    mAllocatedBytes = mPreparedData.size() * sizeof(OctreeNode);
+}
+
+template<typename Blocks>
+OctreeGpu::Statistics OctreeGpu::gatherStatistics(const Blocks& chunk, const glm::ivec3& position,
+                                                  int size)
+{
+    std::array<int, static_cast<std::size_t>(BlockId::Counter)> blockCount{};
+    chunk.forEachBlockOfCube(position, size,
+                             [&blockCount](const Block& block)
+                             {
+                                 ++blockCount[static_cast<std::size_t>(block.id())];
+                             });
+
+    const auto mostCommon = std::ranges::max_element(blockCount);
+    const auto areAllBlocksSame = *mostCommon == size * size * size;
+    const auto mostCommonId = static_cast<BlockId>(std::distance(blockCount.begin(), mostCommon));
+    return {areAllBlocksSame, Block(mostCommonId)};
+}
+
+template<typename Blocks>
+bool OctreeGpu::isOctantEmpty(const Blocks& chunk, const glm::ivec3& position, int size)
+{
+    const auto& nonAirRows = chunk.occupancyRows(BlockOccupancy::NonAir);
+    const auto octantBits = (size < 64 ? (std::uint64_t{1} << size) - 1 : ~std::uint64_t{0})
+                            << position.x;
+    for (auto z = position.z; z < position.z + size; ++z)
+    {
+        for (auto y = position.y; y < position.y + size; ++y)
+        {
+            if (nonAirRows[y + z * Blocks::BLOCKS_PER_Y_DIMENSION] & octantBits)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename Blocks>
+void OctreeGpu::buildOctree(const Blocks& chunk, const glm::ivec3& position, int size,
+                            int nodeIndex)
+{
+    if (isOctantEmpty(chunk, position, size))
+    {
+        setLeafBlock(nodeIndex, Block(BlockId::Air));
+        return;
+    }
+
+    auto stats = gatherStatistics(chunk, position, size);
+    if (stats.areAllBlocksTheSame)
+    {
+        setLeafBlock(nodeIndex, stats.mostCommonBlock);
+        return;
+    }
+
+    if (size == 1)
+    {
+        return;// Base case
+    }
+
+    int half = size / 2;
+    for (int dx = 0; dx < size; dx += half)
+    {
+        for (int dy = 0; dy < size; dy += half)
+        {
+            for (int dz = 0; dz < size; dz += half)
+            {
+                glm::ivec3 childPos = position + glm::ivec3(dx, dy, dz);
+                const auto childIndex = nodes.size();
+                const auto index = (dx / half) + (dy / half) * 2 + (dz / half) * 4;
+                nodes[nodeIndex].child(index, childIndex);
+                nodes.emplace_back();
+                buildOctree(chunk, childPos, half, childIndex);
+            }
+        }
+    }
+}
+
 }// namespace Voxino::Raycast
@@ -23,6 +23,14 @@ RaycastChunk::RaycastChunk(Block::Coordinate blockPosition, const TexturePackArr
     fillData();
 }
 
+RaycastChunk::RaycastChunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+                           ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : Chunk(blockPosition, texturePack, parent, std::move(chunkBlocks))
+    , mVoxels(ChunkBlocks::BLOCKS_PER_X_DIMENSION, ChunkBlocks::BLOCKS_PER_Y_DIMENSION,
+              ChunkBlocks::BLOCKS_PER_Z_DIMENSION)
+{
+}
+
 int RaycastChunk::numberOfVertices()
 {
     return 0;
@@ -41,23 +49,33 @@ unsigned long RaycastChunk::lastNumberOfRayIterations() const
 void RaycastChunk::fillData()
 {
     MEASURE_SCOPE;
-    // sf::Clock buildingTime;
-    std::vector<RGBA> data;
+    prepareData();
+    updateData();
+}
+
+void RaycastChunk::prepareData()
+{
+    MEASURE_SCOPE;
+    // Blocks are visited in the storage order of the chunk, which need not be the x-y-z order of
+    // the texture, so every voxel is written at its linear index. Air stays transparent black.
+    mPreparedVoxels.assign(ChunkBlocks::BLOCKS_IN_CHUNK, RGBA{0, 0, 0, 0});
     for (const auto& [position, block]: *mChunkOfBlocks)
     {
-        if (block.id() == BlockId::Air)
-        {
-            data.push_back(RGBA{0, 0, 0, 0});
-        }
-        else
+        if (block.id() != BlockId::Air)
         {
-            data.push_back(block.toRGBA());
+            const auto voxelIndex = position.x + position.y * ChunkBlocks::BLOCKS_PER_X_DIMENSION +
+                                    position.z * ChunkBlocks::BLOCKS_PER_X_DIMENSION *
+                                        ChunkBlocks::BLOCKS_PER_Y_DIMENSION;
+            mPreparedVoxels[voxelIndex] = block.toRGBA();
         }
     }
-    mVoxels.fill(data);
-    // auto buildingTimeElapsed = buildingTime.getElapsedTime().asMicroseconds();
-    // spdlog::info("Building took: {} us, {} ms, {} s", buildingTimeElapsed,
-    //              buildingTimeElapsed / 1000.f, buildingTimeElapsed / 1000000.f);
+}
+
+void RaycastChunk::updateData()
+{
+    MEASURE_SCOPE;
+    mVoxels.fill(mPreparedVoxels);
+    mPreparedVoxels = {};
 }
 
 void RaycastChunk::removeLocalBlock(const Block::Coordinate& localCoordinates)
@@ -96,7 +114,7 @@ bool RaycastChunk::tryToPlaceBlockInsideThisChunk(const BlockId& blockId,
     if (Chunk::tryToPlaceBlockInsideThisChunk(blockId, localCoordinates,
                                               blocksThatMightBeOverplaced))
     {
-        auto& block = mChunkOfBlocks->block(localCoordinates);
+        const auto& block = mChunkOfBlocks->block(localCoordinates);
         mVoxels.updateSingleBlock({localCoordinates.x, localCoordinates.y, localCoordinates.z},
                                   block.toRGBA().toArray());
         return true;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/RGBA.h"
 #include "World/Chunks/Chunk.h"
 #include "World/Raycast/Chunks/VoxelsGpu.h"
 
@@ -16,6 +17,23 @@ public:
     RaycastChunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
                  ChunkContainerBase& parent);
 
+    /**
+     * \brief Creates the chunk from already generated blocks, without filling its voxels.
+     */
+    RaycastChunk(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+                 ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Converts the blocks into voxel colors, but does not send them to the GPU yet. It
+     * does not use OpenGL, so it can be called from any thread.
+     */
+    void prepareData();
+
+    /**
+     * \brief Sends the most recently prepared voxels to the GPU.
+     */
+    void updateData();
+
     /**
      * Returns the number of chunk vertices
      * @return Number of vertices
@@ -72,6 +90,7 @@ private:
 
 private:
     VoxelsGpu mVoxels;
+    std::vector<RGBA> mPreparedVoxels;
 };
 
 }// namespace Voxino::Raycast
\ No newline at end of file
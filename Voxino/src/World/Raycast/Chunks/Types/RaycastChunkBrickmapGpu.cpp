@@ -2,6 +2,8 @@
 #include "Utils/RGBA.h"
 #include "pch.h"
 
+#include <bit>
+
 namespace Voxino::Raycast
 {
 
@@ -20,6 +22,14 @@ RaycastChunkBrickmapGpu::RaycastChunkBrickmapGpu(Block::Coordinate blockPosition
     fillData();
 }
 
+RaycastChunkBrickmapGpu::RaycastChunkBrickmapGpu(Block::Coordinate blockPosition,
+                                                 const TexturePackArray& texturePack,
+                                                 ChunkContainerBase& parent,
+                                                 std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : Chunk(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 int RaycastChunkBrickmapGpu::numberOfVertices()
 {
     return 0;
@@ -33,48 +43,93 @@ unsigned long RaycastChunkBrickmapGpu::memorySize()
 void RaycastChunkBrickmapGpu::fillData()
 {
     MEASURE_SCOPE;
+    prepareData();
+    updateData();
+}
+
+void RaycastChunkBrickmapGpu::prepareData()
+{
+    MEASURE_SCOPE;
+    if (mChunkOfBlocks->isUniform())
+    {
+        fillUniformData(mChunkOfBlocks->uniformBlock());
+        return;
+    }
+
     // sf::Clock buildingTime;
     const int totalBricks = BRICKS_PER_DIMENSION * BRICKS_PER_DIMENSION * BRICKS_PER_DIMENSION;
     std::bitset<totalBricks> brickmapNeedsCreation;
 
-    for (const auto& [position, block]: *mChunkOfBlocks)
+    // Only blocks other than air are written, so the bits of their rows are visited directly
+    const auto& nonAirRows = mChunkOfBlocks->occupancyRows(BlockOccupancy::NonAir);
+    for (auto z = 0; z < ChunkBlocks::BLOCKS_PER_Z_DIMENSION; ++z)
     {
-
-        // Calculate which brickmap this voxel belongs to
-        int brickX = position.x / Brickmap::BRICK_SIZE;
-        int brickY = position.y / Brickmap::BRICK_SIZE;
-        int brickZ = position.z / Brickmap::BRICK_SIZE;
-        int index = (brickZ * BrickgridGpu::GRID_SIZE * BrickgridGpu::GRID_SIZE) +
-                    (brickY * BrickgridGpu::GRID_SIZE) + brickX;
-
-        // Calculate index in the brick array
-        int localX = position.x % Brickmap::BRICK_SIZE;
-        int localY = position.y % Brickmap::BRICK_SIZE;
-        int localZ = position.z % Brickmap::BRICK_SIZE;
-        int localIndex = localZ * Brickmap::BRICK_SIZE * Brickmap::BRICK_SIZE +
-                         localY * Brickmap::BRICK_SIZE + localX;
-
-
-        // Only create Brickmap if there is a non-air block
-        if (block.id() != BlockId::Air)
+        for (auto y = 0; y < ChunkBlocks::BLOCKS_PER_Y_DIMENSION; ++y)
         {
-            if (!mBrickgrid.getBrickmap(brickX, brickY, brickZ) && !brickmapNeedsCreation[index])
+            for (auto row = nonAirRows[y + z * ChunkBlocks::BLOCKS_PER_Y_DIMENSION]; row != 0;
+                 row &= row - 1)
             {
-                mBrickgrid.setBrickmap(brickX, brickY, brickZ, std::make_unique<Brickmap>());
-                brickmapNeedsCreation.set(index);
+                const auto position = glm::ivec3(std::countr_zero(row), y, z);
+                const auto& block = mChunkOfBlocks->block(position.x, position.y, position.z);
+
+                // Calculate which brickmap this voxel belongs to
+                int brickX = position.x / Brickmap::BRICK_SIZE;
+                int brickY = position.y / Brickmap::BRICK_SIZE;
+                int brickZ = position.z / Brickmap::BRICK_SIZE;
+                int index = (brickZ * BrickgridGpu::GRID_SIZE * BrickgridGpu::GRID_SIZE) +
+                            (brickY * BrickgridGpu::GRID_SIZE) + brickX;
+
+                // Calculate index in the brick array
+                int localX = position.x % Brickmap::BRICK_SIZE;
+                int localY = position.y % Brickmap::BRICK_SIZE;
+                int localZ = position.z % Brickmap::BRICK_SIZE;
+                int localIndex = localZ * Brickmap::BRICK_SIZE * Brickmap::BRICK_SIZE +
+                                 localY * Brickmap::BRICK_SIZE + localX;
+
+                if (!mBrickgrid.getBrickmap(brickX, brickY, brickZ) &&
+                    !brickmapNeedsCreation[index])
+                {
+                    mBrickgrid.setBrickmap(brickX, brickY, brickZ, std::make_unique<Brickmap>());
+                    brickmapNeedsCreation.set(index);
+                }
+
+                // Get the brickmap if it exists
+                auto& brick = mBrickgrid.getBrickmap(brickX, brickY, brickZ);
+                brick->textureIds[localIndex] = block.toRGBA();// Convert block data to RGBA
             }
+        }
+    }
+    // auto buildingTimeElapsed = buildingTime.getElapsedTime().asMicroseconds();
+    // spdlog::info("Building took: {} us, {} ms, {} s", buildingTimeElapsed,
+    //              buildingTimeElapsed / 1000.f, buildingTimeElapsed / 1000000.f);
+}
 
-            // Get the brickmap if it exists
-            auto& brick = mBrickgrid.getBrickmap(brickX, brickY, brickZ);
-            brick->textureIds[localIndex] = block.toRGBA();// Convert block data to RGBA
+void RaycastChunkBrickmapGpu::fillUniformData(const Block& block)
+{
+    // A chunk of air does not need any brickmap at all
+    if (block.id() != BlockId::Air)
+    {
+        const auto rgba = block.toRGBA();
+        for (auto brickX = 0; brickX < BrickgridGpu::GRID_SIZE; ++brickX)
+        {
+            for (auto brickY = 0; brickY < BrickgridGpu::GRID_SIZE; ++brickY)
+            {
+                for (auto brickZ = 0; brickZ < BrickgridGpu::GRID_SIZE; ++brickZ)
+                {
+                    auto brick = std::make_unique<Brickmap>();
+                    brick->textureIds.fill(rgba);
+                    mBrickgrid.setBrickmap(brickX, brickY, brickZ, std::move(brick));
+                }
+            }
         }
     }
+}
 
+void RaycastChunkBrickmapGpu::updateData()
+{
+    MEASURE_SCOPE;
     // Update the Brickgrid to handle new brickmaps
     mBrickgrid.update();
-    // auto buildingTimeElapsed = buildingTime.getElapsedTime().asMicroseconds();
-    // spdlog::info("Building took: {} us, {} ms, {} s", buildingTimeElapsed,
-    //              buildingTimeElapsed / 1000.f, buildingTimeElapsed / 1000000.f);
 }
 
 
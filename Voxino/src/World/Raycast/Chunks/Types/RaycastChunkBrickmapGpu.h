@@ -26,6 +26,23 @@ public:
     RaycastChunkBrickmapGpu(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
                             ChunkContainerBase& parent);
 
+    /**
+     * \brief Creates the chunk from already generated blocks, without filling its bricks.
+     */
+    RaycastChunkBrickmapGpu(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+                            ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Fills the bricks with the blocks of the chunk, but does not send them to the GPU
+     * yet. It does not use OpenGL, so it can be called from any thread.
+     */
+    void prepareData();
+
+    /**
+     * \brief Sends the most recently prepared bricks to the GPU.
+     */
+    void updateData();
+
     /**
      * Returns the number of chunk vertices
      * @return Number of vertices
@@ -64,6 +81,12 @@ public:
 
 private:
     void fillData();
+
+    /**
+     * \brief Fills the brickgrid of a chunk made of a single block without visiting every voxel.
+     * \param block Block filling the whole chunk
+     */
+    void fillUniformData(const Block& block);
     Brickmap& brickmap(int x, int y, int z);
 
 private:
@@ -19,6 +19,14 @@ RaycastChunkOctreeGpu::RaycastChunkOctreeGpu(Block::Coordinate blockPosition,
     fillData();
 }
 
+RaycastChunkOctreeGpu::RaycastChunkOctreeGpu(Block::Coordinate blockPosition,
+                                             const TexturePackArray& texturePack,
+                                             ChunkContainerBase& parent,
+                                             std::unique_ptr<ChunkBlocks> chunkBlocks)
+    : Chunk(blockPosition, texturePack, parent, std::move(chunkBlocks))
+{
+}
+
 int RaycastChunkOctreeGpu::numberOfVertices()
 {
     return 0;
@@ -39,6 +47,18 @@ void RaycastChunkOctreeGpu::fillData()
     //              buildingTimeElapsed / 1000.f, buildingTimeElapsed / 1000000.f);
 }
 
+void RaycastChunkOctreeGpu::prepareData()
+{
+    MEASURE_SCOPE;
+    mOctree.prepareData(*mChunkOfBlocks);
+}
+
+void RaycastChunkOctreeGpu::updateData()
+{
+    MEASURE_SCOPE;
+    mOctree.updateData();
+}
+
 
 void RaycastChunkOctreeGpu::draw(const Renderer& renderer, const Shader& shader,
                                  const Camera& camera) const
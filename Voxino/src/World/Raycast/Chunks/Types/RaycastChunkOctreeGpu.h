@@ -28,6 +28,23 @@ public:
     RaycastChunkOctreeGpu(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
                           ChunkContainerBase& parent);
 
+    /**
+     * \brief Creates the chunk from already generated blocks, without building its octree.
+     */
+    RaycastChunkOctreeGpu(Block::Coordinate blockPosition, const TexturePackArray& texturePack,
+                          ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks);
+
+    /**
+     * \brief Builds the octree of the chunk, but does not send it to the GPU yet. It does not use
+     * OpenGL, so it can be called from any thread.
+     */
+    void prepareData();
+
+    /**
+     * \brief Sends the most recently built octree to the GPU.
+     */
+    void updateData();
+
     /**
      * Returns the number of chunk vertices
      * @return Number of vertices
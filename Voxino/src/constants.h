@@ -16,4 +16,5 @@
 
 #define CHUNK_CONTAINER_RADIUS 1;
 #define BLOCK_PER_DIMENSION_IN_CHUNK 64;
+// #define USE_MORTON_CHUNK_BLOCKS
 constexpr static auto IS_MINITRACE_COLLECTING_AT_START = false;
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+#include "World/Chunks/ChunkContainerBase.h"
+#include <gmock/gmock.h>
+
+namespace Voxino
+{
+
+class MockChunkContainer : public ChunkContainerBase
+{
+public:
+    MOCK_METHOD(void, draw, (const Renderer&, const Shader&, const Camera&), (const, override));
+    MOCK_METHOD(void, update, (const float&), (override));
+    MOCK_METHOD(void, updateImGui, (), (override));
+    MOCK_METHOD(const Block*, worldBlock, (const Block::Coordinate&), (const, override));
+    MOCK_METHOD(bool, doesWorldBlockExist, (const Block::Coordinate&), (const, override));
+    MOCK_METHOD(void, removeWorldBlock, (const Block::Coordinate&), (override));
+    MOCK_METHOD(std::size_t, erase, (const ChunkContainerBase::Coordinate&), (override));
+    MOCK_METHOD(bool, isPresent, (const ChunkContainerBase::Coordinate&), (const, override));
+    MOCK_METHOD(void, tryToPlaceBlock, (const BlockId&, Block::Coordinate, std::vector<BlockId>),
+                (override));
+    MOCK_METHOD(bool, isEmpty, (), (const, override));
+    MOCK_METHOD(std::size_t, size, (), (const, override));
+};
+
+}// namespace Voxino
@@ -0,0 +1,90 @@
+#include "Renderer/Core/Buffers/BufferRangeAllocator.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+TEST(BufferRangeAllocatorTest, RangesShouldBeAllocatedOneAfterAnother)
+{
+    auto allocator = BufferRangeAllocator(100);
+
+    EXPECT_EQ(allocator.allocate(30), 0u);
+    EXPECT_EQ(allocator.allocate(50), 30u);
+    EXPECT_EQ(allocator.allocate(30), std::nullopt);
+    EXPECT_EQ(allocator.allocate(20), 80u);
+    EXPECT_EQ(allocator.statistics().freeSize, 0u);
+}
+
+TEST(BufferRangeAllocatorTest, SmallestFreeRangeThatFitsShouldBeUsed)
+{
+    auto allocator = BufferRangeAllocator(100);
+    const auto first = *allocator.allocate(40);
+    ASSERT_TRUE(allocator.allocate(10));
+    const auto third = *allocator.allocate(20);
+    ASSERT_TRUE(allocator.allocate(10));
+    allocator.free(first, 40);
+    allocator.free(third, 20);
+
+    EXPECT_EQ(allocator.allocate(15), third);
+    EXPECT_EQ(allocator.allocate(25), first);
+}
+
+TEST(BufferRangeAllocatorTest, FreedRangeShouldBeMergedWithItsNeighbours)
+{
+    auto allocator = BufferRangeAllocator(90);
+    const auto first = *allocator.allocate(30);
+    const auto second = *allocator.allocate(30);
+    const auto third = *allocator.allocate(30);
+    allocator.free(first, 30);
+    allocator.free(third, 30);
+    ASSERT_EQ(allocator.statistics().numberOfFreeRanges, 2u);
+
+    allocator.free(second, 30);
+
+    const auto statistics = allocator.statistics();
+    EXPECT_EQ(statistics.numberOfFreeRanges, 1u);
+    EXPECT_EQ(statistics.largestFreeRange, 90u);
+    EXPECT_EQ(allocator.allocate(90), 0u);
+}
+
+TEST(BufferRangeAllocatorTest, GrowingShouldExtendTheFreeRangeAtTheEnd)
+{
+    auto allocator = BufferRangeAllocator(100);
+    ASSERT_TRUE(allocator.allocate(60));
+
+    allocator.grow(200);
+
+    EXPECT_EQ(allocator.capacity(), 200u);
+    EXPECT_EQ(allocator.statistics().numberOfFreeRanges, 1u);
+    EXPECT_EQ(allocator.allocate(140), 60u);
+}
+
+TEST(BufferRangeAllocatorTest, AllocateBeforeShouldOnlyReturnRangesEndingBeforeTheOffset)
+{
+    auto allocator = BufferRangeAllocator(100);
+    const auto first = *allocator.allocate(20);
+    ASSERT_TRUE(allocator.allocate(30));
+    const auto third = *allocator.allocate(10);
+    allocator.free(first, 20);
+
+    EXPECT_EQ(allocator.allocateBefore(30, third), std::nullopt);
+    EXPECT_EQ(allocator.allocateBefore(10, 5), std::nullopt);
+    EXPECT_EQ(allocator.allocateBefore(10, third), first);
+}
+
+TEST(BufferRangeAllocatorTest, StatisticsShouldDescribeUtilisationAndFragmentation)
+{
+    auto allocator = BufferRangeAllocator(100);
+    const auto first = *allocator.allocate(25);
+    ASSERT_TRUE(allocator.allocate(25));
+    allocator.free(first, 25);
+
+    const auto statistics = allocator.statistics();
+    EXPECT_EQ(statistics.usedSize, 25u);
+    EXPECT_EQ(statistics.freeSize, 75u);
+    EXPECT_EQ(statistics.largestFreeRange, 50u);
+    EXPECT_FLOAT_EQ(statistics.utilisation(), 0.25f);
+    EXPECT_FLOAT_EQ(statistics.fragmentation(), 1.0f / 3.0f);
+}
+
+}// namespace Voxino
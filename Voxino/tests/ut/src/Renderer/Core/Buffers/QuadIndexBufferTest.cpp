@@ -0,0 +1,28 @@
+#include "Renderer/Core/Buffers/QuadIndexBuffer.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Voxino
+{
+
+TEST(QuadIndexBufferTest, QuadIndicesShouldDrawEachQuadAsTwoTriangles)
+{
+    const auto indices = QuadIndexBuffer::quadIndices<std::uint32_t>(2);
+
+    const auto expected = std::vector<std::uint32_t>{0, 1, 2, 2, 3, 0, 4, 5, 6, 6, 7, 4};
+    EXPECT_EQ(indices, expected);
+}
+
+TEST(QuadIndexBufferTest, ShortIndicesShouldReachTheLastVertexOfTheLastQuad)
+{
+    const auto indices =
+        QuadIndexBuffer::quadIndices<std::uint16_t>(QuadIndexBuffer::MAX_QUADS_WITH_SHORT_INDICES);
+
+    ASSERT_EQ(indices.size(), QuadIndexBuffer::MAX_QUADS_WITH_SHORT_INDICES *
+                                  QuadIndexBuffer::INDICES_PER_QUAD);
+    EXPECT_EQ(*std::max_element(indices.begin(), indices.end()), 0xFFFF);
+}
+
+}// namespace Voxino
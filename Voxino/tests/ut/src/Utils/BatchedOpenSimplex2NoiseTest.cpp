@@ -0,0 +1,70 @@
+#include "Utils/BatchedOpenSimplex2Noise.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SEED = 1337;
+constexpr auto FREQUENCY = 0.01f;
+constexpr auto GRID_WIDTH = 67;
+constexpr auto GRID_DEPTH = 13;
+
+FastNoiseLite createScalarNoise()
+{
+    FastNoiseLite noise(SEED);
+    noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+    noise.SetFrequency(FREQUENCY);
+    noise.SetSeed(SEED);
+    return noise;
+}
+}// namespace
+
+class BatchedOpenSimplex2NoiseTest
+    : public testing::TestWithParam<BatchedOpenSimplex2Noise::InstructionSet>
+{
+};
+
+TEST_P(BatchedOpenSimplex2NoiseTest, NoiseShouldMatchFastNoiseLiteWithinTolerance)
+{
+    if (not BatchedOpenSimplex2Noise::isSupported(GetParam()))
+    {
+        GTEST_SKIP() << "Instruction set is not supported by this processor";
+    }
+
+    const auto scalarNoise = createScalarNoise();
+    const auto batchedNoise = BatchedOpenSimplex2Noise(SEED, FREQUENCY);
+    for (const auto& [startX, startZ]:
+         std::array<std::pair<int, int>, 3>{{{0, 0}, {-1000, 523}, {70001, -91283}}})
+    {
+        std::array<float, GRID_WIDTH * GRID_DEPTH> noise{};
+        batchedNoise.fillGrid(noise, startX, startZ, GRID_WIDTH, GRID_DEPTH, GetParam());
+
+        for (auto z = 0; z < GRID_DEPTH; ++z)
+        {
+            for (auto x = 0; x < GRID_WIDTH; ++x)
+            {
+                const auto expected = scalarNoise.GetNoise(static_cast<float>(startX + x),
+                                                           static_cast<float>(startZ + z));
+                ASSERT_NEAR(noise[z * GRID_WIDTH + x], expected,
+                            BatchedOpenSimplex2Noise::TOLERANCE)
+                    << "x: " << startX + x << " z: " << startZ + z;
+            }
+        }
+    }
+}
+
+TEST(BatchedOpenSimplex2NoiseTest, TooSmallOutputShouldThrow)
+{
+    const auto batchedNoise = BatchedOpenSimplex2Noise(SEED, FREQUENCY);
+    std::array<float, 3> noise{};
+    EXPECT_THROW(batchedNoise.fillGrid(noise, 0, 0, 2, 2), std::runtime_error);
+}
+
+INSTANTIATE_TEST_SUITE_P(InstructionSets, BatchedOpenSimplex2NoiseTest,
+                         testing::Values(BatchedOpenSimplex2Noise::InstructionSet::Scalar,
+                                         BatchedOpenSimplex2Noise::InstructionSet::Sse41,
+                                         BatchedOpenSimplex2Noise::InstructionSet::Avx2));
+
+}// namespace Voxino
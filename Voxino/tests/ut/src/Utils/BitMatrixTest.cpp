@@ -0,0 +1,49 @@
+#include "Utils/BitMatrix.h"
+#include "gtest/gtest.h"
+
+#include <array>
+
+namespace Voxino
+{
+
+TEST(BitMatrixTest, TransposeShouldMoveEveryBitToTheMirroredPosition)
+{
+    std::array<std::uint64_t, 64> rows{};
+    auto state = std::uint64_t{0x9E3779B97F4A7C15};
+    for (auto& row: rows)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        row = state;
+    }
+    const auto original = rows;
+
+    transposeBitMatrix64(rows.data());
+
+    for (auto row = 0; row < 64; ++row)
+    {
+        for (auto column = 0; column < 64; ++column)
+        {
+            ASSERT_EQ((rows[column] >> row) & 1, (original[row] >> column) & 1)
+                << "row: " << row << " column: " << column;
+        }
+    }
+}
+
+TEST(BitMatrixTest, TransposingTwiceShouldRestoreTheMatrix)
+{
+    std::array<std::uint64_t, 64> rows{};
+    for (auto row = 0; row < 64; ++row)
+    {
+        rows[row] = (std::uint64_t{1} << row) | (std::uint64_t{0xF0} << (row % 32));
+    }
+    const auto original = rows;
+
+    transposeBitMatrix64(rows.data());
+    transposeBitMatrix64(rows.data());
+
+    EXPECT_EQ(rows, original);
+}
+
+}// namespace Voxino
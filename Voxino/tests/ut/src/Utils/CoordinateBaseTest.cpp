@@ -0,0 +1,45 @@
+#include "Utils/CoordinateBase.h"
+#include "gtest/gtest.h"
+
+#include <unordered_set>
+
+namespace Voxino
+{
+
+TEST(CoordinateBaseTest, ArithmeticShouldWorkOnEveryAxis)
+{
+    const auto first = CoordinateBase(1, -2, 3);
+    const auto second = CoordinateBase(4, 5, -6);
+
+    EXPECT_EQ(first + second, CoordinateBase(5, 3, -3));
+    EXPECT_EQ(first - second, CoordinateBase(-3, -7, 9));
+    EXPECT_NE(first, second);
+}
+
+TEST(CoordinateBaseTest, HashShouldNotCollideOnGridOfChunks)
+{
+    constexpr auto radius = 16;
+    constexpr auto bucketCount = std::size_t{1} << 12;
+
+    std::unordered_set<std::size_t> hashes;
+    std::unordered_set<std::size_t> buckets;
+    for (auto x = -radius; x < radius; ++x)
+    {
+        for (auto y = 0; y < 4; ++y)
+        {
+            for (auto z = -radius; z < radius; ++z)
+            {
+                const auto hash = std::hash<CoordinateBase>()({x * 64, y * 64, z * 64});
+                hashes.insert(hash);
+                buckets.insert(hash % bucketCount);
+            }
+        }
+    }
+
+    const auto numberOfCoordinates = std::size_t{2 * radius * 4 * 2 * radius};
+    EXPECT_EQ(hashes.size(), numberOfCoordinates);
+    // Uniformly spread hashes fill about 1 - 1/e of the buckets when there are as many keys
+    EXPECT_GT(buckets.size(), bucketCount / 2);
+}
+
+}// namespace Voxino
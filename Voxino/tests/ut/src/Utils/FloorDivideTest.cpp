@@ -0,0 +1,27 @@
+#include "Utils/FloorDivide.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+TEST(FloorDivideTest, PowerOfTwoDivisorShouldRoundTowardsNegativeInfinity)
+{
+    EXPECT_EQ(floorDivide(0, 64), 0);
+    EXPECT_EQ(floorDivide(63, 64), 0);
+    EXPECT_EQ(floorDivide(64, 64), 1);
+    EXPECT_EQ(floorDivide(-1, 64), -1);
+    EXPECT_EQ(floorDivide(-64, 64), -1);
+    EXPECT_EQ(floorDivide(-65, 64), -2);
+}
+
+TEST(FloorDivideTest, OtherDivisorShouldRoundTowardsNegativeInfinity)
+{
+    EXPECT_EQ(floorDivide(0, 48), 0);
+    EXPECT_EQ(floorDivide(47, 48), 0);
+    EXPECT_EQ(floorDivide(48, 48), 1);
+    EXPECT_EQ(floorDivide(-1, 48), -1);
+    EXPECT_EQ(floorDivide(-48, 48), -1);
+    EXPECT_EQ(floorDivide(-49, 48), -2);
+}
+
+}// namespace Voxino
@@ -0,0 +1,64 @@
+#include "World/Block/BlockMap.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace Voxino
+{
+
+TEST(BlockMapTest, TexturesShouldBeEncodedTwoFacesPerChannel)
+{
+    auto blockType = BlockType{};
+    blockType.textureId = {1, 2, 3, 4, 5, 6};
+
+    blockType.encodeTextures();
+
+    // Bottom and top, left and right, front and back, the first face of a pair in the high nibble
+    EXPECT_EQ(blockType.rgba, (RGBA{0x12, 0x34, 0x56, 255}));
+}
+
+TEST(BlockMapTest, BlockTypesShouldBeFoundUnderTheirIds)
+{
+    const auto& blockMap = BlockMap::blockMap();
+    for (auto id = 0; id < static_cast<int>(BlockId::Counter); ++id)
+    {
+        const auto blockId = static_cast<BlockId>(id);
+        EXPECT_EQ(blockMap.blockType(blockId).id, blockId);
+    }
+    EXPECT_EQ(blockMap.blockType(BlockId::Air).name, "Air");
+    EXPECT_EQ(blockMap.blockType(BlockId::Stone).name, "Stone");
+}
+
+TEST(BlockMapTest, ColorOfBlockShouldBeEncodedWhenLoaded)
+{
+    const auto& grass = BlockMap::blockMap().blockType(BlockId::Grass);
+    const auto bottom = grass.textureId[static_cast<std::size_t>(Block::Face::Bottom)];
+    const auto top = grass.textureId[static_cast<std::size_t>(Block::Face::Top)];
+
+    EXPECT_EQ(grass.rgba.r, static_cast<GLubyte>((bottom << 4) | top));
+    EXPECT_EQ(grass.rgba.a, 255);
+    EXPECT_EQ(Block(BlockId::Grass).toRGBA(), grass.rgba);
+}
+
+TEST(BlockMapTest, LoadingMoreBlocksThanIdsShouldThrow)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "VoxinoBlockMapTest";
+    std::filesystem::create_directories(directory);
+    {
+        auto textures = std::ofstream(directory / "textures.yaml");
+        textures << "textures:\n  Stone: 3\n";
+        auto blocks = std::ofstream(directory / "blocks.yaml");
+        blocks << "blocks:\n";
+        for (auto i = 0; i <= static_cast<int>(BlockId::Counter); ++i)
+        {
+            blocks << "  - name: Block" << i << "\n    texture: Stone\n";
+        }
+    }
+
+    EXPECT_THROW(BlockMap(directory.string() + "/"), std::runtime_error);
+
+    std::filesystem::remove_all(directory);
+}
+
+}// namespace Voxino
@@ -0,0 +1,39 @@
+#include "World/Block/Block.h"
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+namespace Voxino
+{
+
+TEST(BlockTest, ValueInitializedBlockShouldBeAir)
+{
+    auto valueInitializedBlock = Block{};
+
+    EXPECT_EQ(valueInitializedBlock.id(), BlockId::Air);
+    EXPECT_EQ(Block().id(), BlockId::Air);
+    EXPECT_TRUE(valueInitializedBlock.isTransparent());
+}
+
+TEST(BlockTest, ZeroedMemoryShouldHoldAirBlock)
+{
+    auto block = Block(BlockId::Stone);
+
+    std::memset(static_cast<void*>(&block), 0, sizeof(block));
+
+    EXPECT_EQ(block.id(), BlockId::Air);
+}
+
+TEST(BlockTest, BlockShouldReadPropertiesOfItsType)
+{
+    auto block = Block(BlockId::Stone);
+    EXPECT_EQ(block.id(), BlockId::Stone);
+    EXPECT_FALSE(block.isTransparent());
+
+    block.setBlockType(BlockId::Air);
+
+    EXPECT_EQ(block, Block());
+    EXPECT_TRUE(block.isTransparent());
+}
+
+}// namespace Voxino
@@ -0,0 +1,78 @@
+#include "World/Chunks/ChunkBlocksLayout.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = 64;
+}// namespace
+
+template<typename Layout>
+class ChunkBlocksLayoutTest : public ::testing::Test
+{
+};
+
+using ChunkBlocksLayouts =
+    ::testing::Types<LinearChunkBlocksLayout<SIZE>, MortonChunkBlocksLayout<SIZE>>;
+TYPED_TEST_SUITE(ChunkBlocksLayoutTest, ChunkBlocksLayouts);
+
+TYPED_TEST(ChunkBlocksLayoutTest, EveryPositionShouldHaveItsOwnIndex)
+{
+    std::vector<bool> isIndexUsed(SIZE * SIZE * SIZE, false);
+    for (auto z = 0; z < SIZE; ++z)
+    {
+        for (auto y = 0; y < SIZE; ++y)
+        {
+            for (auto x = 0; x < SIZE; ++x)
+            {
+                const auto index = TypeParam::index(x, y, z);
+                ASSERT_GE(index, 0);
+                ASSERT_LT(index, SIZE * SIZE * SIZE);
+                ASSERT_FALSE(isIndexUsed[index]) << x << " " << y << " " << z;
+                isIndexUsed[index] = true;
+            }
+        }
+    }
+}
+
+TYPED_TEST(ChunkBlocksLayoutTest, PositionShouldBeDecodedFromItsIndex)
+{
+    for (auto index = 0; index < SIZE * SIZE * SIZE; ++index)
+    {
+        const auto position = TypeParam::position(index);
+        ASSERT_EQ(TypeParam::index(position.x, position.y, position.z), index);
+    }
+}
+
+TEST(MortonChunkBlocksLayoutTest, AlignedCubeShouldBeStoredContiguously)
+{
+    using Layout = MortonChunkBlocksLayout<SIZE>;
+    constexpr auto cubeSize = 8;
+    const auto first = Layout::index(16, 8, 24);
+    for (auto i = 0; i < cubeSize * cubeSize * cubeSize; ++i)
+    {
+        const auto position = Layout::position(first + i);
+        EXPECT_GE(position.x, 16);
+        EXPECT_LT(position.x, 16 + cubeSize);
+        EXPECT_GE(position.y, 8);
+        EXPECT_LT(position.y, 8 + cubeSize);
+        EXPECT_GE(position.z, 24);
+        EXPECT_LT(position.z, 24 + cubeSize);
+    }
+}
+
+TEST(MortonChunkBlocksLayoutTest, NeighboursAlongEveryAxisShouldBeClose)
+{
+    using Layout = MortonChunkBlocksLayout<SIZE>;
+
+    EXPECT_EQ(Layout::index(1, 0, 0), 1);
+    EXPECT_EQ(Layout::index(0, 1, 0), 2);
+    EXPECT_EQ(Layout::index(0, 0, 1), 4);
+    EXPECT_EQ(Layout::index(SIZE - 1, SIZE - 1, SIZE - 1), SIZE * SIZE * SIZE - 1);
+}
+
+}// namespace Voxino
@@ -0,0 +1,189 @@
+#include "World/Chunks/ChunkBlocks.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+template<typename Blocks>
+class ChunkBlocksTest : public ::testing::Test
+{
+};
+
+using ChunkBlocksLayouts = ::testing::Types<ChunkBlocks, MortonChunkBlocks>;
+TYPED_TEST_SUITE(ChunkBlocksTest, ChunkBlocksLayouts);
+
+TYPED_TEST(ChunkBlocksTest, ChunkBlocksShouldBeFilledWithAirOnDefault)
+{
+    TypeParam blocks;
+    for (const auto& [position, block]: blocks)
+    {
+        ASSERT_EQ(block.id(), BlockId::Air);
+    }
+    EXPECT_EQ(blocks.paletteSize(), 1);
+}
+
+TYPED_TEST(ChunkBlocksTest, SetBlockShouldChangeOnlyTheGivenBlock)
+{
+    TypeParam blocks;
+    blocks.setBlock(1, 2, 3, BlockId::Stone);
+
+    EXPECT_EQ(blocks.block(1, 2, 3).id(), BlockId::Stone);
+    EXPECT_EQ(blocks.block(3, 2, 1).id(), BlockId::Air);
+    EXPECT_EQ(blocks.block(0, 2, 3).id(), BlockId::Air);
+}
+
+TYPED_TEST(ChunkBlocksTest, PaletteShouldContainEachBlockTypeOnlyOnce)
+{
+    TypeParam blocks;
+    blocks.setBlock(0, 0, 0, BlockId::Stone);
+    blocks.setBlock(1, 0, 0, BlockId::Stone);
+    blocks.setBlock(2, 0, 0, BlockId::Dirt);
+    blocks.setBlock(3, 0, 0, BlockId::Air);
+
+    EXPECT_EQ(blocks.paletteSize(), 3);
+}
+
+TYPED_TEST(ChunkBlocksTest, MemorySizeShouldBeSmallerThanArrayOfBlocks)
+{
+    TypeParam blocks;
+    EXPECT_LT(blocks.memorySize(), sizeof(Block) * TypeParam::BLOCKS_IN_CHUNK);
+}
+
+TYPED_TEST(ChunkBlocksTest, ChunkBlocksShouldStayUniformAfterWritingTheSameBlock)
+{
+    TypeParam blocks;
+    blocks.setBlock(4, 5, 6, BlockId::Air);
+
+    EXPECT_TRUE(blocks.isUniform());
+    EXPECT_EQ(blocks.uniformBlock().id(), BlockId::Air);
+}
+
+TYPED_TEST(ChunkBlocksTest, ChunkBlocksShouldExpandOnFirstDifferentWrite)
+{
+    TypeParam blocks;
+    blocks.fill(BlockId::Stone);
+    const auto uniformSize = blocks.memorySize();
+
+    blocks.setBlock(4, 5, 6, BlockId::Dirt);
+
+    EXPECT_FALSE(blocks.isUniform());
+    EXPECT_GT(blocks.memorySize(), uniformSize);
+    EXPECT_EQ(blocks.block(4, 5, 6).id(), BlockId::Dirt);
+    EXPECT_EQ(blocks.block(6, 5, 4).id(), BlockId::Stone);
+}
+
+TYPED_TEST(ChunkBlocksTest, FillShouldMakeChunkBlocksUniform)
+{
+    TypeParam blocks;
+    blocks.setBlock(1, 1, 1, BlockId::Dirt);
+    blocks.fill(BlockId::Water);
+
+    EXPECT_TRUE(blocks.isUniform());
+    EXPECT_EQ(blocks.block(1, 1, 1).id(), BlockId::Water);
+}
+
+TYPED_TEST(ChunkBlocksTest, IteratorShouldVisitEveryBlockOnceAtItsPosition)
+{
+    TypeParam blocks;
+    blocks.setBlock(1, 2, 3, BlockId::Stone);
+    blocks.setBlock(TypeParam::BLOCKS_PER_X_DIMENSION - 1, 0, 7, BlockId::Dirt);
+
+    auto numberOfBlocks = 0;
+    auto numberOfSolidBlocks = 0;
+    for (const auto& [position, block]: blocks)
+    {
+        ++numberOfBlocks;
+        EXPECT_EQ(block.id(), blocks.block(position.x, position.y, position.z).id());
+        numberOfSolidBlocks += block.id() != BlockId::Air ? 1 : 0;
+    }
+
+    EXPECT_EQ(numberOfBlocks, TypeParam::BLOCKS_IN_CHUNK);
+    EXPECT_EQ(numberOfSolidBlocks, 2);
+}
+
+TYPED_TEST(ChunkBlocksTest, ColumnSpanShouldChangeOnlyTheBlocksOfTheSpan)
+{
+    TypeParam blocks;
+    blocks.setColumnSpan(3, 4, 2, 5, BlockId::Stone);
+
+    EXPECT_EQ(blocks.block(3, 1, 4).id(), BlockId::Air);
+    EXPECT_EQ(blocks.block(3, 2, 4).id(), BlockId::Stone);
+    EXPECT_EQ(blocks.block(3, 4, 4).id(), BlockId::Stone);
+    EXPECT_EQ(blocks.block(3, 5, 4).id(), BlockId::Air);
+    EXPECT_EQ(blocks.block(4, 3, 4).id(), BlockId::Air);
+}
+
+TYPED_TEST(ChunkBlocksTest, CubeShouldVisitOnlyItsOwnBlocks)
+{
+    TypeParam blocks;
+    blocks.setBlock(8, 8, 8, BlockId::Stone);
+    blocks.setBlock(11, 12, 15, BlockId::Stone);
+    blocks.setBlock(16, 8, 8, BlockId::Stone);
+
+    auto numberOfBlocks = 0;
+    auto numberOfStones = 0;
+    blocks.forEachBlockOfCube(glm::ivec3(8, 8, 8), 8,
+                              [&](const Block& block)
+                              {
+                                  ++numberOfBlocks;
+                                  numberOfStones += block.id() == BlockId::Stone ? 1 : 0;
+                              });
+
+    EXPECT_EQ(numberOfBlocks, 8 * 8 * 8);
+    EXPECT_EQ(numberOfStones, 2);
+}
+
+TYPED_TEST(ChunkBlocksTest, OccupancyShouldFollowEveryWrittenBlock)
+{
+    TypeParam blocks;
+    blocks.setBlock(1, 2, 3, BlockId::Stone);
+    blocks.setBlock(5, 2, 3, BlockId::Water);
+    const auto row = 2 + 3 * TypeParam::BLOCKS_PER_Y_DIMENSION;
+
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::Opaque)[row], 1u << 1);
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir)[row], (1u << 1) | (1u << 5));
+
+    blocks.setBlock(1, 2, 3, BlockId::Air);
+
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::Opaque)[row], 0u);
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir)[row], 1u << 5);
+}
+
+TYPED_TEST(ChunkBlocksTest, OccupancyShouldMatchTheBlocksAfterColumnSpan)
+{
+    TypeParam blocks;
+    blocks.setColumnSpan(3, 4, 2, 5, BlockId::Stone);
+    blocks.setColumnSpan(3, 4, 4, 9, BlockId::Water);
+
+    auto opaqueRows = TypeParam::EMPTY_ROWS;
+    auto nonAirRows = TypeParam::EMPTY_ROWS;
+    for (const auto& [position, block]: blocks)
+    {
+        const auto row = position.y + position.z * TypeParam::BLOCKS_PER_Y_DIMENSION;
+        const auto bit = std::uint64_t{1} << position.x;
+        opaqueRows[row] |= block.isTransparent() ? 0 : bit;
+        nonAirRows[row] |= block.id() != BlockId::Air ? bit : 0;
+    }
+
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::Opaque), opaqueRows);
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir), nonAirRows);
+}
+
+TYPED_TEST(ChunkBlocksTest, OccupancyOfUniformChunkShouldBeFullOrEmpty)
+{
+    TypeParam blocks;
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir), TypeParam::EMPTY_ROWS);
+
+    blocks.setBlock(0, 0, 0, BlockId::Stone);
+    blocks.fill(BlockId::Water);
+
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::Opaque), TypeParam::EMPTY_ROWS);
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir), TypeParam::FULL_ROWS);
+
+    blocks.setBlock(0, 0, 0, BlockId::Air);
+
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir).front(), ~std::uint64_t{0} << 1);
+    EXPECT_EQ(blocks.occupancyRows(BlockOccupancy::NonAir).back(), TypeParam::FULL_ROWS.back());
+}
+
+}// namespace Voxino
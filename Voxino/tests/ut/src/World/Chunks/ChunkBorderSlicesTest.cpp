@@ -0,0 +1,127 @@
+#include "World/Chunks/ChunkBorderSlices.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto FACES = std::array{Direction::Above,      Direction::Below,
+                                  Direction::ToTheLeft,  Direction::ToTheRight,
+                                  Direction::InFront,    Direction::Behind};
+
+bool isSet(const ChunkBorderSlices& slices, Direction face, const Block::Coordinate& position)
+{
+    const auto [row, bit] = ChunkBorderSlices::rowAndBit(face, position);
+    return (slices.slice(face)[row] >> bit) & 1;
+}
+}// namespace
+
+TEST(ChunkBorderSlicesTest, EmptyChunkShouldHaveEmptySlices)
+{
+    const auto slices = ChunkBorderSlices(ChunkBlocks());
+
+    for (auto face: FACES)
+    {
+        for (auto row: slices.slice(face))
+        {
+            EXPECT_EQ(row, 0);
+        }
+    }
+}
+
+TEST(ChunkBorderSlicesTest, FullChunkShouldHaveFullSlices)
+{
+    ChunkBlocks blocks;
+    blocks.fill(BlockId::Stone);
+    const auto slices = ChunkBorderSlices(blocks);
+
+    for (auto face: FACES)
+    {
+        for (auto row: slices.slice(face))
+        {
+            EXPECT_EQ(row, ~ChunkBorderSlices::Row{0});
+        }
+    }
+}
+
+TEST(ChunkBorderSlicesTest, BlockInTheCornerShouldBeOnThreeFaces)
+{
+    ChunkBlocks blocks;
+    const auto corner = Block::Coordinate{SIZE - 1, 0, SIZE - 1};
+    blocks.setBlock(corner, BlockId::Stone);
+    const auto slices = ChunkBorderSlices(blocks);
+
+    EXPECT_TRUE(isSet(slices, Direction::ToTheRight, corner));
+    EXPECT_TRUE(isSet(slices, Direction::Below, corner));
+    EXPECT_TRUE(isSet(slices, Direction::InFront, corner));
+    EXPECT_FALSE(isSet(slices, Direction::ToTheLeft, corner));
+    EXPECT_FALSE(isSet(slices, Direction::Above, corner));
+    EXPECT_FALSE(isSet(slices, Direction::Behind, corner));
+}
+
+TEST(ChunkBorderSlicesTest, RowAndBitShouldMatchLocalCoordinates)
+{
+    for (auto face: FACES)
+    {
+        const auto position = ChunkBorderSlices::localCoordinates(face, 5, 9);
+        const auto [row, bit] = ChunkBorderSlices::rowAndBit(face, position);
+
+        EXPECT_EQ(row, 5);
+        EXPECT_EQ(bit, 9);
+    }
+}
+
+TEST(ChunkBorderSlicesTest, UpdateShouldChangeVersionOnlyOfTouchedFaces)
+{
+    ChunkBlocks blocks;
+    auto slices = ChunkBorderSlices(blocks);
+    const auto versionsBefore = slices.versions();
+
+    const auto changedFaces = slices.updateBlock({0, 7, 8}, Block(BlockId::Stone));
+
+    ASSERT_EQ(changedFaces.size(), 1);
+    EXPECT_EQ(changedFaces[0], Direction::ToTheLeft);
+    EXPECT_TRUE(isSet(slices, Direction::ToTheLeft, {0, 7, 8}));
+    for (auto face: FACES)
+    {
+        const auto hasChanged =
+            slices.version(face) != versionsBefore[ChunkBorderSlices::faceIndex(face)];
+        EXPECT_EQ(hasChanged, face == Direction::ToTheLeft);
+    }
+}
+
+TEST(ChunkBorderSlicesTest, UpdateShouldIgnoreBlocksInsideTheChunk)
+{
+    auto slices = ChunkBorderSlices(ChunkBlocks());
+    const auto versionsBefore = slices.versions();
+
+    EXPECT_TRUE(slices.updateBlock({1, 2, 3}, Block(BlockId::Stone)).empty());
+    EXPECT_EQ(slices.versions(), versionsBefore);
+}
+
+TEST(ChunkBorderSlicesTest, UpdateWithTheSameOpacityShouldNotChangeVersion)
+{
+    ChunkBlocks blocks;
+    blocks.setBlock(0, 0, 0, BlockId::Stone);
+    auto slices = ChunkBorderSlices(blocks);
+    const auto versionsBefore = slices.versions();
+
+    EXPECT_TRUE(slices.updateBlock({0, 0, 0}, Block(BlockId::Dirt)).empty());
+    EXPECT_EQ(slices.versions(), versionsBefore);
+}
+
+TEST(ChunkBorderSlicesTest, RebuildShouldReportOnlyChangedFaces)
+{
+    ChunkBlocks blocks;
+    auto slices = ChunkBorderSlices(blocks);
+    blocks.setBlock(3, SIZE - 1, 4, BlockId::Stone);
+
+    const auto changedFaces = slices.rebuild(blocks);
+
+    ASSERT_EQ(changedFaces.size(), 1);
+    EXPECT_EQ(changedFaces[0], Direction::Above);
+}
+
+}// namespace Voxino
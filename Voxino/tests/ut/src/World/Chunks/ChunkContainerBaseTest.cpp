@@ -0,0 +1,39 @@
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/ChunkContainerBase.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+
+int chunkOfBlock(int blockX)
+{
+    return ChunkContainerBase::Coordinate::blockToChunkMetric({blockX, 0, 0}).x;
+}
+}// namespace
+
+TEST(ChunkContainerBaseTest, BlocksShouldBelongToTheChunkContainingThem)
+{
+    EXPECT_EQ(chunkOfBlock(0), 0);
+    EXPECT_EQ(chunkOfBlock(SIZE - 1), 0);
+    EXPECT_EQ(chunkOfBlock(SIZE), 1);
+}
+
+TEST(ChunkContainerBaseTest, NegativeBlocksShouldBelongToTheChunkBelowZero)
+{
+    EXPECT_EQ(chunkOfBlock(-1), -1);
+    EXPECT_EQ(chunkOfBlock(-SIZE), -1);
+    EXPECT_EQ(chunkOfBlock(-SIZE - 1), -2);
+}
+
+TEST(ChunkContainerBaseTest, EveryAxisShouldBeConvertedSeparately)
+{
+    const auto chunk = ChunkContainerBase::Coordinate::blockToChunkMetric({-1, SIZE, 2 * SIZE + 1});
+
+    EXPECT_EQ(chunk, ChunkContainerBase::Coordinate(-1, 1, 2));
+}
+
+}// namespace Voxino
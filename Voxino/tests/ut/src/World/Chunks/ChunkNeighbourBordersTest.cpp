@@ -0,0 +1,85 @@
+#include "World/Chunks/ChunkNeighbourBorders.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+}// namespace
+
+TEST(ChunkNeighbourBordersTest, MissingNeighbourShouldNotBeOpaque)
+{
+    ChunkNeighbourBorders borders;
+
+    EXPECT_FALSE(borders.isOpaque({-1, 0, 0}));
+    EXPECT_FALSE(borders.isOpaque({0, SIZE, 0}));
+    EXPECT_EQ(borders.border(Direction::ToTheLeft), nullptr);
+}
+
+TEST(ChunkNeighbourBordersTest, ShouldCaptureTheSliceOfNeighbourTouchingTheFace)
+{
+    ChunkBlocks leftNeighbour;
+    leftNeighbour.setBlock(SIZE - 1, 2, 3, BlockId::Stone);
+    leftNeighbour.setBlock(0, 3, 2, BlockId::Stone);
+    ChunkBlocks rightNeighbour;
+    rightNeighbour.setBlock(0, 4, 5, BlockId::Dirt);
+    rightNeighbour.setBlock(1, 5, 4, BlockId::Dirt);
+
+    ChunkNeighbourBorders borders;
+    borders.setBorder(Direction::ToTheLeft, ChunkBorderSlices(leftNeighbour));
+    borders.setBorder(Direction::ToTheRight, ChunkBorderSlices(rightNeighbour));
+
+    EXPECT_TRUE(borders.isOpaque({-1, 2, 3}));
+    EXPECT_FALSE(borders.isOpaque({-1, 3, 2}));
+    EXPECT_TRUE(borders.isOpaque({SIZE, 4, 5}));
+    EXPECT_FALSE(borders.isOpaque({SIZE, 5, 4}));
+}
+
+TEST(ChunkNeighbourBordersTest, TransparentBlocksShouldNotBeOpaque)
+{
+    ChunkBlocks belowNeighbour;
+    belowNeighbour.setBlock(1, SIZE - 1, 2, BlockId::Leaves);
+
+    ChunkNeighbourBorders borders;
+    borders.setBorder(Direction::Below, ChunkBorderSlices(belowNeighbour));
+
+    ASSERT_NE(borders.border(Direction::Below), nullptr);
+    EXPECT_FALSE(borders.isOpaque({1, -1, 2}));
+}
+
+TEST(ChunkNeighbourBordersTest, ShouldCaptureEveryDirection)
+{
+    ChunkBlocks stone;
+    stone.fill(BlockId::Stone);
+
+    ChunkNeighbourBorders borders;
+    for (auto direction: {Direction::Above, Direction::Below, Direction::ToTheLeft,
+                          Direction::ToTheRight, Direction::InFront, Direction::Behind})
+    {
+        borders.setBorder(direction, ChunkBorderSlices(stone));
+    }
+
+    for (const auto& position: {Block::Coordinate{1, SIZE, 2}, Block::Coordinate{1, -1, 2},
+                                Block::Coordinate{-1, 1, 2}, Block::Coordinate{SIZE, 1, 2},
+                                Block::Coordinate{1, 2, SIZE}, Block::Coordinate{1, 2, -1}})
+    {
+        EXPECT_TRUE(borders.isOpaque(position));
+    }
+}
+
+TEST(ChunkNeighbourBordersTest, ShouldNotCaptureEdgesAndCorners)
+{
+    ChunkBlocks stone;
+    stone.fill(BlockId::Stone);
+
+    ChunkNeighbourBorders borders;
+    borders.setBorder(Direction::ToTheLeft, ChunkBorderSlices(stone));
+    borders.setBorder(Direction::Below, ChunkBorderSlices(stone));
+
+    EXPECT_FALSE(borders.isOpaque({-1, -1, 0}));
+    EXPECT_FALSE(borders.isOpaque({0, 0, 0}));
+}
+
+}// namespace Voxino
@@ -0,0 +1,39 @@
+#include "World/Chunks/ChunkBlocks.h"
+#include "World/Chunks/SimpleTerrainGenerator.h"
+#include "gtest/gtest.h"
+
+namespace Voxino
+{
+
+TEST(SimpleTerrainGeneratorTest, HeightmapTerrainShouldMatchVoxelByVoxelTerrain)
+{
+    SimpleTerrainGenerator terrainGenerator;
+    for (auto chunkY = 0; chunkY < SimpleTerrainGenerator::MAX_HEIGHT_MAP;
+         chunkY += ChunkBlocks::BLOCKS_PER_Y_DIMENSION)
+    {
+        const auto chunkPosition = Block::Coordinate{-64, chunkY, 128};
+        ChunkBlocks expected;
+        ChunkBlocks generated;
+        terrainGenerator.generateTerrainVoxelByVoxel(chunkPosition, expected);
+        terrainGenerator.generateTerrain(chunkPosition, generated);
+
+        for (const auto& [position, block]: expected)
+        {
+            ASSERT_EQ(generated.block(position).id(), block.id())
+                << "chunk y: " << chunkY << " block: " << position.x << " " << position.y << " "
+                << position.z;
+        }
+    }
+}
+
+TEST(SimpleTerrainGeneratorTest, StackedChunksShouldShareHeightmap)
+{
+    SimpleTerrainGenerator terrainGenerator;
+    const auto lowerChunk = terrainGenerator.heightmap(Block::Coordinate{64, 0, 64});
+    const auto upperChunk = terrainGenerator.heightmap(
+        Block::Coordinate{64, ChunkBlocks::BLOCKS_PER_Y_DIMENSION, 64});
+
+    EXPECT_EQ(lowerChunk, upperChunk);
+}
+
+}// namespace Voxino
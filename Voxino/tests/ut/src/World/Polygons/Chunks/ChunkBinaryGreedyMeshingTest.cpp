@@ -0,0 +1,354 @@
+#include "Resources/TexturePackArray.h"
+#include "World/Chunks/MockChunkContainer.h"
+#include "World/Polygons/Chunks/Types/ChunkBinaryGreedyMeshing.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto VERTICES_PER_QUAD = 4;
+constexpr auto FACES_OF_CUBOID = 6;
+}// namespace
+
+class ChunkBinaryGreedyMeshingTest : public ::testing::Test
+{
+protected:
+    int numberOfQuads(std::unique_ptr<ChunkBlocks> blocks,
+                      std::unique_ptr<ChunkNeighbourBorders> borders =
+                          std::make_unique<ChunkNeighbourBorders>(),
+                      int levelOfDetail = 0)
+    {
+        auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, std::move(blocks));
+        chunk.setNeighbourBorders(std::move(borders));
+        chunk.setLevelOfDetail(levelOfDetail);
+        chunk.rebuildMesh();
+        return chunk.preparedMesh().numberOfVertices() / VERTICES_PER_QUAD;
+    }
+
+    using Quad = std::array<std::uint32_t, 2 * VERTICES_PER_QUAD>;
+
+    /**
+     * Returns the quads of the prepared mesh in a fixed order, as the order of the quads depends
+     * on how the mesh was prepared.
+     */
+    static std::vector<Quad> sortedQuads(const ChunkBinaryGreedyMeshing& chunk)
+    {
+        const auto& mesh = static_cast<const ChunkArrayPackedMesh&>(chunk.preparedMesh());
+        const auto& vertices = mesh.vertices;
+        std::vector<Quad> quads;
+        for (auto first = std::size_t{0}; first < vertices.size(); first += VERTICES_PER_QUAD)
+        {
+            auto& quad = quads.emplace_back();
+            for (auto i = 0; i < VERTICES_PER_QUAD; ++i)
+            {
+                quad[2 * i] = vertices[first + i].position;
+                quad[2 * i + 1] = vertices[first + i].texture;
+            }
+        }
+        std::ranges::sort(quads);
+        return quads;
+    }
+
+    /**
+     * Meshes the blocks, applies the edit to the chunk and checks that patching the mesh around
+     * the edited block gives the same quads as meshing the whole chunk again.
+     */
+    template<typename Edit>
+    void expectPatchedMeshToMatchRebuild(std::unique_ptr<ChunkBlocks> blocks,
+                                         const Block::Coordinate& editedBlock, const Edit& edit)
+    {
+        auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, std::move(blocks));
+        chunk.setNeighbourBorders(std::make_unique<ChunkNeighbourBorders>());
+        chunk.rebuildMesh();
+        chunk.keepDisplayedMesh(chunk.takePreparedMesh(), 0);
+
+        edit(chunk);
+        ASSERT_TRUE(chunk.prepareMeshAround(editedBlock));
+        const auto patchedQuads = sortedQuads(chunk);
+        chunk.rebuildMesh();
+
+        EXPECT_EQ(patchedQuads, sortedQuads(chunk));
+    }
+
+    static std::unique_ptr<ChunkBlocks> terrain()
+    {
+        auto blocks = std::make_unique<ChunkBlocks>();
+        for (auto z = 0; z < SIZE; ++z)
+        {
+            for (auto x = 0; x < SIZE; ++x)
+            {
+                for (auto y = 0; y <= (x * 7 + z * 3) % 11; ++y)
+                {
+                    blocks->setBlock(x, y, z, y < 4 ? BlockId::Stone : BlockId::Dirt);
+                }
+            }
+        }
+        return blocks;
+    }
+
+    TexturePackArray texturePack;
+    ::testing::StrictMock<MockChunkContainer> container;
+};
+
+TEST_F(ChunkBinaryGreedyMeshingTest, EmptyChunkShouldHaveNoQuads)
+{
+    EXPECT_EQ(numberOfQuads(std::make_unique<ChunkBlocks>()), 0);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, SingleBlockInTheFarCornerShouldHaveSixQuads)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(SIZE - 1, SIZE - 1, SIZE - 1, BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks)), FACES_OF_CUBOID);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, BlocksBeyondThirtySecondRowShouldBeMeshed)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(3, 5, 40, BlockId::Stone);
+    blocks->setBlock(3, 5, SIZE - 1, BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks)), 2 * FACES_OF_CUBOID);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, FullRowShouldBeMergedIntoSixQuads)
+{
+    for (auto axis = 0; axis < 3; ++axis)
+    {
+        auto blocks = std::make_unique<ChunkBlocks>();
+        for (auto i = 0; i < SIZE; ++i)
+        {
+            auto position = glm::ivec3(7, 7, 7);
+            position[axis] = i;
+            blocks->setBlock(position.x, position.y, position.z, BlockId::Stone);
+        }
+
+        EXPECT_EQ(numberOfQuads(std::move(blocks)), FACES_OF_CUBOID) << "axis: " << axis;
+    }
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, DifferentTexturesShouldNotBeMerged)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    for (auto x = 0; x < SIZE; ++x)
+    {
+        blocks->setBlock(x, 0, 0, x < SIZE / 2 ? BlockId::Stone : BlockId::Dirt);
+    }
+
+    // Top, bottom, front and back faces are split in two, the ends stay single
+    EXPECT_EQ(numberOfQuads(std::move(blocks)), 4 * 2 + 2);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, FullChunkShouldBeMergedIntoSixQuads)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->fill(BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks)), FACES_OF_CUBOID);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, SolidNeighboursShouldHideAllFacesOfFullChunk)
+{
+    ChunkBlocks stoneBlocks;
+    stoneBlocks.fill(BlockId::Stone);
+    const auto stone = ChunkBorderSlices(stoneBlocks);
+    auto borders = std::make_unique<ChunkNeighbourBorders>();
+    for (auto direction: {Direction::Above, Direction::Below, Direction::ToTheLeft,
+                          Direction::ToTheRight, Direction::InFront, Direction::Behind})
+    {
+        borders->setBorder(direction, stone);
+    }
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->fill(BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks), std::move(borders)), 0);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, SolidNeighbourShouldHideOnlyTheFaceItTouches)
+{
+    ChunkBlocks stoneBlocks;
+    stoneBlocks.fill(BlockId::Stone);
+    const auto stone = ChunkBorderSlices(stoneBlocks);
+    auto borders = std::make_unique<ChunkNeighbourBorders>();
+    borders->setBorder(Direction::Above, stone);
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(1, SIZE - 1, 1, BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks), std::move(borders)), FACES_OF_CUBOID - 1);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, FullChunkShouldLookTheSameAtEveryLevelOfDetail)
+{
+    for (auto level = 0; level <= ChunkBinaryGreedyMeshing::MAX_LEVEL_OF_DETAIL; ++level)
+    {
+        auto blocks = std::make_unique<ChunkBlocks>();
+        blocks->fill(BlockId::Stone);
+
+        EXPECT_EQ(
+            numberOfQuads(std::move(blocks), std::make_unique<ChunkNeighbourBorders>(), level),
+            FACES_OF_CUBOID)
+            << "level: " << level;
+    }
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, CellsThatAreMostlySolidShouldBeMeshedAsSolidBlocks)
+{
+    auto checkerboard = [](ChunkBlocks& blocks)
+    {
+        for (auto z = 0; z < SIZE; ++z)
+        {
+            for (auto y = 0; y < SIZE / 2; ++y)
+            {
+                for (auto x = (y + z) % 2; x < SIZE; x += 2)
+                {
+                    blocks.setBlock(x, y, z, BlockId::Stone);
+                }
+            }
+        }
+    };
+    auto fullDetail = std::make_unique<ChunkBlocks>();
+    checkerboard(*fullDetail);
+    auto downsampled = std::make_unique<ChunkBlocks>();
+    checkerboard(*downsampled);
+
+    EXPECT_GT(numberOfQuads(std::move(fullDetail)), SIZE * SIZE);
+    EXPECT_EQ(numberOfQuads(std::move(downsampled), std::make_unique<ChunkNeighbourBorders>(), 1),
+              FACES_OF_CUBOID);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, CellsThatAreMostlyAirShouldNotBeMeshed)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(1, 1, 1, BlockId::Stone);
+
+    EXPECT_EQ(numberOfQuads(std::move(blocks), std::make_unique<ChunkNeighbourBorders>(), 1), 0);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, CellShouldTakeItsTopmostSolidBlock)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    for (auto z = 0; z < 2; ++z)
+    {
+        for (auto x = 0; x < SIZE; ++x)
+        {
+            blocks->setBlock(x, 0, z, BlockId::Dirt);
+            blocks->setBlock(x, 1, z, x < SIZE / 2 ? BlockId::Stone : BlockId::Dirt);
+        }
+    }
+
+    // A row of 2x2x2 cells, half of stone and half of dirt, like a row of two textures
+    EXPECT_EQ(numberOfQuads(std::move(blocks), std::make_unique<ChunkNeighbourBorders>(), 1),
+              4 * 2 + 2);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, UnsupportedLevelOfDetailShouldThrow)
+{
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container,
+                                          std::make_unique<ChunkBlocks>());
+
+    EXPECT_THROW(chunk.setLevelOfDetail(-1), std::invalid_argument);
+    EXPECT_THROW(chunk.setLevelOfDetail(ChunkBinaryGreedyMeshing::MAX_LEVEL_OF_DETAIL + 1),
+                 std::invalid_argument);
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, FacesShouldLieOnTheSideOfTheBlockTheyPointTo)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(1, 1, 1, BlockId::Stone);
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, std::move(blocks));
+    chunk.setNeighbourBorders(std::make_unique<ChunkNeighbourBorders>());
+    chunk.rebuildMesh();
+    const auto& mesh = static_cast<const ChunkArrayPackedMesh&>(chunk.preparedMesh());
+
+    for (const auto& vertex: mesh.vertices)
+    {
+        const auto position = vertex.unpackPosition();
+        switch (vertex.unpackFace())
+        {
+            case Block::Face::Bottom: EXPECT_EQ(position.y, 1); break;
+            case Block::Face::Top: EXPECT_EQ(position.y, 2); break;
+            case Block::Face::Left: EXPECT_EQ(position.x, 1); break;
+            case Block::Face::Right: EXPECT_EQ(position.x, 2); break;
+            case Block::Face::Back: EXPECT_EQ(position.z, 1); break;
+            case Block::Face::Front: EXPECT_EQ(position.z, 2); break;
+            default: FAIL() << "Unexpected face";
+        }
+    }
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, PatchedMeshAfterRemovingBlockShouldMatchRebuild)
+{
+    for (const auto& removedBlock: {Block::Coordinate{20, 2, 30}, Block::Coordinate{0, 0, 0},
+                                    Block::Coordinate{SIZE - 1, 1, SIZE - 1}})
+    {
+        expectPatchedMeshToMatchRebuild(terrain(), removedBlock,
+                                        [&removedBlock](ChunkBinaryGreedyMeshing& chunk)
+                                        {
+                                            chunk.removeLocalBlock(removedBlock);
+                                        });
+    }
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, PatchedMeshAfterPlacingBlockShouldMatchRebuild)
+{
+    for (const auto& placedBlock: {Block::Coordinate{20, 12, 30}, Block::Coordinate{5, SIZE - 1, 0},
+                                   Block::Coordinate{SIZE - 1, 11, 7}})
+    {
+        expectPatchedMeshToMatchRebuild(terrain(), placedBlock,
+                                        [&placedBlock](ChunkBinaryGreedyMeshing& chunk)
+                                        {
+                                            chunk.tryToPlaceBlock(BlockId::Stone, placedBlock);
+                                        });
+    }
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, MeshShouldNotBePatchedWithoutDisplayedMesh)
+{
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, terrain());
+
+    EXPECT_FALSE(chunk.prepareMeshAround({1, 1, 1}));
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, DownsampledMeshShouldNotBePatched)
+{
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, terrain());
+    chunk.setNeighbourBorders(std::make_unique<ChunkNeighbourBorders>());
+    chunk.setLevelOfDetail(1);
+    chunk.rebuildMesh();
+    chunk.keepDisplayedMesh(chunk.takePreparedMesh(), 1);
+
+    EXPECT_FALSE(chunk.prepareMeshAround({1, 1, 1}));
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, DownsampledMeshShouldNotBePatchedAfterReturningToFullDetail)
+{
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, terrain());
+    chunk.setNeighbourBorders(std::make_unique<ChunkNeighbourBorders>());
+    chunk.setLevelOfDetail(1);
+    chunk.rebuildMesh();
+    chunk.keepDisplayedMesh(chunk.takePreparedMesh(), 1);
+    chunk.setLevelOfDetail(0);
+
+    EXPECT_FALSE(chunk.prepareMeshAround({1, 1, 1}));
+}
+
+TEST_F(ChunkBinaryGreedyMeshingTest, FullDetailMeshShouldBePatchedWhileChunkIsDownsampled)
+{
+    auto chunk = ChunkBinaryGreedyMeshing({0, 0, 0}, texturePack, container, terrain());
+    chunk.setNeighbourBorders(std::make_unique<ChunkNeighbourBorders>());
+    chunk.rebuildMesh();
+    chunk.keepDisplayedMesh(chunk.takePreparedMesh(), 0);
+    chunk.setLevelOfDetail(1);
+
+    EXPECT_TRUE(chunk.prepareMeshAround({1, 1, 1}));
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,119 @@
+#include "Resources/TexturePackArray.h"
+#include "World/Chunks/MockChunkContainer.h"
+#include "World/Polygons/Chunks/ChunkFaceVisibility.h"
+#include "World/Polygons/Chunks/Types/ChunkCulling.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto FACES = std::array{Block::Face::Bottom, Block::Face::Top,   Block::Face::Left,
+                                  Block::Face::Right,  Block::Face::Front, Block::Face::Back};
+}// namespace
+
+class ChunkFaceVisibilityTest : public ::testing::Test
+{
+protected:
+    const ChunkFaceVisibility& build(std::unique_ptr<ChunkBlocks> blocks,
+                                     std::unique_ptr<ChunkNeighbourBorders> borders =
+                                         std::make_unique<ChunkNeighbourBorders>())
+    {
+        chunk = std::make_unique<ChunkCulling>(Block::Coordinate(0, 0, 0), texturePack, container,
+                                               std::move(blocks));
+        chunk->setNeighbourBorders(std::move(borders));
+        visibility.build(*chunk);
+        return visibility;
+    }
+
+    int numberOfVisibleFaces(const ChunkFaceVisibility& faces, const Block::Coordinate& position)
+    {
+        auto count = 0;
+        for (auto face: FACES)
+        {
+            count += faces.isVisible(face, position) ? 1 : 0;
+        }
+        return count;
+    }
+
+    TexturePackArray texturePack;
+    ::testing::StrictMock<MockChunkContainer> container;
+    std::unique_ptr<ChunkCulling> chunk;
+    ChunkFaceVisibility visibility;
+};
+
+TEST_F(ChunkFaceVisibilityTest, AirShouldHaveNoVisibleFaces)
+{
+    const auto& faces = build(std::make_unique<ChunkBlocks>());
+
+    EXPECT_EQ(numberOfVisibleFaces(faces, {0, 0, 0}), 0);
+    EXPECT_EQ(numberOfVisibleFaces(faces, {SIZE - 1, SIZE - 1, SIZE - 1}), 0);
+}
+
+TEST_F(ChunkFaceVisibilityTest, SingleBlockShouldHaveAllFacesVisible)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(0, 0, 0, BlockId::Stone);
+    blocks->setBlock(SIZE - 1, SIZE - 1, SIZE - 1, BlockId::Stone);
+    const auto& faces = build(std::move(blocks));
+
+    EXPECT_EQ(numberOfVisibleFaces(faces, {0, 0, 0}), FACES.size());
+    EXPECT_EQ(numberOfVisibleFaces(faces, {SIZE - 1, SIZE - 1, SIZE - 1}), FACES.size());
+    EXPECT_EQ(numberOfVisibleFaces(faces, {1, 0, 0}), 0);
+}
+
+TEST_F(ChunkFaceVisibilityTest, FacesBetweenOpaqueBlocksShouldBeHidden)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(4, 4, 4, BlockId::Stone);
+    blocks->setBlock(5, 4, 4, BlockId::Stone);
+    blocks->setBlock(4, 5, 4, BlockId::Stone);
+    blocks->setBlock(4, 4, 5, BlockId::Stone);
+    const auto& faces = build(std::move(blocks));
+
+    EXPECT_FALSE(faces.isVisible(Block::Face::Right, {4, 4, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Left, {5, 4, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Top, {4, 4, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Bottom, {4, 5, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Front, {4, 4, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Back, {4, 4, 5}));
+    EXPECT_TRUE(faces.isVisible(Block::Face::Left, {4, 4, 4}));
+    EXPECT_TRUE(faces.isVisible(Block::Face::Bottom, {4, 4, 4}));
+    EXPECT_TRUE(faces.isVisible(Block::Face::Back, {4, 4, 4}));
+}
+
+TEST_F(ChunkFaceVisibilityTest, TransparentBlockShouldNotHideFacesOfItsNeighbours)
+{
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(4, 4, 4, BlockId::Stone);
+    blocks->setBlock(5, 4, 4, BlockId::Leaves);
+    const auto& faces = build(std::move(blocks));
+
+    EXPECT_TRUE(faces.isVisible(Block::Face::Right, {4, 4, 4}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Left, {5, 4, 4}));
+    EXPECT_EQ(numberOfVisibleFaces(faces, {5, 4, 4}), FACES.size() - 1);
+}
+
+TEST_F(ChunkFaceVisibilityTest, OpaqueNeighbourChunkShouldHideOnlyTheFacesItTouches)
+{
+    ChunkBlocks stoneBlocks;
+    stoneBlocks.fill(BlockId::Stone);
+    const auto stone = ChunkBorderSlices(stoneBlocks);
+    auto borders = std::make_unique<ChunkNeighbourBorders>();
+    borders->setBorder(Direction::ToTheRight, stone);
+    borders->setBorder(Direction::Below, stone);
+    auto blocks = std::make_unique<ChunkBlocks>();
+    blocks->setBlock(SIZE - 1, 0, 7, BlockId::Stone);
+    blocks->setBlock(0, 0, 7, BlockId::Stone);
+    const auto& faces = build(std::move(blocks), std::move(borders));
+
+    EXPECT_FALSE(faces.isVisible(Block::Face::Right, {SIZE - 1, 0, 7}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Bottom, {SIZE - 1, 0, 7}));
+    EXPECT_EQ(numberOfVisibleFaces(faces, {SIZE - 1, 0, 7}), FACES.size() - 2);
+    EXPECT_TRUE(faces.isVisible(Block::Face::Left, {0, 0, 7}));
+    EXPECT_FALSE(faces.isVisible(Block::Face::Bottom, {0, 0, 7}));
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,56 @@
+#include "World/Polygons/Chunks/ChunkLevelOfDetail.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto MAX_LEVEL = 3;
+constexpr auto FULL_DETAIL_DISTANCE = 100.f;
+constexpr auto HYSTERESIS = 0.1f;
+}// namespace
+
+class ChunkLevelOfDetailTest : public ::testing::Test
+{
+protected:
+    ChunkLevelOfDetail levelOfDetail{MAX_LEVEL, FULL_DETAIL_DISTANCE, HYSTERESIS};
+};
+
+TEST_F(ChunkLevelOfDetailTest, EveryLevelShouldStartTwiceAsFarAsThePreviousOne)
+{
+    EXPECT_FLOAT_EQ(levelOfDetail.startOfLevel(1), 100.f);
+    EXPECT_FLOAT_EQ(levelOfDetail.startOfLevel(2), 200.f);
+    EXPECT_FLOAT_EQ(levelOfDetail.startOfLevel(3), 400.f);
+}
+
+TEST_F(ChunkLevelOfDetailTest, NearChunksShouldStayInFullDetail)
+{
+    EXPECT_EQ(levelOfDetail.select(0.f, 0), 0);
+    EXPECT_EQ(levelOfDetail.select(50.f, 0), 0);
+    EXPECT_EQ(levelOfDetail.select(50.f, MAX_LEVEL), 0);
+}
+
+TEST_F(ChunkLevelOfDetailTest, DistantChunksShouldUseTheLevelOfTheirDistance)
+{
+    EXPECT_EQ(levelOfDetail.select(150.f, 0), 1);
+    EXPECT_EQ(levelOfDetail.select(300.f, 0), 2);
+    EXPECT_EQ(levelOfDetail.select(1000.f, 0), MAX_LEVEL);
+}
+
+TEST_F(ChunkLevelOfDetailTest, LevelShouldNotChangeWithinTheHysteresis)
+{
+    EXPECT_EQ(levelOfDetail.select(105.f, 0), 0);
+    EXPECT_EQ(levelOfDetail.select(95.f, 1), 1);
+    EXPECT_EQ(levelOfDetail.select(115.f, 0), 1);
+    EXPECT_EQ(levelOfDetail.select(85.f, 1), 0);
+}
+
+TEST_F(ChunkLevelOfDetailTest, LevelShouldNeverExceedTheMaximum)
+{
+    const auto coarsest = ChunkLevelOfDetail(1, FULL_DETAIL_DISTANCE, HYSTERESIS);
+
+    EXPECT_EQ(coarsest.select(10000.f, 0), 1);
+}
+
+}// namespace Voxino::Polygons
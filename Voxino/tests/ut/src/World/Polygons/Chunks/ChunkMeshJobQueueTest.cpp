@@ -0,0 +1,143 @@
+#include "Resources/TexturePackArray.h"
+#include "World/Chunks/MockChunkContainer.h"
+#include "World/Polygons/Chunks/ChunkMeshJobQueue.h"
+#include "World/Polygons/Chunks/Types/ChunkCulling.h"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+const auto CHUNK_POSITION =
+    Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
+
+/**
+ * \brief Chunk whose detached copies built by the workers fail to be created.
+ */
+class ThrowingChunk : public ChunkCulling
+{
+public:
+    using ChunkCulling::ChunkCulling;
+
+    ThrowingChunk(const Block::Coordinate& blockPosition, const TexturePackArray& texturePack,
+                  ChunkContainerBase& parent, std::unique_ptr<ChunkBlocks> chunkBlocks)
+        : ChunkCulling(blockPosition, texturePack, parent, std::move(chunkBlocks))
+    {
+        throw std::runtime_error("Detached chunk could not be created");
+    }
+};
+}// namespace
+
+class ChunkMeshJobQueueTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<ChunkCulling> createChunk()
+    {
+        return std::make_shared<ChunkCulling>(CHUNK_POSITION, texturePack);
+    }
+
+    void enqueue(const std::shared_ptr<ChunkCulling>& chunk,
+                 std::unique_ptr<ChunkNeighbourBorders> borders =
+                     std::make_unique<ChunkNeighbourBorders>())
+    {
+        queue.enqueue(chunk, std::make_unique<ChunkBlocks>(chunk->blocks()), std::move(borders));
+    }
+
+    TexturePackArray texturePack;
+    ::testing::StrictMock<MockChunkContainer> container;
+    ChunkMeshJobQueue<ChunkCulling> queue{texturePack, container, 2};
+};
+
+TEST_F(ChunkMeshJobQueueTest, ShouldPrepareTheSameMeshAsTheChunkItself)
+{
+    const auto chunk = createChunk();
+    enqueue(chunk);
+    queue.waitForPendingJobs();
+
+    auto finishedMeshes = queue.takeFinishedMeshes(1);
+
+    ASSERT_EQ(finishedMeshes.size(), 1);
+    EXPECT_EQ(finishedMeshes[0].chunk.lock(), chunk);
+    EXPECT_EQ(finishedMeshes[0].mesh->numberOfVertices(),
+              chunk->preparedMesh().numberOfVertices());
+    EXPECT_EQ(finishedMeshes[0].mesh->memorySize(), chunk->preparedMesh().memorySize());
+}
+
+TEST_F(ChunkMeshJobQueueTest, SolidNeighbourBordersShouldHideFacesOfTheChunk)
+{
+    const auto chunk = createChunk();
+    ChunkBlocks stoneBlocks;
+    stoneBlocks.fill(BlockId::Stone);
+    const auto stone = ChunkBorderSlices(stoneBlocks);
+    auto borders = std::make_unique<ChunkNeighbourBorders>();
+    for (auto direction: {Direction::Below, Direction::ToTheLeft, Direction::ToTheRight,
+                          Direction::InFront, Direction::Behind})
+    {
+        borders->setBorder(direction, stone);
+    }
+    enqueue(chunk, std::move(borders));
+    queue.waitForPendingJobs();
+
+    auto finishedMeshes = queue.takeFinishedMeshes(1);
+
+    ASSERT_EQ(finishedMeshes.size(), 1);
+    EXPECT_LT(finishedMeshes[0].mesh->numberOfVertices(),
+              chunk->preparedMesh().numberOfVertices());
+}
+
+TEST_F(ChunkMeshJobQueueTest, ShouldDropOutdatedMeshesOfTheSameChunk)
+{
+    const auto chunk = createChunk();
+    enqueue(chunk);
+    enqueue(chunk);
+    enqueue(chunk);
+    queue.waitForPendingJobs();
+
+    EXPECT_EQ(queue.takeFinishedMeshes(3).size(), 1);
+    EXPECT_EQ(queue.numberOfPendingJobs(), 0);
+}
+
+TEST_F(ChunkMeshJobQueueTest, ShouldNotTakeMoreMeshesThanRequested)
+{
+    const auto chunks = std::array{createChunk(), createChunk(), createChunk()};
+    for (const auto& chunk: chunks)
+    {
+        enqueue(chunk);
+    }
+    queue.waitForPendingJobs();
+
+    EXPECT_EQ(queue.takeFinishedMeshes(2).size(), 2);
+    EXPECT_EQ(queue.takeFinishedMeshes(2).size(), 1);
+    EXPECT_TRUE(queue.takeFinishedMeshes(2).empty());
+}
+
+TEST_F(ChunkMeshJobQueueTest, ForgottenChunkShouldNotBePendingNorGetItsMesh)
+{
+    const auto chunk = createChunk();
+    enqueue(chunk);
+    EXPECT_TRUE(queue.isPending(*chunk));
+
+    queue.forget(*chunk);
+    queue.waitForPendingJobs();
+
+    EXPECT_FALSE(queue.isPending(*chunk));
+    EXPECT_TRUE(queue.takeFinishedMeshes(1).empty());
+}
+
+TEST_F(ChunkMeshJobQueueTest, ChunkWhoseJobThrewShouldNotStayPending)
+{
+    auto throwingQueue = ChunkMeshJobQueue<ThrowingChunk>{texturePack, container, 2};
+    const auto chunk = std::make_shared<ThrowingChunk>(CHUNK_POSITION, texturePack);
+    throwingQueue.enqueue(chunk, std::make_unique<ChunkBlocks>(chunk->blocks()),
+                          std::make_unique<ChunkNeighbourBorders>());
+    throwingQueue.waitForPendingJobs();
+
+    EXPECT_FALSE(throwingQueue.isPending(*chunk));
+    EXPECT_THROW(throwingQueue.takeFinishedMeshes(1), std::runtime_error);
+    EXPECT_TRUE(throwingQueue.takeFinishedMeshes(1).empty());
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,80 @@
+#include "Resources/TexturePackArray.h"
+#include "World/Polygons/Chunks/Types/ChunkBinaryGreedyMeshing.h"
+#include "World/Polygons/Chunks/Types/ChunkCulling.h"
+#include "World/Polygons/Chunks/Types/ChunkCullingGpu.h"
+#include "World/Polygons/Chunks/Types/ChunkCullingInstanced.h"
+#include "World/Polygons/Chunks/Types/ChunkGreedyMeshing.h"
+#include "World/Polygons/Chunks/Types/ChunkNaive.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+const auto CHUNK_POSITION =
+    Block::Coordinate{0, (SimpleTerrainGenerator::MAX_HEIGHT_MAP / 4), 0};
+constexpr auto VERTICES_PER_QUAD = 4;
+}// namespace
+
+template<typename ChunkType>
+class PolygonChunkMeshTest : public ::testing::Test
+{
+};
+
+using IndexedChunkTypes =
+    ::testing::Types<ChunkNaive, ChunkCulling, ChunkGreedyMeshing, ChunkBinaryGreedyMeshing>;
+TYPED_TEST_SUITE(PolygonChunkMeshTest, IndexedChunkTypes);
+
+TYPED_TEST(PolygonChunkMeshTest, ShouldPrepareMeshWithoutOpenGLContext)
+{
+    const auto texturePack = TexturePackArray();
+    const auto chunk = TypeParam(CHUNK_POSITION, texturePack);
+    const auto& mesh = chunk.preparedMesh();
+
+    EXPECT_GT(mesh.numberOfVertices(), 0);
+    EXPECT_EQ(mesh.numberOfVertices() % VERTICES_PER_QUAD, 0);
+}
+
+TEST(PolygonChunkMeshTest, CullingShouldNotCreateMoreVerticesThanNaive)
+{
+    const auto texturePack = TexturePackArray();
+    const auto naive = ChunkNaive(CHUNK_POSITION, texturePack);
+    const auto culling = ChunkCulling(CHUNK_POSITION, texturePack);
+
+    EXPECT_LT(culling.preparedMesh().numberOfVertices(), naive.preparedMesh().numberOfVertices());
+}
+
+TEST(PolygonChunkMeshTest, GreedyMeshingShouldNotCreateMoreVerticesThanCulling)
+{
+    const auto texturePack = TexturePackArray();
+    const auto culling = ChunkCulling(CHUNK_POSITION, texturePack);
+    const auto greedy = ChunkGreedyMeshing(CHUNK_POSITION, texturePack);
+    const auto binaryGreedy = ChunkBinaryGreedyMeshing(CHUNK_POSITION, texturePack);
+
+    EXPECT_LE(greedy.preparedMesh().numberOfVertices(), culling.preparedMesh().numberOfVertices());
+    EXPECT_LE(binaryGreedy.preparedMesh().numberOfVertices(),
+              culling.preparedMesh().numberOfVertices());
+}
+
+TEST(PolygonChunkMeshTest, CullingGpuShouldCreateOnePointPerVisibleFace)
+{
+    const auto texturePack = TexturePackArray();
+    const auto culling = ChunkCulling(CHUNK_POSITION, texturePack);
+    const auto cullingGpu = ChunkCullingGpu(CHUNK_POSITION, texturePack);
+
+    EXPECT_EQ(cullingGpu.preparedMesh().numberOfVertices(),
+              culling.preparedMesh().numberOfVertices() / VERTICES_PER_QUAD);
+}
+
+TEST(PolygonChunkMeshTest, CullingInstancedShouldCreateOneRecordPerVisibleFace)
+{
+    const auto texturePack = TexturePackArray();
+    const auto culling = ChunkCulling(CHUNK_POSITION, texturePack);
+    const auto cullingInstanced = ChunkCullingInstanced(CHUNK_POSITION, texturePack);
+
+    EXPECT_EQ(cullingInstanced.preparedMesh().numberOfVertices(),
+              culling.preparedMesh().numberOfVertices() / VERTICES_PER_QUAD);
+}
+
+}// namespace Voxino::Polygons
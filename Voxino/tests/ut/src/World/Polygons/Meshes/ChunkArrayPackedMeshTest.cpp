@@ -0,0 +1,98 @@
+#include "World/Polygons/Meshes/Builders/ChunkArrayMeshBuilder.h"
+#include "World/Polygons/Meshes/Builders/ChunkArrayPackedMeshBuilder.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto FACES = std::array{Block::Face::Bottom, Block::Face::Top,   Block::Face::Left,
+                                  Block::Face::Right,  Block::Face::Front, Block::Face::Back};
+}// namespace
+
+TEST(ChunkArrayPackedMeshTest, PackedVertexShouldUnpackToTheSameValues)
+{
+    const auto vertex = ChunkArrayPackedMesh::VertexData::pack({SIZE, 0, 37}, Block::Face::Back,
+                                                               {SIZE, 1}, 1234);
+
+    EXPECT_EQ(vertex.unpackPosition(), glm::ivec3(SIZE, 0, 37));
+    EXPECT_EQ(vertex.unpackFace(), Block::Face::Back);
+    EXPECT_EQ(vertex.unpackTextureCoordinates(), glm::ivec2(SIZE, 1));
+    EXPECT_EQ(vertex.unpackTextureId(), 1234);
+}
+
+TEST(ChunkArrayPackedMeshTest, PackedQuadsShouldMatchQuadsOfArrayMesh)
+{
+    ChunkArrayMeshBuilder arrayBuilder;
+    ChunkArrayPackedMeshBuilder packedBuilder;
+    const auto position = Block::Coordinate(SIZE - 1, 5, 0);
+    for (auto face: FACES)
+    {
+        arrayBuilder.addQuad(face, 7, position);
+        packedBuilder.addQuad(face, 7, position);
+
+        auto region = MeshRegion{.id = 3, .face = face, .blockPosition = {2, 3, 4}};
+        region.width = 10;
+        region.height = 20;
+        region.textureCoordinates = {glm::vec2(10, 20), glm::vec2(0, 20), glm::vec2(0, 0),
+                                     glm::vec2(10, 0)};
+        arrayBuilder.addQuad(region, ChunkMeshBuilder::BINARY_GREEDY);
+        packedBuilder.addQuad(region, ChunkMeshBuilder::BINARY_GREEDY);
+    }
+
+    const auto& arrayMesh = static_cast<const ChunkArrayMesh&>(arrayBuilder.preparedMesh());
+    const auto& packedMesh = static_cast<const ChunkArrayPackedMesh&>(packedBuilder.preparedMesh());
+    ASSERT_EQ(arrayMesh.vertices.size(), packedMesh.vertices.size());
+    for (auto i = std::size_t{0}; i < arrayMesh.vertices.size(); ++i)
+    {
+        const auto& expected = arrayMesh.vertices[i];
+        const auto& packed = packedMesh.vertices[i];
+        EXPECT_EQ(glm::vec3(packed.unpackPosition()), expected.position) << "vertex: " << i;
+        EXPECT_EQ(glm::vec2(packed.unpackTextureCoordinates()), expected.textureCoordinates)
+            << "vertex: " << i;
+        EXPECT_EQ(static_cast<float>(packed.unpackTextureId()), expected.textureId)
+            << "vertex: " << i;
+    }
+}
+
+TEST(ChunkArrayPackedMeshTest, PackedMeshShouldTakeAThirdOfTheMemory)
+{
+    ChunkArrayMeshBuilder arrayBuilder;
+    ChunkArrayPackedMeshBuilder packedBuilder;
+    arrayBuilder.addQuad(Block::Face::Top, 1, {0, 0, 0});
+    packedBuilder.addQuad(Block::Face::Top, 1, {0, 0, 0});
+
+    EXPECT_EQ(packedBuilder.preparedMesh().memorySize(), 4 * 8);
+    EXPECT_EQ(arrayBuilder.preparedMesh().memorySize(),
+              3 * packedBuilder.preparedMesh().memorySize());
+}
+
+TEST(ChunkArrayPackedMeshTest, TakenMeshShouldLeaveTheBuilderEmpty)
+{
+    ChunkArrayPackedMeshBuilder builder;
+    builder.addQuad(Block::Face::Top, 1, {0, 0, 0});
+
+    const auto mesh = builder.takeMesh();
+
+    EXPECT_EQ(mesh->numberOfVertices(), 4);
+    EXPECT_EQ(builder.preparedMesh().numberOfVertices(), 0);
+}
+
+TEST(ChunkArrayPackedMeshTest, RecycledMeshShouldBeReusedByTheBuilder)
+{
+    ChunkArrayPackedMeshBuilder builder;
+    builder.addQuad(Block::Face::Top, 1, {0, 0, 0});
+    auto mesh = builder.takeMesh();
+    const auto* vertices = static_cast<const ChunkArrayPackedMesh&>(*mesh).vertices.data();
+
+    builder.recycleMesh(std::move(mesh));
+    builder.addQuad(Block::Face::Bottom, 2, {0, 0, 0});
+
+    const auto& recycled = static_cast<const ChunkArrayPackedMesh&>(builder.preparedMesh());
+    EXPECT_EQ(recycled.vertices.size(), 4);
+    EXPECT_EQ(recycled.vertices.data(), vertices);
+}
+
+}// namespace Voxino::Polygons
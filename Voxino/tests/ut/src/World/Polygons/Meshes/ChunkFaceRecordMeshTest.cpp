@@ -0,0 +1,70 @@
+#include "World/Polygons/Meshes/Builders/ChunkFaceRecordMeshBuilder.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+constexpr auto SIZE = ChunkBlocks::BLOCKS_PER_DIMENSION;
+constexpr auto FACES = std::array{Block::Face::Bottom, Block::Face::Top,   Block::Face::Left,
+                                  Block::Face::Right,  Block::Face::Front, Block::Face::Back};
+}// namespace
+
+TEST(ChunkFaceRecordMeshTest, PackedFaceShouldUnpackToTheSameValues)
+{
+    const auto record = ChunkFaceRecordMesh::FaceRecord::pack({SIZE - 1, 0, 37},
+                                                              Block::Face::Back, 1234, SIZE, 1);
+
+    EXPECT_EQ(record.unpackPosition(), glm::ivec3(SIZE - 1, 0, 37));
+    EXPECT_EQ(record.unpackFace(), Block::Face::Back);
+    EXPECT_EQ(record.unpackTextureId(), 1234);
+    EXPECT_EQ(record.unpackSize(), glm::ivec2(SIZE, 1));
+}
+
+TEST(ChunkFaceRecordMeshTest, BuilderShouldAddOneRecordPerFace)
+{
+    ChunkFaceRecordMeshBuilder builder;
+    const auto position = Block::Coordinate(SIZE - 1, 5, 0);
+    for (auto face: FACES)
+    {
+        builder.addFace(face, 7, position);
+    }
+
+    const auto& mesh = static_cast<const ChunkFaceRecordMesh&>(builder.preparedMesh());
+    ASSERT_EQ(mesh.numberOfVertices(), FACES.size());
+    for (auto i = std::size_t{0}; i < FACES.size(); ++i)
+    {
+        EXPECT_EQ(mesh.faces[i].unpackPosition(), glm::ivec3(SIZE - 1, 5, 0)) << "face: " << i;
+        EXPECT_EQ(mesh.faces[i].unpackFace(), FACES[i]) << "face: " << i;
+        EXPECT_EQ(mesh.faces[i].unpackTextureId(), 7) << "face: " << i;
+        EXPECT_EQ(mesh.faces[i].unpackSize(), glm::ivec2(1, 1)) << "face: " << i;
+    }
+}
+
+TEST(ChunkFaceRecordMeshTest, MergedQuadShouldKeepItsSize)
+{
+    ChunkFaceRecordMeshBuilder builder;
+    auto region = MeshRegion{.id = 3, .face = Block::Face::Top, .blockPosition = {2, 3, 4}};
+    region.width = 10;
+    region.height = 20;
+    builder.addQuad(region);
+
+    const auto& mesh = static_cast<const ChunkFaceRecordMesh&>(builder.preparedMesh());
+    ASSERT_EQ(mesh.faces.size(), 1);
+    EXPECT_EQ(mesh.faces[0].unpackPosition(), glm::ivec3(2, 3, 4));
+    EXPECT_EQ(mesh.faces[0].unpackSize(), glm::ivec2(10, 20));
+}
+
+TEST(ChunkFaceRecordMeshTest, FaceShouldTakeEightBytes)
+{
+    ChunkFaceRecordMeshBuilder builder;
+    builder.addFace(Block::Face::Top, 1, {0, 0, 0});
+
+    EXPECT_EQ(builder.preparedMesh().memorySize(), 8);
+
+    builder.resetMesh();
+    EXPECT_EQ(builder.preparedMesh().numberOfVertices(), 0);
+}
+
+}// namespace Voxino::Polygons
@@ -0,0 +1,257 @@
+#include "World/Polygons/Meshes/ChunkMeshArenaLayout.h"
+#include "gtest/gtest.h"
+
+namespace Voxino::Polygons
+{
+
+namespace
+{
+ChunkMeshArenaLayout::VerticesPerFace topFaces(unsigned int numberOfVertices)
+{
+    auto verticesPerFace = ChunkMeshArenaLayout::VerticesPerFace{};
+    verticesPerFace[static_cast<int>(Block::Face::Top)] = numberOfVertices;
+    return verticesPerFace;
+}
+
+ChunkMeshArenaLayout::FaceMask faces(std::initializer_list<Block::Face> faces)
+{
+    auto mask = ChunkMeshArenaLayout::FaceMask{0};
+    for (auto face: faces)
+    {
+        mask |= 1u << static_cast<int>(face);
+    }
+    return mask;
+}
+
+ChunkMeshArenaLayout::DrawCommands allFaceCommands(const ChunkMeshArenaLayout& layout)
+{
+    auto visibleFaces = std::array<ChunkMeshArenaLayout::FaceMask,
+                                   ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS>{};
+    visibleFaces.fill(ChunkMeshArenaLayout::ALL_FACES);
+    auto commands = ChunkMeshArenaLayout::DrawCommands{};
+    layout.buildDrawCommands(visibleFaces, commands);
+    return commands;
+}
+}// namespace
+
+TEST(ChunkMeshArenaLayoutTest, MeshesShouldBePlacedOneAfterAnother)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+
+    EXPECT_EQ(layout.place(first, topFaces(400)), 0);
+    EXPECT_EQ(layout.place(second, topFaces(800)), 400);
+    EXPECT_EQ(layout.capacity(), 1200);
+    EXPECT_EQ(layout.numberOfVertices(), 1200);
+    EXPECT_EQ(layout.maxNumberOfVerticesPerChunk(), 800);
+}
+
+TEST(ChunkMeshArenaLayoutTest, MaxNumberOfVerticesShouldFollowTheLargestRemainingMesh)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    layout.place(first, topFaces(400));
+    layout.place(second, topFaces(800));
+
+    layout.place(second, topFaces(200));
+    EXPECT_EQ(layout.maxNumberOfVerticesPerChunk(), 400);
+
+    layout.removeChunk(first);
+    EXPECT_EQ(layout.maxNumberOfVerticesPerChunk(), 200);
+}
+
+TEST(ChunkMeshArenaLayoutTest, UsedSlotsShouldListAddedChunksInAscendingOrder)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    const auto third = *layout.addChunk();
+    layout.removeChunk(second);
+
+    EXPECT_EQ(layout.usedSlots(), (std::vector<ChunkMeshArenaLayout::Slot>{first, third}));
+}
+
+TEST(ChunkMeshArenaLayoutTest, SmallerMeshShouldBeWrittenInPlace)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    layout.place(first, topFaces(400));
+    layout.place(second, topFaces(800));
+
+    EXPECT_EQ(layout.place(first, topFaces(200)), 0);
+    EXPECT_EQ(layout.capacity(), 1200);
+    EXPECT_EQ(layout.numberOfVertices(), 1000);
+}
+
+TEST(ChunkMeshArenaLayoutTest, MuchSmallerMeshShouldGiveBackTheRestOfItsRange)
+{
+    auto layout = ChunkMeshArenaLayout(1200);
+    const auto first = *layout.addChunk();
+    layout.place(first, topFaces(400));
+
+    EXPECT_EQ(layout.place(first, topFaces(100)), 0);
+    EXPECT_EQ(layout.range(first).capacity, 100);
+    EXPECT_EQ(layout.statistics().freeSize, 1100);
+}
+
+TEST(ChunkMeshArenaLayoutTest, LargerMeshShouldGrowTheBufferWhenNoFreeRangeFits)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    layout.place(first, topFaces(400));
+    layout.place(second, topFaces(800));
+
+    EXPECT_EQ(layout.place(first, topFaces(440)), 1200);
+    EXPECT_EQ(layout.capacity(), 2400);
+    EXPECT_EQ(layout.numberOfVertices(), 1240);
+}
+
+TEST(ChunkMeshArenaLayoutTest, RangesOfRemovedChunksShouldBeReused)
+{
+    auto layout = ChunkMeshArenaLayout(1200);
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    const auto third = *layout.addChunk();
+    layout.place(first, topFaces(400));
+    layout.place(second, topFaces(400));
+    layout.place(third, topFaces(400));
+    layout.removeChunk(second);
+
+    const auto fourth = *layout.addChunk();
+
+    EXPECT_EQ(layout.place(fourth, topFaces(300)), 400);
+    EXPECT_EQ(layout.capacity(), 1200);
+}
+
+TEST(ChunkMeshArenaLayoutTest, DrawCommandsShouldCoverEveryChunkWithMesh)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto first = *layout.addChunk();
+    const auto empty = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    layout.place(first, topFaces(8));
+    layout.place(empty, topFaces(0));
+    layout.place(second, topFaces(4));
+
+    const auto commands = allFaceCommands(layout);
+    EXPECT_EQ(commands.numbersOfIndices, (std::vector<int>{12, 6}));
+    EXPECT_EQ(commands.baseVertices, (std::vector<int>{0, 8}));
+    EXPECT_EQ(commands.indexOffsets.size(), 2);
+}
+
+TEST(ChunkMeshArenaLayoutTest, DefragmentationShouldMoveTheLastChunkIntoAFreeRangeBeforeIt)
+{
+    constexpr auto vertices = 1u << 15;
+    constexpr auto numberOfChunks = 8u;
+    auto layout = ChunkMeshArenaLayout(numberOfChunks * vertices);
+    for (auto i = 0u; i < numberOfChunks; ++i)
+    {
+        layout.place(*layout.addChunk(), topFaces(vertices));
+    }
+    EXPECT_FALSE(layout.needsDefragmentation());
+    for (auto slot = 0u; slot < numberOfChunks; slot += 2)
+    {
+        layout.removeChunk(slot);
+    }
+    ASSERT_TRUE(layout.needsDefragmentation());
+
+    const auto move = layout.defragmentationStep();
+
+    ASSERT_TRUE(move.has_value());
+    EXPECT_EQ(move->fromVertex, 7 * vertices);
+    EXPECT_EQ(move->toVertex, 0);
+    EXPECT_EQ(move->numberOfVertices, vertices);
+    EXPECT_EQ(layout.range(7).firstVertex, 0);
+    EXPECT_EQ(allFaceCommands(layout).baseVertices.back(), 0);
+    EXPECT_FLOAT_EQ(layout.statistics().fragmentation(), 0.5f);
+    EXPECT_FALSE(layout.needsDefragmentation());
+}
+
+TEST(ChunkMeshArenaLayoutTest, DefragmentationShouldStopWhenNoChunkFitsBeforeItself)
+{
+    auto layout = ChunkMeshArenaLayout(1200);
+    const auto first = *layout.addChunk();
+    const auto second = *layout.addChunk();
+    layout.place(first, topFaces(400));
+    layout.place(second, topFaces(800));
+    layout.removeChunk(first);
+
+    EXPECT_FALSE(layout.defragmentationStep().has_value());
+}
+
+TEST(ChunkMeshArenaLayoutTest, ShouldRefuseChunksWhenAllSlotsAreTaken)
+{
+    auto layout = ChunkMeshArenaLayout();
+    for (auto i = 0u; i < ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_TRUE(layout.addChunk().has_value());
+    }
+    EXPECT_TRUE(layout.isFull());
+    EXPECT_FALSE(layout.addChunk().has_value());
+
+    layout.removeChunk(7);
+    EXPECT_EQ(layout.addChunk(), 7u);
+}
+
+TEST(ChunkMeshArenaLayoutTest, DrawCommandsShouldSkipFacesThatAreNotVisible)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto chunk = *layout.addChunk();
+    auto verticesPerFace = ChunkMeshArenaLayout::VerticesPerFace{};
+    verticesPerFace[static_cast<int>(Block::Face::Bottom)] = 4;
+    verticesPerFace[static_cast<int>(Block::Face::Top)] = 8;
+    verticesPerFace[static_cast<int>(Block::Face::Front)] = 12;
+    layout.place(chunk, verticesPerFace);
+    auto visibleFaces = std::array<ChunkMeshArenaLayout::FaceMask,
+                                   ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS>{};
+    visibleFaces[chunk] = faces({Block::Face::Bottom, Block::Face::Front});
+    auto commands = ChunkMeshArenaLayout::DrawCommands{};
+
+    const auto skippedFaces = layout.buildDrawCommands(visibleFaces, commands);
+
+    EXPECT_EQ(commands.numbersOfIndices, (std::vector<int>{6, 18}));
+    EXPECT_EQ(commands.baseVertices, (std::vector<int>{0, 12}));
+    EXPECT_EQ(commands.indexOffsets.size(), 2);
+    EXPECT_EQ(skippedFaces.numberOfRanges, 1);
+    EXPECT_EQ(skippedFaces.numberOfVertices, 8);
+}
+
+TEST(ChunkMeshArenaLayoutTest, NeighbouringVisibleFacesShouldBeDrawnByOneCommand)
+{
+    auto layout = ChunkMeshArenaLayout();
+    const auto chunk = *layout.addChunk();
+    auto verticesPerFace = ChunkMeshArenaLayout::VerticesPerFace{};
+    verticesPerFace[static_cast<int>(Block::Face::Top)] = 4;
+    verticesPerFace[static_cast<int>(Block::Face::Right)] = 8;
+    layout.place(chunk, verticesPerFace);
+    auto visibleFaces = std::array<ChunkMeshArenaLayout::FaceMask,
+                                   ChunkMeshArenaLayout::MAX_NUMBER_OF_CHUNKS>{};
+    visibleFaces.fill(ChunkMeshArenaLayout::ALL_FACES);
+    auto commands = ChunkMeshArenaLayout::DrawCommands{};
+
+    const auto skippedFaces = layout.buildDrawCommands(visibleFaces, commands);
+
+    EXPECT_EQ(commands.numbersOfIndices, (std::vector<int>{18}));
+    EXPECT_EQ(commands.baseVertices, (std::vector<int>{0}));
+    EXPECT_EQ(skippedFaces.numberOfRanges, 0);
+}
+
+TEST(ChunkMeshArenaLayoutTest, OnlyFacesPointingTowardsThePointShouldFaceIt)
+{
+    const auto boxMin = glm::vec3(0, 0, 0);
+    const auto boxMax = glm::vec3(64, 64, 64);
+
+    EXPECT_EQ(ChunkMeshArenaLayout::facesFacing({32, 100, 32}, boxMin, boxMax),
+              faces({Block::Face::Top, Block::Face::Left, Block::Face::Right, Block::Face::Front,
+                     Block::Face::Back}));
+    EXPECT_EQ(ChunkMeshArenaLayout::facesFacing({-10, 100, 80}, boxMin, boxMax),
+              faces({Block::Face::Top, Block::Face::Left, Block::Face::Front}));
+    EXPECT_EQ(ChunkMeshArenaLayout::facesFacing({32, 32, 32}, boxMin, boxMax),
+              ChunkMeshArenaLayout::ALL_FACES);
+}
+
+}// namespace Voxino::Polygons